@@ -906,7 +906,15 @@ void Scene::createDebugGui([[maybe_unused]] Rhi::IRenderTarget& mainRenderTarget
 				{ // Pipeline state compiler
 					const bool idle = (0 == renderer.getGraphicsPipelineStateCompiler().getNumberOfInFlightCompilerRequests() && 0 == renderer.getComputePipelineStateCompiler().getNumberOfInFlightCompilerRequests());
 					ImGui::PushStyleColor(ImGuiCol_Text, idle ? GREY_COLOR : RED_COLOR);
-					ImGui::Text("Pipeline State Compiler: %s", idle ? "Idle" : "Busy");
+					const float warmUpProgress = renderer.getPipelineStateObjectCacheWarmUpProgress();
+					if ( warmUpProgress < 1.0f )
+					{
+						ImGui::Text("Pipeline State Compiler: Warm-up %.0f%%", warmUpProgress * 100.0f);
+					}
+					else
+					{
+						ImGui::Text("Pipeline State Compiler: %s", idle ? "Idle" : "Busy");
+					}
 					ImGui::PopStyleColor();
 				}
 				ImGui::PopStyleColor();
@@ -0,0 +1,329 @@
+#include "stdafx.h"
+#include "Core/File/AsyncFileReader.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr ULONG_PTR SHUTDOWN_COMPLETION_KEY = 0;				// Completion key of the packet waking up the completion thread for the shutdown, read requests are never at address zero
+		static constexpr uint64_t  MAXIMUM_NUMBER_OF_BYTES_PER_READ = 0x7ffff000;	// "ReadFile()" reads at most a "DWORD" number of bytes at once, stay well below
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		inline void setOverlappedOffset(OVERLAPPED& overlapped, uint64_t offset)
+		{
+			overlapped = {};
+			overlapped.Offset	  = static_cast<DWORD>(offset & 0xffffffffu);
+			overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public AsyncFileReader::ReadRequest methods           ]
+//[-------------------------------------------------------]
+bool AsyncFileReader::ReadRequest::isRead(uint64_t offset, uint64_t numberOfBytes) const
+{
+	// File ranges might overlap each other, so walk until no read file range continues the covered part any longer
+	const uint64_t endOffset = offset + numberOfBytes;
+	bool continued = true;
+	while (offset < endOffset && continued)
+	{
+		continued = false;
+		for (size_t i = 0; i < mNumberOfReadRanges; ++i)
+		{
+			const ReadRange& readRange = mReadRanges[i];
+			if (readRange.offset <= offset && offset < readRange.offset + readRange.numberOfBytes)
+			{
+				offset = readRange.offset + readRange.numberOfBytes;
+				continued = true;
+			}
+		}
+	}
+	return (offset >= endOffset);
+}
+
+
+//[-------------------------------------------------------]
+//[ Private AsyncFileReader::ReadRequest methods          ]
+//[-------------------------------------------------------]
+void AsyncFileReader::ReadRequest::readBlocking(uint64_t offset, uint64_t numberOfBytes)
+{
+	// The resource loader needs bytes outside of the file ranges it asked for, read them the blocking way into the whole file sized buffer
+	// -> The event handle with the lowest bit set keeps the read away from the I/O completion port the file is associated with
+	SE_ASSERT(INVALID_HANDLE_VALUE != mFileHandle, "Invalid asynchronous file reader file handle")
+	const HANDLE eventHandle = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	bool succeeded = (nullptr != eventHandle);
+	uint64_t numberOfReadBytes = 0;
+	while (succeeded && numberOfReadBytes < numberOfBytes)
+	{
+		OVERLAPPED overlapped;
+		::detail::setOverlappedOffset(overlapped, offset + numberOfReadBytes);
+		overlapped.hEvent = reinterpret_cast<HANDLE>(reinterpret_cast<uintptr_t>(eventHandle) | 1);
+		const DWORD numberOfBytesToRead = static_cast<DWORD>(std::min(numberOfBytes - numberOfReadBytes, ::detail::MAXIMUM_NUMBER_OF_BYTES_PER_READ));
+		DWORD numberOfTransferredBytes = 0;
+		if (!::ReadFile(mFileHandle, mData + offset + numberOfReadBytes, numberOfBytesToRead, nullptr, &overlapped) && ERROR_IO_PENDING != ::GetLastError())
+		{
+			succeeded = false;
+		}
+		else
+		{
+			::WaitForSingleObject(eventHandle, INFINITE);
+			succeeded = (::GetOverlappedResult(mFileHandle, &overlapped, &numberOfTransferredBytes, FALSE) && 0 != numberOfTransferredBytes);
+			numberOfReadBytes += numberOfTransferredBytes;
+		}
+	}
+	if (nullptr != eventHandle)
+	{
+		::CloseHandle(eventHandle);
+	}
+	SE_ASSERT(succeeded, "Asynchronous file reader failed to read file bytes outside of the read file ranges")
+
+	// Remember the read file range so the bytes aren't read again
+	if (succeeded)
+	{
+		mReadRanges.insert(mReadRanges.begin() + static_cast<std::ptrdiff_t>(mNumberOfReadRanges), { offset, numberOfBytes });
+		++mNumberOfReadRanges;
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+AsyncFileReader::AsyncFileReader() :
+	mCompletionPort(::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1)),
+	mNumberOfReadsInFlight(0),
+	mShutdown(false)
+{
+	SE_ASSERT(nullptr != mCompletionPort, "Failed to create the asynchronous file reader I/O completion port")
+
+	// A single completion thread is sufficient, it only bookkeeps, issues follow-up reads and calls the completion callbacks
+	mCompletionThread = std::thread(&AsyncFileReader::completionThreadWorker, this);
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+	// Let the completion thread complete the submitted read requests and exit afterwards
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		mShutdown = true;
+	}
+	::PostQueuedCompletionStatus(mCompletionPort, 0, ::detail::SHUTDOWN_COMPLETION_KEY, nullptr);
+	mCompletionThread.join();
+	::CloseHandle(mCompletionPort);
+}
+
+void AsyncFileReader::submit(ReadRequest& readRequest)
+{
+	SE_ASSERT(!readRequest.mAbsoluteFilename.empty(), "Invalid asynchronous file reader absolute filename")
+	readRequest.mCurrentPosition = 0;
+	readRequest.mSucceeded = false;
+
+	// Opening the file and getting its size is done by the first submit, only the reading is done asynchronously
+	if (INVALID_HANDLE_VALUE == readRequest.mFileHandle)
+	{
+		readRequest.mFileHandle = ::CreateFileW(std_filesystem::u8path(readRequest.mAbsoluteFilename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+		LARGE_INTEGER fileSize;
+		if (INVALID_HANDLE_VALUE == readRequest.mFileHandle || !::GetFileSizeEx(readRequest.mFileHandle, &fileSize) ||
+			nullptr == ::CreateIoCompletionPort(readRequest.mFileHandle, mCompletionPort, reinterpret_cast<ULONG_PTR>(&readRequest), 0))
+		{
+			// Error!
+			completeReadRequest(readRequest, false);
+			return;
+		}
+		readRequest.mNumberOfBytes = static_cast<size_t>(fileSize.QuadPart);
+		if (0 != readRequest.mNumberOfBytes)
+		{
+			readRequest.mData = new uint8_t[readRequest.mNumberOfBytes];
+		}
+	}
+
+	// Clamp the newly added file ranges to the file, without any added file range the whole file is read
+	if (readRequest.mReadRanges.empty())
+	{
+		readRequest.addReadRange(0);
+	}
+	const uint64_t fileSize = readRequest.mNumberOfBytes;
+	for (size_t i = readRequest.mNumberOfReadRanges; i < readRequest.mReadRanges.size(); ++i)
+	{
+		ReadRequest::ReadRange& readRange = readRequest.mReadRanges[i];
+		readRange.offset = std::min(readRange.offset, fileSize);
+		readRange.numberOfBytes = std::min(readRange.numberOfBytes, fileSize - readRange.offset);
+	}
+	readRequest.mNumberOfReadRangeBytes = 0;
+	while (readRequest.mNumberOfReadRanges < readRequest.mReadRanges.size() && 0 == readRequest.mReadRanges[readRequest.mNumberOfReadRanges].numberOfBytes)
+	{
+		++readRequest.mNumberOfReadRanges;
+	}
+	if (readRequest.mNumberOfReadRanges == readRequest.mReadRanges.size())
+	{
+		// Nothing to read, e.g. empty files are still valid files
+		completeReadRequest(readRequest, true);
+		return;
+	}
+
+	// Issue the first read or let the read request wait for a free read slot
+	bool succeeded = true;
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		SE_ASSERT(!mShutdown, "Asynchronous file reader read request submitted during shutdown")
+		if (mNumberOfReadsInFlight < MAXIMUM_NUMBER_OF_READS_IN_FLIGHT)
+		{
+			succeeded = issueRead(readRequest);
+			if (succeeded)
+			{
+				++mNumberOfReadsInFlight;
+			}
+		}
+		else
+		{
+			mPendingReadRequests.push_back(&readRequest);
+		}
+	}
+	if (!succeeded)
+	{
+		// Error!
+		completeReadRequest(readRequest, false);
+	}
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+void AsyncFileReader::completeReadRequest(ReadRequest& readRequest, bool succeeded)
+{
+	readRequest.mSucceeded = succeeded;
+
+	// The read request might be destroyed or submitted again by the completion callback, so don't touch it afterwards
+	readRequest.mCompletionCallback(readRequest);
+}
+
+bool AsyncFileReader::issueRead(ReadRequest& readRequest)
+{
+	// Read the rest of the current file range, larger file ranges need multiple reads
+	const ReadRequest::ReadRange& readRange = readRequest.mReadRanges[readRequest.mNumberOfReadRanges];
+	const uint64_t offset = readRange.offset + readRequest.mNumberOfReadRangeBytes;
+	const DWORD numberOfBytes = static_cast<DWORD>(std::min(readRange.numberOfBytes - readRequest.mNumberOfReadRangeBytes, ::detail::MAXIMUM_NUMBER_OF_BYTES_PER_READ));
+	::detail::setOverlappedOffset(readRequest.mOverlapped, offset);
+
+	// Reads which are completed right away still queue a completion packet
+	return (::ReadFile(readRequest.mFileHandle, readRequest.mData + offset, numberOfBytes, nullptr, &readRequest.mOverlapped) || ERROR_IO_PENDING == ::GetLastError());
+}
+
+void AsyncFileReader::completionThreadWorker()
+{
+	bool shutdownRequested = false;
+	std::vector<ReadRequest*> completedReadRequests;
+	std::vector<ReadRequest*> failedReadRequests;
+	for (;;)
+	{
+		// Wait for a completion packet
+		DWORD numberOfTransferredBytes = 0;
+		ULONG_PTR completionKey = ::detail::SHUTDOWN_COMPLETION_KEY;
+		OVERLAPPED* overlapped = nullptr;
+		const BOOL result = ::GetQueuedCompletionStatus(mCompletionPort, &numberOfTransferredBytes, &completionKey, &overlapped, INFINITE);
+		if (nullptr == overlapped)
+		{
+			if (!result)
+			{
+				SE_ASSERT(false, "Failed to wait for asynchronous file reader I/O completion port packets")
+				break;
+			}
+			shutdownRequested = true;
+		}
+		else
+		{
+			// Continue with the next read of the read request or complete it, reuse the freed read slot for a waiting read request
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			ReadRequest* readRequest = reinterpret_cast<ReadRequest*>(completionKey);
+			bool readRequestDone = true;
+			if (!result || 0 == numberOfTransferredBytes)
+			{
+				// Error! E.g. the file was truncated in the meantime.
+				failedReadRequests.push_back(readRequest);
+			}
+			else
+			{
+				readRequest->mNumberOfReadRangeBytes += numberOfTransferredBytes;
+				while (readRequest->mNumberOfReadRanges < readRequest->mReadRanges.size() && readRequest->mNumberOfReadRangeBytes >= readRequest->mReadRanges[readRequest->mNumberOfReadRanges].numberOfBytes)
+				{
+					++readRequest->mNumberOfReadRanges;
+					readRequest->mNumberOfReadRangeBytes = 0;
+				}
+				if (readRequest->mNumberOfReadRanges == readRequest->mReadRanges.size())
+				{
+					completedReadRequests.push_back(readRequest);
+				}
+				else if (issueRead(*readRequest))
+				{
+					// The read slot is used for the next read of the read request
+					readRequestDone = false;
+				}
+				else
+				{
+					// Error!
+					failedReadRequests.push_back(readRequest);
+				}
+			}
+			if (readRequestDone)
+			{
+				--mNumberOfReadsInFlight;
+				while (!mPendingReadRequests.empty() && mNumberOfReadsInFlight < MAXIMUM_NUMBER_OF_READS_IN_FLIGHT)
+				{
+					ReadRequest* pendingReadRequest = mPendingReadRequests.front();
+					mPendingReadRequests.pop_front();
+					if (issueRead(*pendingReadRequest))
+					{
+						++mNumberOfReadsInFlight;
+					}
+					else
+					{
+						// Error!
+						failedReadRequests.push_back(pendingReadRequest);
+					}
+				}
+			}
+		}
+
+		// Call the completion callbacks without holding the lock, they are allowed to submit read requests
+		for (ReadRequest* readRequest : completedReadRequests)
+		{
+			completeReadRequest(*readRequest, true);
+		}
+		for (ReadRequest* readRequest : failedReadRequests)
+		{
+			completeReadRequest(*readRequest, false);
+		}
+		completedReadRequests.clear();
+		failedReadRequests.clear();
+
+		// Exit as soon as everything has been completed
+		if (shutdownRequested)
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			if (0 == mNumberOfReadsInFlight && mPendingReadRequests.empty())
+			{
+				break;
+			}
+		}
+	}
+}
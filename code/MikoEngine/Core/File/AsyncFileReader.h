@@ -0,0 +1,256 @@
+#pragma once
+
+#include "Core/File/IFile.h"
+#include "Core/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	SE_PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <deque>
+	#include <mutex>
+	#include <thread>
+SE_PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Asynchronous file reader keeping many file reads in flight at once
+*
+*  @remarks
+*    Blocking "IFile::read()" calls done one file after another keep the storage at a queue depth of one, which wastes most of the
+*    throughput e.g. NVMe solid-state drives can deliver. The asynchronous file reader reads files into memory using overlapped I/O and
+*    an I/O completion port while the caller goes on with other work, the completion callback is called as soon as the requested file
+*    ranges are inside memory. Read requests can be submitted multiple times with further file ranges, so e.g. a file header can be read
+*    first and afterwards only the parts of the file which are really needed.
+*
+*  @note
+*    - The completion callback is called by an internal thread
+*    - Works with absolute filenames, files which aren't plain files inside the file system (e.g. inside ZIP archives) fail to read and
+*      must be read the usual way
+*/
+class AsyncFileReader final
+{
+
+
+//[-------------------------------------------------------]
+//[ Public definitions                                    ]
+//[-------------------------------------------------------]
+public:
+	class ReadRequest;
+	typedef void (*CompletionCallback)(ReadRequest& readRequest);
+	static constexpr uint32_t MAXIMUM_NUMBER_OF_READS_IN_FLIGHT = 64;
+
+	/**
+	*  @brief
+	*    Read request of file ranges, after the completion it's an in-memory file of the read data
+	*
+	*  @remarks
+	*    The in-memory file has the size of the whole file. Reading bytes outside of the read file ranges falls back to a blocking read,
+	*    skipping them is free.
+	*
+	*  @note
+	*    - Derive from it to attach user data, the reader doesn't destroy read requests
+	*    - The file stays opened as long as the read request exists
+	*/
+	class ReadRequest : public IFile
+	{
+		friend class AsyncFileReader;
+	public:
+		struct ReadRange final
+		{
+			uint64_t offset;
+			uint64_t numberOfBytes;	// Clamped to the file size as soon as the read request is submitted
+		};
+		typedef std::vector<ReadRange> ReadRanges;
+
+	public:
+		inline ReadRequest(const std::string& absoluteFilename, CompletionCallback completionCallback) :
+			mAbsoluteFilename(absoluteFilename),
+			mCompletionCallback(completionCallback),
+			mFileHandle(INVALID_HANDLE_VALUE),
+			mOverlapped{},
+			mData(nullptr),
+			mNumberOfBytes(0),
+			mNumberOfReadRanges(0),
+			mNumberOfReadRangeBytes(0),
+			mCurrentPosition(0),
+			mSucceeded(false)
+		{
+			SE_ASSERT(nullptr != completionCallback, "Invalid asynchronous file reader completion callback")
+		}
+
+		inline virtual ~ReadRequest() override
+		{
+			if (INVALID_HANDLE_VALUE != mFileHandle)
+			{
+				::CloseHandle(mFileHandle);
+			}
+			delete [] mData;
+		}
+
+		[[nodiscard]] inline const std::string& getAbsoluteFilename() const
+		{
+			return mAbsoluteFilename;
+		}
+
+		[[nodiscard]] inline bool hasSucceeded() const
+		{
+			return mSucceeded;
+		}
+
+		/**
+		*  @brief
+		*    Add a file range to read with the next submit, without any added file range the whole file is read
+		*
+		*  @param[in] offset
+		*    Offset in bytes from the start of the file
+		*  @param[in] numberOfBytes
+		*    Number of bytes to read, invalid number of bytes means up to the end of the file
+		*/
+		inline void addReadRange(uint64_t offset, uint64_t numberOfBytes = GetInvalid<uint64_t>())
+		{
+			mReadRanges.push_back({ offset, numberOfBytes });
+		}
+
+		[[nodiscard]] inline const ReadRanges& getReadRanges() const
+		{
+			return mReadRanges;
+		}
+
+		[[nodiscard]] bool isRead(uint64_t offset, uint64_t numberOfBytes) const;
+
+	public:
+		[[nodiscard]] inline virtual size_t getNumberOfBytes() override
+		{
+			return mNumberOfBytes;
+		}
+
+		inline virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+		{
+			SE_ASSERT(nullptr != destinationBuffer, "Letting a file read into a null destination buffer is not allowed")
+			SE_ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+			SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+			if (!isRead(mCurrentPosition, numberOfBytes))
+			{
+				readBlocking(mCurrentPosition, numberOfBytes);
+			}
+			memcpy(destinationBuffer, mData + mCurrentPosition, numberOfBytes);
+			mCurrentPosition += numberOfBytes;
+		}
+
+		inline virtual void skip(size_t numberOfBytes) override
+		{
+			SE_ASSERT(0 != numberOfBytes, "Letting a file skip zero bytes is not allowed")
+			SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+			mCurrentPosition += numberOfBytes;
+		}
+
+		[[nodiscard]] inline virtual const uint8_t* getView(size_t numberOfBytes) override
+		{
+			SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+			if (0 != numberOfBytes && !isRead(mCurrentPosition, numberOfBytes))
+			{
+				readBlocking(mCurrentPosition, numberOfBytes);
+			}
+			return mData + mCurrentPosition;
+		}
+
+		inline virtual void write([[maybe_unused]] const void* sourceBuffer, [[maybe_unused]] size_t numberOfBytes) override
+		{
+			SE_ASSERT(false, "Asynchronously read files are read-only")
+		}
+
+#if SE_DEBUG
+		[[nodiscard]] inline virtual const char* getDebugFilename() const override
+		{
+			return mAbsoluteFilename.c_str();
+		}
+#endif
+
+	protected:
+		explicit ReadRequest(const ReadRequest&) = delete;
+		ReadRequest& operator=(const ReadRequest&) = delete;
+
+	private:
+		void readBlocking(uint64_t offset, uint64_t numberOfBytes);
+
+	private:
+		std::string		   mAbsoluteFilename;
+		CompletionCallback mCompletionCallback;
+		HANDLE			   mFileHandle;				// Opened for overlapped I/O by the first submit, "INVALID_HANDLE_VALUE" if there's no opened file
+		OVERLAPPED		   mOverlapped;				// There's at most one read in flight per read request
+		uint8_t*		   mData;					// Whole file sized buffer, only the read file ranges are initialized, can be a null pointer, destroy the data if you no longer need it
+		size_t			   mNumberOfBytes;			// File size
+		ReadRanges		   mReadRanges;				// Added file ranges, the first "mNumberOfReadRanges" ones have been read
+		size_t			   mNumberOfReadRanges;		// Number of read file ranges
+		uint64_t		   mNumberOfReadRangeBytes;	// Read progress inside the file range currently being read
+		size_t			   mCurrentPosition;		// Read position of the in-memory file
+		bool			   mSucceeded;
+	};
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*/
+	AsyncFileReader();
+
+	/**
+	*  @brief
+	*    Destructor, waits until all submitted read requests have been completed
+	*/
+	~AsyncFileReader();
+
+	/**
+	*  @brief
+	*    Submit a read request
+	*
+	*  @param[in] readRequest
+	*    Read request to submit, must stay valid until its completion callback was called, the file ranges added since the last submit are read
+	*
+	*  @note
+	*    - The completion callback might be called before this method returns, e.g. if the file can't be opened
+	*/
+	void submit(ReadRequest& readRequest);
+
+
+//[-------------------------------------------------------]
+//[ Private definitions                                   ]
+//[-------------------------------------------------------]
+private:
+	typedef std::deque<ReadRequest*> ReadRequests;
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	explicit AsyncFileReader(const AsyncFileReader&) = delete;
+	AsyncFileReader& operator=(const AsyncFileReader&) = delete;
+	void completeReadRequest(ReadRequest& readRequest, bool succeeded);
+	[[nodiscard]] bool issueRead(ReadRequest& readRequest);	// "mMutex" must be locked, returns "false" on error
+	void completionThreadWorker();
+
+
+//[-------------------------------------------------------]
+//[ Private data                                          ]
+//[-------------------------------------------------------]
+private:
+	HANDLE		 mCompletionPort;			// I/O completion port all opened files are associated with
+	std::mutex	 mMutex;
+	ReadRequests mPendingReadRequests;		// Read requests waiting for a free read slot, do only touch if "mMutex" is locked
+	uint32_t	 mNumberOfReadsInFlight;	// Number of read requests with a read in flight, do only touch if "mMutex" is locked
+	bool		 mShutdown;					// Do only touch if "mMutex" is locked
+	std::thread	 mCompletionThread;
+
+
+};
@@ -570,12 +570,13 @@ namespace Renderer
 		//[ Private data                                          ]
 		//[-------------------------------------------------------]
 	private:
+		Rhi::ILog&			   mLog;
 		Rhi::IAssert&		   mAssert;
 		DefaultAllocator&	   mAllocator;
 		AbsoluteDirectoryNames mAbsoluteBaseDirectory;	// Absolute UTF-8 base directory, without "/" at the end
 		MountedDirectories	   mMountedDirectories;
 #if SE_DEBUG
-		mutable int mNumberOfCurrentlyOpenedFiles = 0;	// For leak detection
+		mutable std::atomic<int> mNumberOfCurrentlyOpenedFiles = 0;	// For leak detection, atomic since the resource streamer opens files from multiple threads
 #endif
 
 
@@ -44,6 +44,25 @@ public:
 	*/
 	virtual void skip(size_t numberOfBytes) = 0;
 
+	/**
+	*  @brief
+	*    Return a read-only view onto the next requested number of bytes without copying them
+	*
+	*  @param[in] numberOfBytes
+	*    Number of bytes to view, it's the callers responsibility that this number of byte is correct
+	*
+	*  @return
+	*    Pointer to the file data at the current read position, null pointer if the file implementation doesn't support views (default)
+	*
+	*  @note
+	*    - The view stays valid and unchanged as long as the file is opened
+	*    - The read position isn't changed, use "skip()" after consuming the viewed bytes
+	*/
+	[[nodiscard]] inline virtual const uint8_t* getView([[maybe_unused]] size_t numberOfBytes)
+	{
+		return nullptr;
+	}
+
 	//[-------------------------------------------------------]
 	//[ Write                                                 ]
 	//[-------------------------------------------------------]
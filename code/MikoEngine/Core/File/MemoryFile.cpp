@@ -78,14 +78,39 @@ void MemoryFile::setLz4CompressedDataByFile(IFile& file, uint32_t numberOfCompre
 		mNumberOfDecompressedBytes = numberOfDecompressedBytes;
 	mDecompressedData.clear();
 	mCurrentDataPointer = nullptr;
-	mCompressedData.resize(numberOfCompressedBytes);
-	file.read(mCompressedData.data(), numberOfCompressedBytes);
+	const uint8_t* view = file.getView(numberOfCompressedBytes);
+	if (nullptr != view)
+	{
+		// Zero-copy: Decompress straight from the file view, there's no need to hold a copy of the compressed data
+		mCompressedData.clear();
+		decompressFrom(view, numberOfCompressedBytes);
+		file.skip(numberOfCompressedBytes);
+	}
+	else
+	{
+		mCompressedData.resize(numberOfCompressedBytes);
+		file.read(mCompressedData.data(), numberOfCompressedBytes);
+	}
 }
 
 void MemoryFile::decompress()
+{
+	// Nothing to decompress if it was already done straight from a file view
+	if (mCompressedData.empty())
+	{
+		SE_ASSERT(mDecompressedData.size() == mNumberOfDecompressedBytes, "Invalid number of decompressed bytes")
+		mCurrentDataPointer = mDecompressedData.data();
+	}
+	else
+	{
+		decompressFrom(mCompressedData.data(), mCompressedData.size());
+	}
+}
+
+void MemoryFile::decompressFrom(const uint8_t* compressedData, size_t numberOfCompressedBytes)
 {
 	mDecompressedData.resize(mNumberOfDecompressedBytes);
-	[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(mCompressedData.data()), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(mCompressedData.size()), static_cast<int>(mNumberOfDecompressedBytes));
+	[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(numberOfCompressedBytes), static_cast<int>(mNumberOfDecompressedBytes));
 	SE_ASSERT(mNumberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
 		mCurrentDataPointer = mDecompressedData.data();
 }
@@ -102,7 +102,10 @@ protected:
 	MemoryFile& operator=(const MemoryFile&) = delete;
 
 private:
-	ByteVector mCompressedData;		// Owns the data
+	void decompressFrom(const uint8_t* compressedData, size_t numberOfCompressedBytes);
+
+private:
+	ByteVector mCompressedData;		// Owns the data, empty if the data was decompressed straight from a file view
 	ByteVector mDecompressedData;	// Owns the data
 	uint32_t   mNumberOfDecompressedBytes;
 	uint8_t* mCurrentDataPointer;	// Pointer to the current uncompressed data position, doesn't own the data
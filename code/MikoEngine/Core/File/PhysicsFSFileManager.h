@@ -137,6 +137,134 @@ namespace
 #endif
 		};
 
+		/**
+		*  @brief
+		*    Read file inside a native mounted directory, mapped into memory as a whole
+		*
+		*  @remarks
+		*    Exposes read-only views via "IFile::getView()", so e.g. "MemoryFile" decompresses straight from the mapping without copying the
+		*    compressed data first and hot assets are served by the operating system page cache without any read system calls.
+		*/
+		class PhysicsFSMappedReadFile final : public PhysicsFSFile
+		{
+		public:
+			inline PhysicsFSMappedReadFile(const std::string& absoluteFilename, [[maybe_unused]] const char* virtualFilename) :
+				mOpened(false),
+				mFileMapping(nullptr),
+				mData(nullptr),
+				mNumberOfBytes(0),
+				mCurrentPosition(0)
+#if SE_DEBUG
+				, mDebugName(virtualFilename)
+#endif
+			{
+				// The file handle can be closed directly after mapping, the mapping keeps the file alive
+				const HANDLE fileHandle = ::CreateFileW(std_filesystem::u8path(absoluteFilename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (INVALID_HANDLE_VALUE != fileHandle)
+				{
+					LARGE_INTEGER fileSize;
+					if (::GetFileSizeEx(fileHandle, &fileSize))
+					{
+						if (0 == fileSize.QuadPart)
+						{
+							// Empty files can't be mapped, but they are still valid files
+							mOpened = true;
+						}
+						else
+						{
+							mFileMapping = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+							if (nullptr != mFileMapping)
+							{
+								mData = static_cast<const uint8_t*>(::MapViewOfFile(mFileMapping, FILE_MAP_READ, 0, 0, 0));
+								if (nullptr != mData)
+								{
+									mNumberOfBytes = static_cast<size_t>(fileSize.QuadPart);
+									mOpened = true;
+								}
+							}
+						}
+					}
+					::CloseHandle(fileHandle);
+				}
+				SE_ASSERT(mOpened, "Failed to open mapped file for reading")
+			}
+
+			inline virtual ~PhysicsFSMappedReadFile() override
+			{
+				if (nullptr != mData)
+				{
+					::UnmapViewOfFile(mData);
+				}
+				if (nullptr != mFileMapping)
+				{
+					::CloseHandle(mFileMapping);
+				}
+			}
+
+		public:
+			[[nodiscard]] inline virtual bool isInvalid() const override
+			{
+				return !mOpened;
+			}
+
+		public:
+			[[nodiscard]] inline virtual size_t getNumberOfBytes() override
+			{
+				SE_ASSERT(mOpened, "Invalid mapped file access")
+				return mNumberOfBytes;
+			}
+
+			inline virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+			{
+				SE_ASSERT(nullptr != destinationBuffer, "Letting a file read into a null destination buffer is not allowed")
+				SE_ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				memcpy(destinationBuffer, mData + mCurrentPosition, numberOfBytes);
+				mCurrentPosition += numberOfBytes;
+			}
+
+			inline virtual void skip(size_t numberOfBytes) override
+			{
+				SE_ASSERT(0 != numberOfBytes, "Letting a file skip zero bytes is not allowed")
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				mCurrentPosition += numberOfBytes;
+			}
+
+			[[nodiscard]] inline virtual const uint8_t* getView([[maybe_unused]] size_t numberOfBytes) override
+			{
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				return mData + mCurrentPosition;
+			}
+
+			inline virtual void write([[maybe_unused]] const void* sourceBuffer, [[maybe_unused]] size_t numberOfBytes) override
+			{
+				SE_ASSERT(nullptr != sourceBuffer, "Letting a file write from a null source buffer is not allowed")
+				SE_ASSERT(0 != numberOfBytes, "Letting a file write zero bytes is not allowed")
+				SE_ASSERT(false, "File write method not supported by the mapped implementation")
+			}
+
+#if SE_DEBUG
+			[[nodiscard]] inline virtual const char* getDebugFilename() const override
+			{
+				return mDebugName.c_str();
+			}
+#endif
+
+		protected:
+			explicit PhysicsFSMappedReadFile(const PhysicsFSMappedReadFile&) = delete;
+			PhysicsFSMappedReadFile& operator=(const PhysicsFSMappedReadFile&) = delete;
+
+		private:
+			bool		   mOpened;
+			HANDLE		   mFileMapping;
+			const uint8_t* mData;	// Read-only mapping of the whole file, null pointer for empty files
+			size_t		   mNumberOfBytes;
+			size_t		   mCurrentPosition;
+#if SE_DEBUG
+			std::string mDebugName;	// Debug name for easier file identification when debugging
+#endif
+		};
+
 		class PhysicsFSWriteFile final : public PhysicsFSFile
 		{
 		public:
@@ -227,6 +355,10 @@ namespace
 *  @brief
 *    PhysicsFS ( https://icculus.org/physfs/ ) file manager implementation class one can use
 *
+*  @remarks
+*    Files opened for reading which reside inside a native mounted directory are mapped into memory and support "IFile::getView()",
+*    files inside mounted archives are read through PhysicsFS.
+*
 *  @note
 *    - Designed to be instanced and used inside a single C++ file
 *    - Primarily for renderer with restricted write access
@@ -466,7 +598,17 @@ public:
 			::detail::PhysicsFSFile* file = nullptr;
 		if (FileMode::READ == fileMode)
 		{
-			file = new ::detail::PhysicsFSReadFile(virtualFilename);
+			// Map files inside native mounted directories into memory, PhysicsFS is only needed for files inside archives
+			const char* realDirectory = PHYSFS_getRealDir(virtualFilename);
+			std::error_code errorCode;
+			if (nullptr != realDirectory && std_filesystem::is_directory(std_filesystem::u8path(realDirectory), errorCode))
+			{
+				file = new ::detail::PhysicsFSMappedReadFile(mapVirtualToAbsoluteFilename(fileMode, virtualFilename), virtualFilename);
+			}
+			else
+			{
+				file = new ::detail::PhysicsFSReadFile(virtualFilename);
+			}
 		}
 		else
 		{
@@ -507,6 +649,6 @@ protected:
 private:
 	bool	   mOwnsPhysicsFSInstance;
 #if SE_DEBUG
-	mutable int mNumberOfCurrentlyOpenedFiles = 0;	// For leak detection
+	mutable std::atomic<int> mNumberOfCurrentlyOpenedFiles = 0;	// For leak detection, atomic since the resource streamer opens files from multiple threads
 #endif
 };
\ No newline at end of file
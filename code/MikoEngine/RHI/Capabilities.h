@@ -29,6 +29,7 @@ namespace Rhi
 			, baseVertex(false)
 			, nativeMultithreading(false)
 			, shaderBytecode(false)
+			, pipelineStateBinaryId(0)
 			, vertexShader(false)
 			, maximumNumberOfPatchVertices(0)
 			, maximumNumberOfGsOutputVertices(0)
@@ -60,6 +61,7 @@ namespace Rhi
 		bool				baseVertex;										// Base vertex supported for draw calls?
 		bool				nativeMultithreading;							// Does the RHI support native multithreading? For example Direct3D 11 does meaning we can also create RHI resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
 		bool				shaderBytecode;									// Shader bytecode supported?
+		uint32_t			pipelineStateBinaryId;							// Identifies the GPU and driver pipeline state backend binaries ("Rhi::PipelineStateBinary") are valid for, changes e.g. on driver updates, 0 if pipeline state backend binaries aren't supported
 		// Graphics
 		bool				vertexShader;									// Is there support for vertex shaders (VS)?
 		uint32_t			maximumNumberOfPatchVertices;					// Tessellation-control-shader (TCS) stage and tessellation-evaluation-shader (TES) stage: Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
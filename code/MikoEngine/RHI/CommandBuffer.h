@@ -392,6 +392,27 @@ namespace Rhi
 			clear();
 		}
 
+		/**
+		*  @brief
+		*    Optimize the recorded commands in place by removing redundant state changes and merging adjacent multi-draw-indirect draws
+		*
+		*  @param[in] rhi
+		*    RHI the command buffer is going to be submitted to, receives the optimization statistics
+		*
+		*  @remarks
+		*    - Graphics root signature, pipeline state, resource group and vertex array commands setting the already set state are removed
+		*    - Adjacent indirect draws using consecutive arguments of the same indirect buffer are merged into a single multi-draw-indirect
+		*    The RHI state at the start of the command buffer is considered to be unknown. Commands which might change the RHI state in a way
+		*    which isn't tracked (render target changes, clears, compute and resource commands, executing other command buffers) reset the
+		*    tracked state. Recording the command buffer once, optimizing it once and submitting it multiple times is supported.
+		*
+		*  @note
+		*    - Only transformations which don't change what the shaders see are done. Each merged indirect draw keeps its own draw arguments
+		*      including the start instance location, the renderer is using a per-instance draw ID vertex attribute instead of "gl_DrawID".
+		*      Non-indirect draws are never merged into instanced draws since this would change the instance ID ("SV_InstanceID") seen by the shaders.
+		*/
+		void optimize(IRhi& rhi);
+
 		// Private definitions
 	private:
 		static constexpr uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
@@ -1382,6 +1403,215 @@ namespace Rhi
 
 	}
 
+	// Command buffer optimization, needs the concrete commands
+	inline void CommandBuffer::optimize([[maybe_unused]] IRhi& rhi)
+	{
+		if (isEmpty())
+		{
+			return;
+		}
+
+		// Tracked graphics state, everything is unknown at the start of the command buffer
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS = 16;
+		const IRootSignature* currentRootSignature = nullptr;
+		const IGraphicsPipelineState* currentGraphicsPipelineState = nullptr;
+		const IVertexArray* currentVertexArray = nullptr;
+		const IResourceGroup* currentResourceGroups[MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS] = {};
+		bool rootSignatureKnown = false;
+		bool graphicsPipelineStateKnown = false;
+		bool vertexArrayKnown = false;
+		bool resourceGroupKnown[MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS] = {};
+
+		// Compact the command packets in place: Kept command packets are moved towards the start of the command packet buffer, the
+		// command packets are stored in recording order so the write byte index never overtakes the read byte index
+		uint32_t readCommandPacketByteIndex = 0;
+		uint32_t writeCommandPacketByteIndex = 0;
+		uint32_t previousWrittenCommandPacketByteIndex = ~0u;
+		uint32_t numberOfRemovedCommands = 0;
+		uint32_t numberOfMergedDrawCommands = 0;
+		while (~0u != readCommandPacketByteIndex)
+		{
+			CommandPacket commandPacket = &mCommandPacketBuffer[readCommandPacketByteIndex];
+			const uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+			const uint32_t numberOfCommandPacketBytes = ((~0u != nextCommandPacketByteIndex) ? nextCommandPacketByteIndex : mCurrentCommandPacketByteIndex) - readCommandPacketByteIndex;
+			CommandPacket previousWrittenCommandPacket = (~0u != previousWrittenCommandPacketByteIndex) ? &mCommandPacketBuffer[previousWrittenCommandPacketByteIndex] : nullptr;
+			const CommandDispatchFunctionIndex commandDispatchFunctionIndex = CommandPacketHelper::loadCommandDispatchFunctionIndex(commandPacket);
+			bool removeCommand = false;
+			bool mergedCommand = false;
+			switch (commandDispatchFunctionIndex)
+			{
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_ROOT_SIGNATURE:
+				{
+					const Command::SetGraphicsRootSignature* command = CommandPacketHelper::getCommand<Command::SetGraphicsRootSignature>(commandPacket);
+					if (rootSignatureKnown && currentRootSignature == command->rootSignature)
+					{
+						removeCommand = true;
+					}
+					else
+					{
+						// A new root signature invalidates the resource group bindings
+						rootSignatureKnown = true;
+						currentRootSignature = command->rootSignature;
+						std::fill(std::begin(resourceGroupKnown), std::end(resourceGroupKnown), false);
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE:
+				{
+					const Command::SetGraphicsPipelineState* command = CommandPacketHelper::getCommand<Command::SetGraphicsPipelineState>(commandPacket);
+					if (graphicsPipelineStateKnown && currentGraphicsPipelineState == command->graphicsPipelineState)
+					{
+						removeCommand = true;
+					}
+					else
+					{
+						graphicsPipelineStateKnown = true;
+						currentGraphicsPipelineState = command->graphicsPipelineState;
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP:
+				{
+					const Command::SetGraphicsResourceGroup* command = CommandPacketHelper::getCommand<Command::SetGraphicsResourceGroup>(commandPacket);
+					if (command->rootParameterIndex < MAXIMUM_NUMBER_OF_TRACKED_ROOT_PARAMETERS)
+					{
+						if (resourceGroupKnown[command->rootParameterIndex] && currentResourceGroups[command->rootParameterIndex] == command->resourceGroup)
+						{
+							removeCommand = true;
+						}
+						else
+						{
+							resourceGroupKnown[command->rootParameterIndex] = true;
+							currentResourceGroups[command->rootParameterIndex] = command->resourceGroup;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY:
+				{
+					const Command::SetGraphicsVertexArray* command = CommandPacketHelper::getCommand<Command::SetGraphicsVertexArray>(commandPacket);
+					if (vertexArrayKnown && currentVertexArray == command->vertexArray)
+					{
+						removeCommand = true;
+					}
+					else
+					{
+						vertexArrayKnown = true;
+						currentVertexArray = command->vertexArray;
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::DRAW_GRAPHICS:
+				{
+					// Merge a multi-draw-indirect with the directly preceding kept one, if it's continuing the indirect buffer arguments
+					const Command::DrawGraphics* command = CommandPacketHelper::getCommand<Command::DrawGraphics>(commandPacket);
+					if (nullptr != command->indirectBuffer && nullptr != previousWrittenCommandPacket && CommandDispatchFunctionIndex::DRAW_GRAPHICS == CommandPacketHelper::loadCommandDispatchFunctionIndex(previousWrittenCommandPacket))
+					{
+						Command::DrawGraphics* previousCommand = CommandPacketHelper::getCommand<Command::DrawGraphics>(previousWrittenCommandPacket);
+						if (previousCommand->indirectBuffer == command->indirectBuffer && previousCommand->indirectBufferOffset + previousCommand->numberOfDraws * static_cast<uint32_t>(sizeof(DrawArguments)) == command->indirectBufferOffset)
+						{
+							previousCommand->numberOfDraws += command->numberOfDraws;
+							mergedCommand = true;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS:
+				{
+					// Merge a multi-draw-indirect with the directly preceding kept one, if it's continuing the indirect buffer arguments
+					const Command::DrawIndexedGraphics* command = CommandPacketHelper::getCommand<Command::DrawIndexedGraphics>(commandPacket);
+					if (nullptr != command->indirectBuffer && nullptr != previousWrittenCommandPacket && CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS == CommandPacketHelper::loadCommandDispatchFunctionIndex(previousWrittenCommandPacket))
+					{
+						Command::DrawIndexedGraphics* previousCommand = CommandPacketHelper::getCommand<Command::DrawIndexedGraphics>(previousWrittenCommandPacket);
+						if (previousCommand->indirectBuffer == command->indirectBuffer && previousCommand->indirectBufferOffset + previousCommand->numberOfDraws * static_cast<uint32_t>(sizeof(DrawIndexedArguments)) == command->indirectBufferOffset)
+						{
+							previousCommand->numberOfDraws += command->numberOfDraws;
+							mergedCommand = true;
+						}
+					}
+					break;
+				}
+
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_VIEWPORTS:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_SCISSOR_RECTANGLES:
+				case CommandDispatchFunctionIndex::DRAW_MESH_TASKS:
+				case CommandDispatchFunctionIndex::RESET_QUERY_POOL:
+				case CommandDispatchFunctionIndex::BEGIN_QUERY:
+				case CommandDispatchFunctionIndex::END_QUERY:
+				case CommandDispatchFunctionIndex::WRITE_TIMESTAMP_QUERY:
+				case CommandDispatchFunctionIndex::SET_DEBUG_MARKER:
+				case CommandDispatchFunctionIndex::BEGIN_DEBUG_EVENT:
+				case CommandDispatchFunctionIndex::END_DEBUG_EVENT:
+					// Doesn't change the tracked state, but the command is kept so it ends a draw merge
+					break;
+
+				case CommandDispatchFunctionIndex::EXECUTE_COMMAND_BUFFER:
+				case CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET:
+				case CommandDispatchFunctionIndex::CLEAR_GRAPHICS:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_ROOT_SIGNATURE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_PIPELINE_STATE:
+				case CommandDispatchFunctionIndex::SET_COMPUTE_RESOURCE_GROUP:
+				case CommandDispatchFunctionIndex::DISPATCH_COMPUTE:
+				case CommandDispatchFunctionIndex::SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX:
+				case CommandDispatchFunctionIndex::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+				case CommandDispatchFunctionIndex::COPY_RESOURCE:
+				case CommandDispatchFunctionIndex::GENERATE_MIPMAPS:
+				case CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+				default:
+					// The RHI state might have been changed in a way we don't track (e.g. OpenGL uses a single program for graphics and compute), forget everything
+					rootSignatureKnown = graphicsPipelineStateKnown = vertexArrayKnown = false;
+					std::fill(std::begin(resourceGroupKnown), std::end(resourceGroupKnown), false);
+					break;
+			}
+
+			// Keep or drop the command packet
+			if (removeCommand || mergedCommand)
+			{
+				if (removeCommand)
+				{
+					++numberOfRemovedCommands;
+				}
+				else
+				{
+					++numberOfMergedDrawCommands;
+				}
+			}
+			else
+			{
+				if (writeCommandPacketByteIndex != readCommandPacketByteIndex)
+				{
+					memmove(&mCommandPacketBuffer[writeCommandPacketByteIndex], commandPacket, numberOfCommandPacketBytes);
+				}
+				if (nullptr != previousWrittenCommandPacket)
+				{
+					CommandPacketHelper::storeNextCommandPacketByteIndex(previousWrittenCommandPacket, writeCommandPacketByteIndex);
+				}
+				CommandPacketHelper::storeNextCommandPacketByteIndex(&mCommandPacketBuffer[writeCommandPacketByteIndex], ~0u);
+				previousWrittenCommandPacketByteIndex = writeCommandPacketByteIndex;
+				writeCommandPacketByteIndex += numberOfCommandPacketBytes;
+			}
+
+			// Next command packet
+			readCommandPacketByteIndex = nextCommandPacketByteIndex;
+		}
+
+		// Finalize
+		mPreviousCommandPacketByteIndex = previousWrittenCommandPacketByteIndex;
+		mCurrentCommandPacketByteIndex = writeCommandPacketByteIndex;
+#if SE_RHI_STATISTICS
+		mNumberOfCommands -= numberOfRemovedCommands + numberOfMergedDrawCommands;
+		Statistics& statistics = rhi.getStatistics();
+		++statistics.numberOfOptimizedCommandBuffers;
+		statistics.numberOfRemovedRedundantCommands += numberOfRemovedCommands;
+		statistics.numberOfMergedDrawCommands += numberOfMergedDrawCommands;
+#endif
+	}
+
 	// Debug macros
 #if SE_DEBUG
 	/**
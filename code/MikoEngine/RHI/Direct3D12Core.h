@@ -40,6 +40,39 @@ namespace
 			}
 		}
 
+		[[nodiscard]] inline uint32_t calculateFNV1a32(const uint8_t* content, uint32_t numberOfBytes, uint32_t hash = 2166136261u)
+		{
+			// FNV-1a, 16777619 is the 32 bit FNV prime
+			for ( uint32_t i = 0; i < numberOfBytes; ++i )
+			{
+				hash = (hash ^ content[i]) * 16777619u;
+			}
+			return hash;
+		}
+
+		[[nodiscard]] inline bool getPipelineStateBinary(ID3D12PipelineState* d3d12PipelineState, Rhi::PipelineStateBinary& pipelineStateBinary)
+		{
+			ID3DBlob* d3dBlob = nullptr;
+			if ( nullptr != d3d12PipelineState && SUCCEEDED(d3d12PipelineState->GetCachedBlob(&d3dBlob)) )
+			{
+				const uint32_t numberOfBytes = static_cast<uint32_t>(d3dBlob->GetBufferSize());
+				if ( 0 != numberOfBytes )
+				{
+					memcpy(pipelineStateBinary.allocateBinary(numberOfBytes), d3dBlob->GetBufferPointer(), numberOfBytes);
+				}
+				else
+				{
+					pipelineStateBinary.clear();
+				}
+				d3dBlob->Release();
+				return (0 != numberOfBytes);
+			}
+
+			// Error!
+			pipelineStateBinary.clear();
+			return false;
+		}
+
 		class UploadCommandListAllocator final
 		{
 		public:
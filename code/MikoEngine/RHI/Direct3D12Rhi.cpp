@@ -1186,7 +1186,7 @@ namespace Direct3D12Rhi
 		return nullptr;
 	}
 
-	Rhi::IComputePipelineState* Direct3D12Rhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
+	Rhi::IComputePipelineState* Direct3D12Rhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, const Rhi::PipelineStateBinary* pipelineStateBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
 	{
 		// Sanity checks
 		RHI_MATCH_CHECK(*this, rootSignature)
@@ -1196,7 +1196,7 @@ namespace Direct3D12Rhi
 		uint16_t id = 0;
 		if (ComputePipelineStateMakeId.CreateID(id))
 		{
-			return RHI_NEW(ComputePipelineState)(*this, rootSignature, computeShader, id RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(ComputePipelineState)(*this, rootSignature, computeShader, pipelineStateBinary, id RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 		// Error: Ensure a correct reference counter behaviour
@@ -1576,6 +1576,18 @@ namespace Direct3D12Rhi
 			::WideCharToMultiByte(CP_UTF8, 0, dxgiAdapterDesc.Description, static_cast<int>(wcslen(dxgiAdapterDesc.Description)), mCapabilities.deviceName, static_cast<int>(numberOfCharacters), nullptr, nullptr);
 			mCapabilities.deviceName[numberOfCharacters] = '\0';
 
+			{ // Pipeline state backend binary ID
+				// -> "ID3D12PipelineState::GetCachedBlob()" results are only valid for the same adapter and user mode driver version
+				LARGE_INTEGER userModeDriverVersion = {};
+				dxgiAdapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &userModeDriverVersion);
+				uint32_t pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dxgiAdapterDesc.VendorId), sizeof(UINT));
+				pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dxgiAdapterDesc.DeviceId), sizeof(UINT), pipelineStateBinaryId);
+				pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dxgiAdapterDesc.SubSysId), sizeof(UINT), pipelineStateBinaryId);
+				pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&dxgiAdapterDesc.Revision), sizeof(UINT), pipelineStateBinaryId);
+				pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&userModeDriverVersion.QuadPart), sizeof(LONGLONG), pipelineStateBinaryId);
+				mCapabilities.pipelineStateBinaryId = (0 != pipelineStateBinaryId) ? pipelineStateBinaryId : 1;
+			}
+
 			// Release references
 			dxgiAdapter->Release();
 		}
@@ -6555,7 +6555,18 @@ namespace Direct3D12Rhi
 			d3d12GraphicsPipelineState.DSVFormat = Mapping::getDirect3D12Format(graphicsPipelineState.depthStencilViewFormat);
 			d3d12GraphicsPipelineState.SampleDesc.Count = 1;
 
-			if ( SUCCEEDED(direct3D12Rhi.getD3D12Device().CreateGraphicsPipelineState(&d3d12GraphicsPipelineState, IID_PPV_ARGS(&mD3D12GraphicsPipelineState))) )
+			// Try the given backend binary first to skip the driver compilation, the driver rejects it e.g. after a driver update
+			const Rhi::PipelineStateBinary* pipelineStateBinary = graphicsPipelineState.pipelineStateBinary;
+			if ( nullptr != pipelineStateBinary && 0 != pipelineStateBinary->getNumberOfBytes() )
+			{
+				d3d12GraphicsPipelineState.CachedPSO = { pipelineStateBinary->getBinary(), pipelineStateBinary->getNumberOfBytes() };
+				if ( FAILED(direct3D12Rhi.getD3D12Device().CreateGraphicsPipelineState(&d3d12GraphicsPipelineState, IID_PPV_ARGS(&mD3D12GraphicsPipelineState))) )
+				{
+					d3d12GraphicsPipelineState.CachedPSO = {};
+					mD3D12GraphicsPipelineState = nullptr;
+				}
+			}
+			if ( nullptr != mD3D12GraphicsPipelineState || SUCCEEDED(direct3D12Rhi.getD3D12Device().CreateGraphicsPipelineState(&d3d12GraphicsPipelineState, IID_PPV_ARGS(&mD3D12GraphicsPipelineState))) )
 			{
 				// Assign a default name to the resource for debugging purposes
 #if SE_DEBUG
@@ -6615,6 +6626,16 @@ namespace Direct3D12Rhi
 		}
 
 
+		//[-------------------------------------------------------]
+		//[ Public virtual Rhi::IPipelineState methods            ]
+		//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual bool getPipelineStateBinary(Rhi::PipelineStateBinary& pipelineStateBinary) const override
+		{
+			return ::detail::getPipelineStateBinary(mD3D12GraphicsPipelineState, pipelineStateBinary);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Protected virtual RefCount methods               ]
 		//[-------------------------------------------------------]
@@ -6674,10 +6695,12 @@ namespace Direct3D12Rhi
 		*    Root signature shader to use
 		*  @param[in] computeShader
 		*    Compute shader to use
+		*  @param[in] pipelineStateBinary
+		*    Optional backend binary of a previous creation of the same compute pipeline state, can be a null pointer
 		*  @param[in] id
 		*    The unique compact compute pipeline state ID
 		*/
-		ComputePipelineState(Direct3D12Rhi& direct3D12Rhi, Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, uint16_t id RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		ComputePipelineState(Direct3D12Rhi& direct3D12Rhi, Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, const Rhi::PipelineStateBinary* pipelineStateBinary, uint16_t id RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IComputePipelineState(direct3D12Rhi, id RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mD3D12ComputePipelineState(nullptr),
 			mRootSignature(rootSignature),
@@ -6694,7 +6717,16 @@ namespace Direct3D12Rhi
 				ID3DBlob* d3dBlobComputeShader = static_cast<ComputeShaderHlsl&>(computeShader).getD3DBlobComputeShader();
 				d3d12ComputePipelineState.CS = { reinterpret_cast<UINT8*>(d3dBlobComputeShader->GetBufferPointer()), d3dBlobComputeShader->GetBufferSize() };
 			}
-			if ( SUCCEEDED(direct3D12Rhi.getD3D12Device().CreateComputePipelineState(&d3d12ComputePipelineState, IID_PPV_ARGS(&mD3D12ComputePipelineState))) )
+			if ( nullptr != pipelineStateBinary && 0 != pipelineStateBinary->getNumberOfBytes() )
+			{
+				d3d12ComputePipelineState.CachedPSO = { pipelineStateBinary->getBinary(), pipelineStateBinary->getNumberOfBytes() };
+				if ( FAILED(direct3D12Rhi.getD3D12Device().CreateComputePipelineState(&d3d12ComputePipelineState, IID_PPV_ARGS(&mD3D12ComputePipelineState))) )
+				{
+					d3d12ComputePipelineState.CachedPSO = {};
+					mD3D12ComputePipelineState = nullptr;
+				}
+			}
+			if ( nullptr != mD3D12ComputePipelineState || SUCCEEDED(direct3D12Rhi.getD3D12Device().CreateComputePipelineState(&d3d12ComputePipelineState, IID_PPV_ARGS(&mD3D12ComputePipelineState))) )
 			{
 				// Assign a default name to the resource for debugging purposes
 #if SE_DEBUG
@@ -6741,6 +6773,16 @@ namespace Direct3D12Rhi
 		}
 
 
+		//[-------------------------------------------------------]
+		//[ Public virtual Rhi::IPipelineState methods            ]
+		//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual bool getPipelineStateBinary(Rhi::PipelineStateBinary& pipelineStateBinary) const override
+		{
+			return ::detail::getPipelineStateBinary(mD3D12ComputePipelineState, pipelineStateBinary);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Protected virtual RefCount methods               ]
 		//[-------------------------------------------------------]
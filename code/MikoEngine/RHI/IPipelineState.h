@@ -27,6 +27,27 @@ namespace Rhi
 			return mId;
 		}
 
+		// Public virtual Rhi::IPipelineState methods
+	public:
+		/**
+		*  @brief
+		*    Return the backend binary of the pipeline state
+		*
+		*  @param[out] pipelineStateBinary
+		*    Receives the backend binary, cleared if there's none
+		*
+		*  @return
+		*    "true" if a backend binary has been returned, else "false" (e.g. the RHI doesn't support pipeline state backend binaries)
+		*
+		*  @note
+		*    - Pass the backend binary to the next creation of the same pipeline state to skip the driver compilation
+		*/
+		[[nodiscard]] inline virtual bool getPipelineStateBinary(PipelineStateBinary& pipelineStateBinary) const
+		{
+			pipelineStateBinary.clear();
+			return false;
+		}
+
 		// Protected methods
 	protected:
 		/**
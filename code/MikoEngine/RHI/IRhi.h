@@ -277,11 +277,13 @@ namespace Rhi
 		*    Root signature (compute pipeline state instances keep a reference to the root signature)
 		*  @param[in] computeShader
 		*    Compute shader used by the compute pipeline state (compute pipeline state instances keep a reference to the shader)
+		*  @param[in] pipelineStateBinary
+		*    Optional backend binary of a previous creation of the same compute pipeline state, can be a null pointer, the compute pipeline state keeps no reference
 		*
 		*  @return
 		*    The compute pipeline state instance, null pointer on error. Release the returned instance if you no longer need it.
 		*/
-		[[nodiscard]] virtual IComputePipelineState* createComputePipelineState(IRootSignature& rootSignature, IComputeShader& computeShader RHI_RESOURCE_DEBUG_NAME_PARAMETER) = 0;
+		[[nodiscard]] virtual IComputePipelineState* createComputePipelineState(IRootSignature& rootSignature, IComputeShader& computeShader, const PipelineStateBinary* pipelineStateBinary = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) = 0;
 
 		/**
 		*  @brief
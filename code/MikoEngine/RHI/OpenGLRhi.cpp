@@ -1982,7 +1982,7 @@ namespace OpenGLRhi
 		return nullptr;
 	}
 
-	Rhi::IComputePipelineState* OpenGLRhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
+	Rhi::IComputePipelineState* OpenGLRhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, [[maybe_unused]] const Rhi::PipelineStateBinary* pipelineStateBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
 	{
 		// Sanity checks
 		RHI_MATCH_CHECK(*this, rootSignature)
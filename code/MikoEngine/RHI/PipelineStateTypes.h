@@ -53,6 +53,53 @@ namespace Rhi
 		PATCH = 4      // Interpret the input primitive as a control point patch
 	};
 
+	/**
+	*  @brief
+	*    Backend binary of a pipeline state, e.g. Vulkan pipeline cache data or a Direct3D 12 cached blob
+	*
+	*  @remarks
+	*    Creating a pipeline state from its backend binary skips the expensive driver compilation. A backend binary is only valid
+	*    for the GPU and driver identified by "Rhi::Capabilities::pipelineStateBinaryId", the RHI falls back to the usual
+	*    compilation in case the driver rejects it anyway.
+	*/
+	class PipelineStateBinary final
+	{
+	public:
+		inline ~PipelineStateBinary()
+		{
+			delete[] mBinary;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfBytes() const
+		{
+			return mNumberOfBytes;
+		}
+
+		[[nodiscard]] inline const uint8_t* getBinary() const
+		{
+			return mBinary;
+		}
+
+		[[nodiscard]] inline uint8_t* allocateBinary(uint32_t numberOfBytes)
+		{
+			delete[] mBinary;
+			mNumberOfBytes = numberOfBytes;
+			mBinary = (0 != numberOfBytes) ? new uint8_t[numberOfBytes] : nullptr;
+			return mBinary;
+		}
+
+		inline void clear()
+		{
+			delete[] mBinary;
+			mNumberOfBytes = 0;
+			mBinary = nullptr;
+		}
+
+	private:
+		uint32_t mNumberOfBytes = 0; // Number of bytes in the binary
+		uint8_t *mBinary = nullptr; // Backend binary, can be a null pointer
+	};
+
 	struct SerializedGraphicsPipelineState
 	{
 		PrimitiveTopology	  primitiveTopology;          // Input-assembler (IA) stage: Primitive topology used for draw calls
@@ -70,6 +117,7 @@ namespace Rhi
 		IGraphicsProgram* graphicsProgram;  // Graphics program used by the graphics pipeline state (graphics pipeline state instances keep a reference to the graphics program), must be valid
 		VertexAttributes  vertexAttributes; // Vertex attributes, can be empty e.g. in case a task and mesh shader is used
 		IRenderPass*	  renderPass;       // Render pass, the graphics pipeline state keeps a reference, must be valid
+		const PipelineStateBinary* pipelineStateBinary; // Optional backend binary of a previous creation of the same graphics pipeline state, can be a null pointer, the graphics pipeline state keeps no reference
 	};
 	// TODO:    BlendState
 	struct GraphicsPipelineStateBuilder final : public GraphicsPipelineState
@@ -82,6 +130,7 @@ namespace Rhi
 			vertexAttributes.numberOfAttributes = 0;
 			vertexAttributes.attributes = nullptr;
 			renderPass = nullptr;
+			pipelineStateBinary = nullptr;
 
 			// "SerializedGraphicsPipelineState"-part
 			primitiveTopology = PrimitiveTopology::TRIANGLE_LIST;
@@ -107,6 +156,7 @@ namespace Rhi
 			rootSignature = _rootSignature;
 			graphicsProgram = _graphicsProgram;
 			renderPass = &_renderPass;
+			pipelineStateBinary = nullptr;
 
 			// "SerializedGraphicsPipelineState"-part
 			primitiveTopology = PrimitiveTopology::TRIANGLE_LIST;
@@ -133,6 +183,7 @@ namespace Rhi
 			graphicsProgram = _graphicsProgram;
 			vertexAttributes = _vertexAttributes;
 			renderPass = &_renderPass;
+			pipelineStateBinary = nullptr;
 
 			// "SerializedGraphicsPipelineState"-part
 			primitiveTopology = PrimitiveTopology::TRIANGLE_LIST;
@@ -44,6 +44,14 @@ namespace Rhi
 			memcpy(mBytecode, bytecode, mNumberOfBytes);
 		}
 
+		[[nodiscard]] inline uint8_t* allocateBytecode(uint32_t numberOfBytes)
+		{
+			delete[] mBytecode;
+			mNumberOfBytes = numberOfBytes;
+			mBytecode = (0 != numberOfBytes) ? new uint8_t[numberOfBytes] : nullptr;
+			return mBytecode;
+		}
+
 	private:
 		uint32_t mNumberOfBytes = 0; // Number of bytes in the bytecode
 		uint8_t *mBytecode = nullptr; // Shader bytecode, can be a null pointer
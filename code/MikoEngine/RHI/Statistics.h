@@ -174,6 +174,10 @@ namespace Rhi
 		std::atomic<uint32_t> numberOfCreatedMeshShaders = 0;		// Number of created mesh shader (MS) instances
 		std::atomic<uint32_t> currentNumberOfComputeShaders = 0;	// Current number of compute shader (CS) instances
 		std::atomic<uint32_t> numberOfCreatedComputeShaders = 0;	// Number of created compute shader (CS) instances
+		// Command buffer optimization, see "Rhi::CommandBuffer::optimize()"
+		std::atomic<uint32_t> numberOfOptimizedCommandBuffers = 0;	// Number of optimized command buffers
+		std::atomic<uint32_t> numberOfRemovedRedundantCommands = 0;	// Number of removed commands which would have set the already set state
+		std::atomic<uint32_t> numberOfMergedDrawCommands = 0;		// Number of indirect draw commands merged into a preceding multi-draw-indirect command
 
 	private:
 		explicit Statistics(const Statistics&) = delete;
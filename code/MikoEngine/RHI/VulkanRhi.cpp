@@ -847,7 +847,7 @@ namespace VulkanRhi
 		return nullptr;
 	}
 
-	Rhi::IComputePipelineState* VulkanRhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
+	Rhi::IComputePipelineState* VulkanRhi::createComputePipelineState(Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, const Rhi::PipelineStateBinary* pipelineStateBinary RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT)
 	{
 		// Sanity checks
 		RHI_MATCH_CHECK(*this, rootSignature)
@@ -857,7 +857,7 @@ namespace VulkanRhi
 		uint16_t id = 0;
 		if (ComputePipelineStateMakeId.CreateID(id))
 		{
-			return RHI_NEW(ComputePipelineState)(*this, rootSignature, computeShader, id RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(ComputePipelineState)(*this, rootSignature, computeShader, pipelineStateBinary, id RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 		// Error: Ensure a correct reference counter behaviour
@@ -1260,12 +1260,19 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	void VulkanRhi::initializeCapabilities()
 	{
-		{ // Get device name
+		{ // Get device name and pipeline state backend binary ID
 			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
 			vkGetPhysicalDeviceProperties(mVulkanContext->getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
 			const size_t numberOfCharacters = ::detail::countof(mCapabilities.deviceName) - 1;
 			strncpy(mCapabilities.deviceName, vkPhysicalDeviceProperties.deviceName, numberOfCharacters);
 			mCapabilities.deviceName[numberOfCharacters] = '\0';
+
+			// Vulkan pipeline cache data is only valid for the same vendor, device and pipeline cache UUID, the driver version is added to be on the safe side
+			uint32_t pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&vkPhysicalDeviceProperties.vendorID), sizeof(uint32_t));
+			pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&vkPhysicalDeviceProperties.deviceID), sizeof(uint32_t), pipelineStateBinaryId);
+			pipelineStateBinaryId = ::detail::calculateFNV1a32(reinterpret_cast<const uint8_t*>(&vkPhysicalDeviceProperties.driverVersion), sizeof(uint32_t), pipelineStateBinaryId);
+			pipelineStateBinaryId = ::detail::calculateFNV1a32(vkPhysicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE, pipelineStateBinaryId);
+			mCapabilities.pipelineStateBinaryId = (0 != pipelineStateBinaryId) ? pipelineStateBinaryId : 1;
 		}
 
 		// Preferred swap chain texture format
@@ -1258,6 +1258,48 @@ namespace VulkanRhi
 			}
 		}
 
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] static VkPipelineCache createVkPipelineCache(const VulkanRhi& vulkanRhi, const Rhi::PipelineStateBinary* pipelineStateBinary)
+		{
+			// The Vulkan implementation validates the initial data header (vendor, device and pipeline cache UUID) and ignores incompatible initial data
+			const bool hasInitialData = (nullptr != pipelineStateBinary && 0 != pipelineStateBinary->getNumberOfBytes());
+			const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,						// sType (VkStructureType)
+				nullptr,															// pNext (const void*)
+				0,																	// flags (VkPipelineCacheCreateFlags)
+				hasInitialData ? pipelineStateBinary->getNumberOfBytes() : 0u,		// initialDataSize (size_t)
+				hasInitialData ? pipelineStateBinary->getBinary() : nullptr			// pInitialData (const void*)
+			};
+			VkPipelineCache vkPipelineCache = VK_NULL_HANDLE;
+			if ( vkCreatePipelineCache(vulkanRhi.getVulkanContext().getVkDevice(), &vkPipelineCacheCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkPipelineCache) != VK_SUCCESS )
+			{
+				RHI_LOG(CRITICAL, "Failed to create Vulkan pipeline cache")
+				vkPipelineCache = VK_NULL_HANDLE;
+			}
+			return vkPipelineCache;
+		}
+
+		[[nodiscard]] static bool getPipelineStateBinary(const VulkanRhi& vulkanRhi, VkPipelineCache vkPipelineCache, Rhi::PipelineStateBinary& pipelineStateBinary)
+		{
+			if ( VK_NULL_HANDLE != vkPipelineCache )
+			{
+				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
+				size_t numberOfBytes = 0;
+				if ( vkGetPipelineCacheData(vkDevice, vkPipelineCache, &numberOfBytes, nullptr) == VK_SUCCESS && 0 != numberOfBytes && vkGetPipelineCacheData(vkDevice, vkPipelineCache, &numberOfBytes, pipelineStateBinary.allocateBinary(static_cast<uint32_t>(numberOfBytes))) == VK_SUCCESS )
+				{
+					// Done
+					return true;
+				}
+			}
+
+			// Error!
+			pipelineStateBinary.clear();
+			return false;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Debug                                                 ]
 		//[-------------------------------------------------------]
@@ -7182,6 +7224,7 @@ namespace VulkanRhi
 			mRootSignature(graphicsPipelineState.rootSignature),
 			mGraphicsProgram(graphicsPipelineState.graphicsProgram),
 			mRenderPass(graphicsPipelineState.renderPass),
+			mVkPipelineCache(VK_NULL_HANDLE),
 			mVkPipeline(VK_NULL_HANDLE)
 		{
 			// Add a reference to the referenced RHI resources
@@ -7432,7 +7475,10 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,														// basePipelineHandle (VkPipeline)
 				0																	// basePipelineIndex (int32_t)
 			};
-			if ( vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS )
+
+			// One Vulkan pipeline cache per pipeline so its data is exactly the backend binary of this pipeline, a given backend binary skips the driver compilation
+			mVkPipelineCache = Helper::createVkPipelineCache(vulkanRhi, graphicsPipelineState.pipelineStateBinary);
+			if ( vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipelineCache, 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS )
 			{
 				// Assign a default name to the resource for debugging purposes
 #if SE_DEBUG
@@ -7455,12 +7501,16 @@ namespace VulkanRhi
 		*/
 		virtual ~GraphicsPipelineState() override
 		{
-			// Destroy the Vulkan graphics pipeline
+			// Destroy the Vulkan graphics pipeline and pipeline cache
 			VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			if ( VK_NULL_HANDLE != mVkPipeline )
 			{
 				vkDestroyPipeline(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipeline, vulkanRhi.getVkAllocationCallbacks());
 			}
+			if ( VK_NULL_HANDLE != mVkPipelineCache )
+			{
+				vkDestroyPipelineCache(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipelineCache, vulkanRhi.getVkAllocationCallbacks());
+			}
 
 			// Release referenced RHI resources
 			mRootSignature->ReleaseReference();
@@ -7484,6 +7534,16 @@ namespace VulkanRhi
 		}
 
 
+		//[-------------------------------------------------------]
+		//[ Public virtual Rhi::IPipelineState methods            ]
+		//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual bool getPipelineStateBinary(Rhi::PipelineStateBinary& pipelineStateBinary) const override
+		{
+			return Helper::getPipelineStateBinary(static_cast<VulkanRhi&>(getRhi()), mVkPipelineCache, pipelineStateBinary);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Protected virtual RefCount methods               ]
 		//[-------------------------------------------------------]
@@ -7509,7 +7569,8 @@ namespace VulkanRhi
 		Rhi::IRootSignature*   mRootSignature;
 		Rhi::IGraphicsProgram* mGraphicsProgram;
 		Rhi::IRenderPass*	   mRenderPass;
-		VkPipeline			   mVkPipeline;	// The Vulkan graphics pipeline
+		VkPipelineCache		   mVkPipelineCache;	// The Vulkan pipeline cache holding the backend binary of the Vulkan graphics pipeline, can be "VK_NULL_HANDLE"
+		VkPipeline			   mVkPipeline;			// The Vulkan graphics pipeline
 
 
 	};
@@ -7542,13 +7603,16 @@ namespace VulkanRhi
 		*    Root signature to use
 		*  @param[in] computeShader
 		*    Compute shader to use
+		*  @param[in] pipelineStateBinary
+		*    Optional backend binary of a previous creation of the same compute pipeline state, can be a null pointer
 		*  @param[in] id
 		*    The unique compact compute pipeline state ID
 		*/
-		ComputePipelineState(VulkanRhi& vulkanRhi, Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, uint16_t id RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		ComputePipelineState(VulkanRhi& vulkanRhi, Rhi::IRootSignature& rootSignature, Rhi::IComputeShader& computeShader, const Rhi::PipelineStateBinary* pipelineStateBinary, uint16_t id RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IComputePipelineState(vulkanRhi, id RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
 			mComputeShader(computeShader),
+			mVkPipelineCache(VK_NULL_HANDLE),
 			mVkPipeline(VK_NULL_HANDLE)
 		{
 			// Add a reference to the given root signature and compute shader
@@ -7574,7 +7638,8 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,															// basePipelineHandle (VkPipeline)
 				0																		// basePipelineIndex (int32_t)
 			};
-			if ( vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS )
+			mVkPipelineCache = Helper::createVkPipelineCache(vulkanRhi, pipelineStateBinary);
+			if ( vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipelineCache, 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS )
 			{
 				// Assign a default name to the resource for debugging purposes
 #if SE_DEBUG
@@ -7597,12 +7662,16 @@ namespace VulkanRhi
 		*/
 		virtual ~ComputePipelineState() override
 		{
-			// Destroy the Vulkan compute pipeline
+			// Destroy the Vulkan compute pipeline and pipeline cache
 			VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			if ( VK_NULL_HANDLE != mVkPipeline )
 			{
 				vkDestroyPipeline(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipeline, vulkanRhi.getVkAllocationCallbacks());
 			}
+			if ( VK_NULL_HANDLE != mVkPipelineCache )
+			{
+				vkDestroyPipelineCache(vulkanRhi.getVulkanContext().getVkDevice(), mVkPipelineCache, vulkanRhi.getVkAllocationCallbacks());
+			}
 
 			// Release the root signature and compute shader reference
 			mRootSignature.ReleaseReference();
@@ -7625,6 +7694,16 @@ namespace VulkanRhi
 		}
 
 
+		//[-------------------------------------------------------]
+		//[ Public virtual Rhi::IPipelineState methods            ]
+		//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline virtual bool getPipelineStateBinary(Rhi::PipelineStateBinary& pipelineStateBinary) const override
+		{
+			return Helper::getPipelineStateBinary(static_cast<VulkanRhi&>(getRhi()), mVkPipelineCache, pipelineStateBinary);
+		}
+
+
 		//[-------------------------------------------------------]
 		//[ Protected virtual RefCount methods               ]
 		//[-------------------------------------------------------]
@@ -7649,6 +7728,7 @@ namespace VulkanRhi
 	private:
 		Rhi::IRootSignature& mRootSignature;
 		Rhi::IComputeShader& mComputeShader;
+		VkPipelineCache		 mVkPipelineCache;	// The Vulkan pipeline cache holding the backend binary of the Vulkan compute pipeline, can be "VK_NULL_HANDLE"
 		VkPipeline			 mVkPipeline;		// The Vulkan compute pipeline
 
 
@@ -8174,6 +8254,16 @@ namespace
 			return N;
 		}
 
+		[[nodiscard]] inline uint32_t calculateFNV1a32(const uint8_t* content, uint32_t numberOfBytes, uint32_t hash = 2166136261u)
+		{
+			// FNV-1a, 16777619 is the 32 bit FNV prime
+			for ( uint32_t i = 0; i < numberOfBytes; ++i )
+			{
+				hash = (hash ^ content[i]) * 16777619u;
+			}
+			return hash;
+		}
+
 		[[nodiscard]] VKAPI_ATTR void* VKAPI_CALL vkAllocationFunction(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope)
 		{
 			return DefaultAllocator::Reallocate(nullptr, size, alignment);
@@ -0,0 +1,181 @@
+#include "stdafx.h"
+#include "Renderer/Asset/AssetArchive.h"
+#include "Renderer/Asset/Loader/AssetPackageFileFormat.h"
+#include "Core/File/IFile.h"
+#include "Core/File/IFileManager.h"
+
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+SE_PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '__GNUC__' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+#include <lz4/lz4.h>
+SE_PRAGMA_WARNING_POP
+
+namespace
+{
+	namespace detail
+	{
+		class AssetArchiveFile final : public IFile
+		{
+		public:
+			typedef std::vector<uint8_t> ByteVector;
+
+			// Asset file which is a view into the asset archive
+			inline AssetArchiveFile(const uint8_t* data, size_t numberOfBytes, [[maybe_unused]] const std::string& debugFilename) :
+				mData(data),
+				mNumberOfBytes(numberOfBytes),
+				mCurrentPosition(0)
+#if SE_DEBUG
+				, mDebugFilename(debugFilename)
+#endif
+			{
+				// Nothing here
+			}
+
+			// Asset file which owns its data
+			inline AssetArchiveFile(ByteVector&& ownedData, [[maybe_unused]] const std::string& debugFilename) :
+				mOwnedData(std::move(ownedData)),
+				mData(mOwnedData.data()),
+				mNumberOfBytes(mOwnedData.size()),
+				mCurrentPosition(0)
+#if SE_DEBUG
+				, mDebugFilename(debugFilename)
+#endif
+			{
+				// Nothing here
+			}
+
+			inline virtual ~AssetArchiveFile() override
+			{
+				// Nothing here
+			}
+
+		public:
+			[[nodiscard]] inline virtual size_t getNumberOfBytes() override
+			{
+				return mNumberOfBytes;
+			}
+
+			inline virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+			{
+				SE_ASSERT(nullptr != destinationBuffer, "Letting a file read into a null destination buffer is not allowed")
+				SE_ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				memcpy(destinationBuffer, mData + mCurrentPosition, numberOfBytes);
+				mCurrentPosition += numberOfBytes;
+			}
+
+			inline virtual void skip(size_t numberOfBytes) override
+			{
+				SE_ASSERT(0 != numberOfBytes, "Letting a file skip zero bytes is not allowed")
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				mCurrentPosition += numberOfBytes;
+			}
+
+			[[nodiscard]] inline virtual const uint8_t* getView([[maybe_unused]] size_t numberOfBytes) override
+			{
+				SE_ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				return mData + mCurrentPosition;
+			}
+
+			inline virtual void write([[maybe_unused]] const void* sourceBuffer, [[maybe_unused]] size_t numberOfBytes) override
+			{
+				SE_ASSERT(false, "Asset archive files are read-only")
+			}
+
+#if SE_DEBUG
+			[[nodiscard]] inline virtual const char* getDebugFilename() const override
+			{
+				return mDebugFilename.c_str();
+			}
+#endif
+
+		protected:
+			explicit AssetArchiveFile(const AssetArchiveFile&) = delete;
+			AssetArchiveFile& operator=(const AssetArchiveFile&) = delete;
+
+		private:
+			ByteVector	   mOwnedData;	// Empty if the asset file is a view into the asset archive
+			const uint8_t* mData;		// Asset file data, doesn't own the data
+			size_t		   mNumberOfBytes;
+			size_t		   mCurrentPosition;
+#if SE_DEBUG
+			std::string mDebugFilename;	// Debug name for easier file identification when debugging
+#endif
+		};
+	} // detail
+}
+
+namespace Renderer
+{
+	AssetArchive::AssetArchive(const IFileManager& fileManager, VirtualFilename virtualFilename) :
+		mFileManager(fileManager),
+		mVirtualFilename(virtualFilename),
+		mArchiveFile(nullptr),
+		mArchiveData(nullptr)
+	{
+		// Open the archive file exactly once and keep it open for the whole lifetime, asset files are read in place from the file view
+		// -> Without file view support of the file manager the whole archive is read into memory once instead of reopening the archive file per asset
+		mArchiveFile = mFileManager.openFile(IFileManager::FileMode::READ, virtualFilename);
+		if ( nullptr != mArchiveFile )
+		{
+			const size_t numberOfBytes = mArchiveFile->getNumberOfBytes();
+			mArchiveData = mArchiveFile->getView(numberOfBytes);
+			if ( nullptr == mArchiveData )
+			{
+				mArchiveBuffer.resize(numberOfBytes);
+				if ( 0 != numberOfBytes )
+				{
+					mArchiveFile->read(mArchiveBuffer.data(), numberOfBytes);
+				}
+				mArchiveData = mArchiveBuffer.data();
+				mFileManager.closeFile(*mArchiveFile);
+				mArchiveFile = nullptr;
+			}
+		}
+	}
+
+	AssetArchive::~AssetArchive()
+	{
+		if ( nullptr != mArchiveFile )
+		{
+			mFileManager.closeFile(*mArchiveFile);
+		}
+	}
+
+	int64_t AssetArchive::getFileSize(uint32_t assetIndex) const
+	{
+		SE_ASSERT(assetIndex < mEntries.size(), "Invalid asset archive asset index")
+		return static_cast<int64_t>(mEntries[assetIndex].numberOfDecompressedBytes);
+	}
+
+	IFile* AssetArchive::openFile(uint32_t assetIndex) const
+	{
+		SE_ASSERT(assetIndex < mEntries.size(), "Invalid asset archive asset index")
+		const Entry& entry = mEntries[assetIndex];
+		const bool lz4Compressed = (0 != (entry.flags & v1AssetArchive::LZ4_COMPRESSED));
+
+		if ( nullptr == mArchiveData )
+		{
+			// Error! The archive file couldn't be opened.
+			return nullptr;
+		}
+		const uint8_t* payload = mArchiveData + entry.offset;
+
+		// Zero-copy if possible: The asset file is a view into the archive
+		if ( !lz4Compressed )
+		{
+			return new ::detail::AssetArchiveFile(payload, entry.numberOfBytes, mVirtualFilename);
+		}
+
+		// Decompress the asset payload
+		::detail::AssetArchiveFile::ByteVector decompressedData(entry.numberOfDecompressedBytes);
+		[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(payload), reinterpret_cast<char*>(decompressedData.data()), static_cast<int>(entry.numberOfBytes), static_cast<int>(entry.numberOfDecompressedBytes));
+		SE_ASSERT(entry.numberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
+		return new ::detail::AssetArchiveFile(std::move(decompressedData), mVirtualFilename);
+	}
+
+	void AssetArchive::closeFile(IFile& file) const
+	{
+		delete static_cast<::detail::AssetArchiveFile*>(&file);
+	}
+} // Renderer
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+class IFile;
+class IFileManager;
+
+namespace Renderer
+{
+	typedef const char* VirtualFilename;	// UTF-8 virtual filename, the virtual filename scheme is "<mount point = project name>/<asset directory>/<asset name>.<file extension>" (example "Example/Mesh/Monster/Squirrel.mesh"), never ever a null pointer and always finished by a terminating zero
+
+	/**
+	*  @brief
+	*    Asset archive, the asset files of an asset package stored inside one single file
+	*
+	*  @remarks
+	*    Opening tens of thousands of loose asset files costs as many "open()"/"stat()" system calls. The asset files of an asset archive
+	*    are slices of one single file instead. The archive is opened exactly once and stays mapped for its whole lifetime,
+	*    uncompressed asset files are read in place. This needs a file manager supporting file views (e.g. "PhysicsFSFileManager" for native
+	*    directories), else the whole archive is read into memory once.
+	*
+	*  @note
+	*    - The asset indices match the sorted asset vector of the owning asset package
+	*    - Asset files can be opened from multiple threads at the same time
+	*/
+	class AssetArchive final
+	{
+		friend class AssetPackageLoader;
+	public:
+		struct Entry final
+		{
+			uint64_t offset;					// Asset payload offset in bytes from the start of the archive
+			uint32_t numberOfBytes;				// Number of asset payload bytes inside the archive
+			uint32_t numberOfDecompressedBytes;	// Number of asset file bytes
+			uint32_t flags;						// "Renderer::v1AssetArchive::EntryFlags"
+		};
+		typedef std::vector<Entry> Entries;
+
+		AssetArchive(const IFileManager& fileManager, VirtualFilename virtualFilename);
+		~AssetArchive();
+
+		[[nodiscard]] inline const Entries& getEntries() const
+		{
+			return mEntries;
+		}
+
+		[[nodiscard]] int64_t getFileSize(uint32_t assetIndex) const;
+		[[nodiscard]] IFile* openFile(uint32_t assetIndex) const;
+		void closeFile(IFile& file) const;
+
+	private:
+		explicit AssetArchive(const AssetArchive&) = delete;
+		AssetArchive& operator=(const AssetArchive&) = delete;
+
+		const IFileManager& mFileManager;
+		std::string			mVirtualFilename;
+		Entries				mEntries;		// Filled by the asset package loader
+		IFile*				 mArchiveFile;	// Kept open as long as the asset archive exists if the file manager supports file views, else null pointer
+		std::vector<uint8_t> mArchiveBuffer;	// Whole archive read into memory if the file manager doesn't support file views, else empty
+		const uint8_t*		 mArchiveData;	// View onto the whole archive, null pointer if the archive couldn't be opened
+	};
+} // Renderer
\ No newline at end of file
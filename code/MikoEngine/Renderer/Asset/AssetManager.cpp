@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "Renderer/Asset/AssetManager.h"
 #include "Renderer/Asset/AssetPackage.h"
+#include "Renderer/Asset/AssetArchive.h"
 #include "Renderer/Asset/Loader/AssetPackageLoader.h"
 #include "Core/File/IFileManager.h"
 #include "Core/File/FileSystemHelper.h"
@@ -17,12 +18,14 @@ namespace Renderer
 			delete mAssetPackageVector[i];
 		}
 		mAssetPackageVector.clear();
+		mAssetLookupTable.clear();
 	}
 
 	AssetPackage& AssetManager::addAssetPackage(AssetPackageId assetPackageId)
 	{
 		SE_ASSERT(nullptr == tryGetAssetPackageById(assetPackageId), "Renderer asset package ID is already used")
 			AssetPackage* assetPackage = new AssetPackage(assetPackageId);
+		assetPackage->mAssetManager = this;
 		mAssetPackageVector.push_back(assetPackage);
 		return *assetPackage;
 	}
@@ -33,8 +36,14 @@ namespace Renderer
 		if ( mRenderer.getFileManager().mountDirectory(absoluteDirectoryName, projectName) )
 		{
 			// Generate the asset package ID using the naming scheme "<project name>/<asset package name>" and load the asset package
+			// -> An asset archive is preferred over loose asset files, if there's one
 			const std::string assetPackageName = std_filesystem::path(absoluteDirectoryName).stem().generic_string();
 			const std::string projectNameWithSlash = std::string(projectName) + '/';
+			const std::string archiveVirtualFilename = projectNameWithSlash + assetPackageName + ".archive";
+			if ( mRenderer.getFileManager().doesFileExist(archiveVirtualFilename.c_str()) )
+			{
+				return addAssetPackageByArchiveVirtualFilename(StringId((projectNameWithSlash + assetPackageName).c_str()), archiveVirtualFilename.c_str());
+			}
 			return addAssetPackageByVirtualFilename(StringId((projectNameWithSlash + assetPackageName).c_str()), (projectNameWithSlash + assetPackageName + ".assets").c_str());
 		}
 		else
@@ -70,18 +79,27 @@ namespace Renderer
 		SE_ASSERT(iterator != mAssetPackageVector.cend(), "Unknown renderer asset package ID")
 			delete *iterator;
 		mAssetPackageVector.erase(iterator);
+		rebuildAssetLookupTable();
 	}
 
 	const Asset* AssetManager::tryGetAssetByAssetId(AssetId assetId) const
 	{
-		// Search inside all mounted asset packages, later added asset packages cover old ones
-		const size_t numberOfAssetPackages = mAssetPackageVector.size();
-		for ( size_t i = 0; i < numberOfAssetPackages; ++i )
+		// Search inside the asset lookup table merging all mounted asset packages, asset IDs are already hashes so no further hashing is needed
+		// -> The load factor is at most 0.5, so there's always an empty slot terminating the probing
+		if ( !mAssetLookupTable.empty() )
 		{
-			const Asset* asset = mAssetPackageVector[i]->tryGetAssetByAssetId(assetId);
-			if ( nullptr != asset )
+			const uint32_t mask = static_cast<uint32_t>(mAssetLookupTable.size() - 1);
+			for ( uint32_t index = (static_cast<uint32_t>(assetId) & mask); ; index = ((index + 1) & mask) )
 			{
-				return asset;
+				const AssetLookupEntry& assetLookupEntry = mAssetLookupTable[index];
+				if ( assetLookupEntry.assetId == assetId )
+				{
+					return assetLookupEntry.asset;
+				}
+				if ( nullptr == assetLookupEntry.asset )
+				{
+					break;
+				}
 			}
 		}
 
@@ -89,6 +107,40 @@ namespace Renderer
 		return nullptr;
 	}
 
+	int64_t AssetManager::getAssetFileSize(const Asset& asset) const
+	{
+		uint32_t assetIndex = 0;
+		const AssetArchive* assetArchive = tryGetAssetArchiveByAsset(asset, assetIndex);
+		return (nullptr != assetArchive) ? assetArchive->getFileSize(assetIndex) : mRenderer.getFileManager().getFileSize(asset.virtualFilename);
+	}
+
+	IFile* AssetManager::openAssetFile(const Asset& asset) const
+	{
+		uint32_t assetIndex = 0;
+		const AssetArchive* assetArchive = tryGetAssetArchiveByAsset(asset, assetIndex);
+		return (nullptr != assetArchive) ? assetArchive->openFile(assetIndex) : mRenderer.getFileManager().openFile(IFileManager::FileMode::READ, asset.virtualFilename);
+	}
+
+	void AssetManager::closeAssetFile(const Asset& asset, IFile& file) const
+	{
+		uint32_t assetIndex = 0;
+		const AssetArchive* assetArchive = tryGetAssetArchiveByAsset(asset, assetIndex);
+		if ( nullptr != assetArchive )
+		{
+			assetArchive->closeFile(file);
+		}
+		else
+		{
+			mRenderer.getFileManager().closeFile(file);
+		}
+	}
+
+	std::string AssetManager::mapAssetToAbsoluteFilename(const Asset& asset) const
+	{
+		uint32_t assetIndex = 0;
+		return (nullptr != tryGetAssetArchiveByAsset(asset, assetIndex)) ? std::string() : mRenderer.getFileManager().mapVirtualToAbsoluteFilename(IFileManager::FileMode::READ, asset.virtualFilename);
+	}
+
 	AssetPackage* AssetManager::addAssetPackageByVirtualFilename(AssetPackageId assetPackageId, VirtualFilename virtualFilename)
 	{
 		SE_ASSERT(nullptr == tryGetAssetPackageById(assetPackageId), "Renderer asset package ID is already used")
@@ -97,8 +149,10 @@ namespace Renderer
 		if ( nullptr != file )
 		{
 			AssetPackage* assetPackage = new AssetPackage(assetPackageId);
+			assetPackage->mAssetManager = this;
 			AssetPackageLoader().loadAssetPackage(*assetPackage, *file);
 			mAssetPackageVector.push_back(assetPackage);
+			rebuildAssetLookupTable();
 			fileManager.closeFile(*file);
 
 			// Done
@@ -111,4 +165,87 @@ namespace Renderer
 				return nullptr;
 		}
 	}
+
+	AssetPackage* AssetManager::addAssetPackageByArchiveVirtualFilename(AssetPackageId assetPackageId, VirtualFilename virtualFilename)
+	{
+		SE_ASSERT(nullptr == tryGetAssetPackageById(assetPackageId), "Renderer asset package ID is already used")
+		IFileManager& fileManager = mRenderer.getFileManager();
+		IFile* file = fileManager.openFile(IFileManager::FileMode::READ, virtualFilename);
+		if ( nullptr != file )
+		{
+			AssetPackage* assetPackage = new AssetPackage(assetPackageId);
+			assetPackage->mAssetManager = this;
+			assetPackage->mAssetArchive = new AssetArchive(fileManager, virtualFilename);
+			AssetPackageLoader().loadAssetArchive(*assetPackage, *assetPackage->mAssetArchive, *file);
+			mAssetPackageVector.push_back(assetPackage);
+			rebuildAssetLookupTable();
+			fileManager.closeFile(*file);
+
+			// Done
+			return assetPackage;
+		}
+		else
+		{
+			// Error! This is horrible. No assets.
+			SE_ASSERT(false, "Renderer failed to add asset archive")
+			return nullptr;
+		}
+	}
+
+	const AssetArchive* AssetManager::tryGetAssetArchiveByAsset(const Asset& asset, uint32_t& assetIndex) const
+	{
+		// Assets are referenced by pointers into the sorted asset vector of their asset package, so the asset address tells the asset package
+		for ( const AssetPackage* assetPackage : mAssetPackageVector )
+		{
+			const AssetArchive* assetArchive = assetPackage->getAssetArchive();
+			if ( nullptr != assetArchive )
+			{
+				const AssetPackage::SortedAssetVector& sortedAssetVector = assetPackage->getSortedAssetVector();
+				if ( &asset >= sortedAssetVector.data() && &asset < sortedAssetVector.data() + sortedAssetVector.size() )
+				{
+					assetIndex = static_cast<uint32_t>(&asset - sortedAssetVector.data());
+					return assetArchive;
+				}
+			}
+		}
+
+		// The asset is a loose file
+		return nullptr;
+	}
+
+	void AssetManager::rebuildAssetLookupTable()
+	{
+		// Get the number of slots: Power of two and a load factor of at most 0.5
+		size_t numberOfAssets = 0;
+		for ( const AssetPackage* assetPackage : mAssetPackageVector )
+		{
+			numberOfAssets += assetPackage->getSortedAssetVector().size();
+		}
+		size_t numberOfSlots = 16;
+		while ( numberOfSlots < numberOfAssets * 2 )
+		{
+			numberOfSlots *= 2;
+		}
+
+		// Fill the asset lookup table, asset packages are searched in the order they were added and the first one providing an asset ID wins
+		mAssetLookupTable.assign(numberOfSlots, AssetLookupEntry{ GetInvalid<AssetId>(), nullptr });
+		const uint32_t mask = static_cast<uint32_t>(numberOfSlots - 1);
+		for ( const AssetPackage* assetPackage : mAssetPackageVector )
+		{
+			for ( const Asset& asset : assetPackage->getSortedAssetVector() )
+			{
+				uint32_t index = (static_cast<uint32_t>(asset.assetId) & mask);
+				while ( nullptr != mAssetLookupTable[index].asset && mAssetLookupTable[index].assetId != asset.assetId )
+				{
+					index = ((index + 1) & mask);
+				}
+				AssetLookupEntry& assetLookupEntry = mAssetLookupTable[index];
+				if ( nullptr == assetLookupEntry.asset )
+				{
+					assetLookupEntry.assetId = asset.assetId;
+					assetLookupEntry.asset = &asset;
+				}
+			}
+		}
+	}
 } // Renderer
\ No newline at end of file
@@ -2,9 +2,11 @@
 
 #include "Renderer/Asset/Asset.h"
 
+class IFile;
 namespace Renderer
 {
 	class AssetPackage;
+	class AssetArchive;
 	class IRenderer;
 }
 
@@ -17,6 +19,7 @@ namespace Renderer
 	class AssetManager final
 	{
 		friend class RendererImpl;
+		friend class AssetPackage;	// Asks for an asset lookup table rebuild if its assets changed
 	public:
 		typedef std::vector<AssetPackage*> AssetPackageVector;
 
@@ -48,6 +51,23 @@ namespace Renderer
 			return (nullptr != asset) ? asset->virtualFilename : nullptr;
 		}
 
+		//[-------------------------------------------------------]
+		//[ Asset file                                            ]
+		//[-------------------------------------------------------]
+		// Asset files have to be accessed through the asset manager instead of the file manager, they might be stored inside an asset archive
+		[[nodiscard]] int64_t getAssetFileSize(const Asset& asset) const;
+		[[nodiscard]] IFile* openAssetFile(const Asset& asset) const;
+		void closeAssetFile(const Asset& asset, IFile& file) const;
+		[[nodiscard]] std::string mapAssetToAbsoluteFilename(const Asset& asset) const;	// Empty string if the asset file isn't a loose file, e.g. because it's stored inside an asset archive
+
+	private:
+		struct AssetLookupEntry final
+		{
+			AssetId		 assetId;
+			const Asset* asset;	// Null pointer for an empty slot
+		};
+		typedef std::vector<AssetLookupEntry> AssetLookupTable;
+
 	private:
 		inline explicit AssetManager(IRenderer& renderer) :
 			mRenderer(renderer)
@@ -64,8 +84,12 @@ namespace Renderer
 		AssetManager& operator=(const AssetManager&) = delete;
 
 		[[nodiscard]] AssetPackage* addAssetPackageByVirtualFilename(AssetPackageId assetPackageId, VirtualFilename virtualFilename);
+		[[nodiscard]] AssetPackage* addAssetPackageByArchiveVirtualFilename(AssetPackageId assetPackageId, VirtualFilename virtualFilename);
+		[[nodiscard]] const AssetArchive* tryGetAssetArchiveByAsset(const Asset& asset, uint32_t& assetIndex) const;
+		void rebuildAssetLookupTable();
 
 		IRenderer&		   mRenderer;	// Renderer instance, do not destroy the instance
 		AssetPackageVector mAssetPackageVector;
+		AssetLookupTable   mAssetLookupTable;	// Open addressing hash table with linear probing merging the assets of all asset packages, the number of slots is a power of two and at least twice the number of assets
 	};
 } // Renderer
\ No newline at end of file
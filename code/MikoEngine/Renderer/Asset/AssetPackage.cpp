@@ -1,5 +1,7 @@
 #include "stdafx.h"
 #include "Renderer/Asset/AssetPackage.h"
+#include "Renderer/Asset/AssetArchive.h"
+#include "Renderer/Asset/AssetManager.h"
 #include "Math/Math.h"
 #include "Renderer/Context.h"
 
@@ -24,14 +26,51 @@ namespace
 
 namespace Renderer
 {
+	AssetPackage::~AssetPackage()
+	{
+		delete mAssetArchive;
+		for ( char* stringPoolBlock : mStringPoolBlocks )
+		{
+			delete [] stringPoolBlock;
+		}
+	}
+
+	void AssetPackage::clear()
+	{
+		mSortedAssetVector.clear();
+		for ( char* stringPoolBlock : mStringPoolBlocks )
+		{
+			delete [] stringPoolBlock;
+		}
+		mStringPoolBlocks.clear();
+		mNumberOfUsedStringPoolBlockBytes = 0;
+		onAssetsChanged();
+	}
+
 	void AssetPackage::addAsset([[maybe_unused]] const Context& context, AssetId assetId, VirtualFilename virtualFilename)
 	{
 		SE_ASSERT(nullptr == tryGetAssetByAssetId(assetId), "Renderer asset ID is already used");
-		SE_ASSERT(strlen(virtualFilename) < Asset::MAXIMUM_ASSET_FILENAME_LENGTH, "The renderer asset filename is too long");
 		SortedAssetVector::const_iterator iterator = std::lower_bound(mSortedAssetVector.cbegin(), mSortedAssetVector.cend(), assetId, ::detail::OrderByAssetId());
 		Asset& asset = *mSortedAssetVector.insert(iterator, Asset());
 		asset.assetId = assetId;
-		strncpy(asset.virtualFilename, virtualFilename, Asset::MAXIMUM_ASSET_FILENAME_LENGTH - 1);	// -1 not including the terminating zero
+		asset.virtualFilename = addVirtualFilenameToStringPool(virtualFilename);
+		onAssetsChanged();
+	}
+
+	void AssetPackage::beginAssetBatch()
+	{
+		++mAssetBatchDepth;
+	}
+
+	void AssetPackage::endAssetBatch()
+	{
+		SE_ASSERT(mAssetBatchDepth > 0, "Renderer asset package batch end without begin")
+		--mAssetBatchDepth;
+		if ( 0 == mAssetBatchDepth && mAssetsChangedInsideBatch )
+		{
+			mAssetsChangedInsideBatch = false;
+			onAssetsChanged();
+		}
 	}
 
 	const Asset* AssetPackage::tryGetAssetByAssetId(AssetId assetId) const
@@ -60,4 +99,35 @@ namespace Renderer
 		SortedAssetVector::iterator iterator = std::lower_bound(mSortedAssetVector.begin(), mSortedAssetVector.end(), assetId, ::detail::OrderByAssetId());
 		return (iterator != mSortedAssetVector.cend() && iterator->assetId == assetId) ? &(*iterator) : nullptr;
 	}
+
+	VirtualFilename AssetPackage::addVirtualFilenameToStringPool(VirtualFilename virtualFilename)
+	{
+		const uint32_t numberOfBytes = static_cast<uint32_t>(strlen(virtualFilename)) + 1;	// +1 for the terminating zero
+		SE_ASSERT(numberOfBytes <= Asset::MAXIMUM_ASSET_FILENAME_LENGTH, "The renderer asset filename is too long")
+
+		// Strings never move once they are inside the pool, so start a new block if the current one is full
+		if ( mStringPoolBlocks.empty() || mNumberOfUsedStringPoolBlockBytes + numberOfBytes > STRING_POOL_BLOCK_SIZE )
+		{
+			mStringPoolBlocks.push_back(new char[STRING_POOL_BLOCK_SIZE]);
+			mNumberOfUsedStringPoolBlockBytes = 0;
+		}
+		char* pooledVirtualFilename = mStringPoolBlocks.back() + mNumberOfUsedStringPoolBlockBytes;
+		memcpy(pooledVirtualFilename, virtualFilename, numberOfBytes);
+		mNumberOfUsedStringPoolBlockBytes += numberOfBytes;
+		return pooledVirtualFilename;
+	}
+
+	void AssetPackage::onAssetsChanged()
+	{
+		// The asset lookup table of the asset manager references the assets, which might have been moved by the change
+		// -> Inside an asset batch the rebuild is postponed to the end of the batch
+		if ( 0 != mAssetBatchDepth )
+		{
+			mAssetsChangedInsideBatch = true;
+		}
+		else if ( nullptr != mAssetManager )
+		{
+			mAssetManager->rebuildAssetLookupTable();
+		}
+	}
 } // Renderer
\ No newline at end of file
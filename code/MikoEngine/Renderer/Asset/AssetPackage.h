@@ -8,6 +8,8 @@ class IFileManager;
 namespace Renderer
 {
 	class Context;
+	class AssetArchive;
+	class AssetManager;
 }
 
 namespace Renderer
@@ -21,34 +23,54 @@ namespace Renderer
 	public:
 		typedef std::vector<Asset> SortedAssetVector;
 
+		static constexpr uint32_t STRING_POOL_BLOCK_SIZE = 64 * 1024;	// Number of bytes per string pool block, must be at least "Renderer::Asset::MAXIMUM_ASSET_FILENAME_LENGTH"
+
 		inline AssetPackage() :
-			mAssetPackageId(GetInvalid<AssetPackageId>())
+			mAssetPackageId(GetInvalid<AssetPackageId>()),
+			mAssetArchive(nullptr),
+			mAssetManager(nullptr),
+			mNumberOfUsedStringPoolBlockBytes(0),
+			mAssetBatchDepth(0),
+			mAssetsChangedInsideBatch(false)
 		{
 			// Nothing here
 		}
 
 		inline explicit AssetPackage(AssetPackageId assetPackageId) :
-			mAssetPackageId(assetPackageId)
+			mAssetPackageId(assetPackageId),
+			mAssetArchive(nullptr),
+			mAssetManager(nullptr),
+			mNumberOfUsedStringPoolBlockBytes(0),
+			mAssetBatchDepth(0),
+			mAssetsChangedInsideBatch(false)
 		{
 			// Nothing here
 		}
 
+		~AssetPackage();
+
 		[[nodiscard]] inline AssetPackageId getAssetPackageId() const
 		{
 			return mAssetPackageId;
 		}
 
-		inline void clear()
-		{
-			mSortedAssetVector.clear();
-		}
+		void clear();
 
 		[[nodiscard]] inline const SortedAssetVector& getSortedAssetVector() const
 		{
 			return mSortedAssetVector;
 		}
 
+		[[nodiscard]] inline const AssetArchive* getAssetArchive() const
+		{
+			return mAssetArchive;
+		}
+
 		void addAsset(const Context& context, AssetId assetId, VirtualFilename virtualFilename);
+
+		// Adding many assets between "beginAssetBatch()" and "endAssetBatch()" rebuilds the asset lookup table of the asset manager only once at the end of the outermost batch instead of after each asset
+		void beginAssetBatch();
+		void endAssetBatch();
 		[[nodiscard]] const Asset* tryGetAssetByAssetId(AssetId assetId) const;
 
 		[[nodiscard]] inline VirtualFilename tryGetVirtualFilenameByAssetId(AssetId assetId) const
@@ -65,12 +87,22 @@ namespace Renderer
 			return mSortedAssetVector;
 		}
 		[[nodiscard]] Asset* tryGetWritableAssetByAssetId(AssetId assetId);
+		[[nodiscard]] VirtualFilename addVirtualFilenameToStringPool(VirtualFilename virtualFilename);
 
 	private:
+		typedef std::vector<char*> StringPoolBlocks;
+
 		explicit AssetPackage(const AssetPackage&) = delete;
 		AssetPackage& operator=(const AssetPackage&) = delete;
+		void onAssetsChanged();
 
 		AssetPackageId	  mAssetPackageId;
 		SortedAssetVector mSortedAssetVector;	// Sorted vector of assets
+		AssetArchive*	  mAssetArchive;		// Asset archive the asset files are stored in, null pointer if the asset files are loose files, destroy the instance if you no longer need it
+		AssetManager*	  mAssetManager;		// Asset manager the asset package is registered at and which needs to know about changed assets, can be a null pointer, don't destroy the instance
+		StringPoolBlocks  mStringPoolBlocks;	// Virtual filenames of the assets, strings never move once they are inside the pool, destroy the blocks if you no longer need them
+		uint32_t		  mNumberOfUsedStringPoolBlockBytes;	// Number of used bytes inside the last string pool block
+		uint32_t		  mAssetBatchDepth;				// Number of nested asset batches, see "beginAssetBatch()"
+		bool			  mAssetsChangedInsideBatch;	// "true" if assets were changed inside the current asset batch and the asset lookup table needs to be rebuilt at its end
 	};
 } // Renderer
\ No newline at end of file
@@ -1,18 +1,26 @@
 #pragma once
 
-#include "Utility/StringId.h"
+#include "Renderer/Asset/Asset.h"
 
 namespace Renderer
 {
 	// Asset package file format content:
 	// - File format header
 	// - Asset package header
-	// - Assets
+	// - Serialized assets
 	namespace v1AssetPackage
 	{
 		static constexpr uint32_t FORMAT_TYPE = SE_STRING_ID("AssetPackage");
 		static constexpr uint32_t FORMAT_VERSION = 3;
 
+		// Not packed by intent, the serialized asset layout must stay the same as it has always been
+		struct SerializedAsset final
+		{
+			AssetId  assetId;
+			uint64_t fileHash;
+			char	 virtualFilename[Asset::MAXIMUM_ASSET_FILENAME_LENGTH];	// Including terminating zero
+		};
+
 #pragma pack(push)
 #pragma pack(1)
 		struct AssetPackageHeader final
@@ -21,4 +29,40 @@ namespace Renderer
 		};
 #pragma pack(pop)
 	} // v1AssetPackage
+
+	// Asset archive file format content, a whole asset package inside one single file:
+	// - Archive header
+	// - Archive entries, sorted by asset ID
+	// - Asset payloads, each one starting at an aligned offset
+	// -> Not LZ4 compressed as a whole since the asset payloads are accessed in place, compression is chosen per asset
+	namespace v1AssetArchive
+	{
+		static constexpr uint32_t FORMAT_TYPE = SE_STRING_ID("AssetArchive");
+		static constexpr uint32_t FORMAT_VERSION = 1;
+		static constexpr uint64_t PAYLOAD_ALIGNMENT = 4096;	// Asset payload alignment in bytes, matches the usual memory page and disk sector size
+
+		enum EntryFlags : uint32_t
+		{
+			LZ4_COMPRESSED = 1 << 0	// The asset payload is LZ4 compressed as a whole and gets decompressed when the asset file is opened
+		};
+
+#pragma pack(push)
+#pragma pack(1)
+		struct ArchiveHeader final
+		{
+			uint32_t formatType;
+			uint32_t formatVersion;
+			uint32_t numberOfAssets;
+		};
+
+		struct ArchiveEntry final
+		{
+			v1AssetPackage::SerializedAsset asset;
+			uint64_t						offset;						// Asset payload offset in bytes from the start of the archive, multiple of "PAYLOAD_ALIGNMENT"
+			uint32_t						numberOfBytes;				// Number of asset payload bytes inside the archive
+			uint32_t						numberOfDecompressedBytes;	// Number of asset file bytes, equal to "numberOfBytes" if the asset payload isn't compressed
+			uint32_t						flags;						// "Renderer::v1AssetArchive::EntryFlags"
+		};
+#pragma pack(pop)
+	} // v1AssetArchive
 } // Renderer
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Renderer/Asset/Loader/AssetPackageLoader.h"
 #include "Renderer/Asset/Loader/AssetPackageFileFormat.h"
 #include "Renderer/Asset/AssetPackage.h"
+#include "Renderer/Asset/AssetArchive.h"
 #include "Core/File/MemoryFile.h"
 
 namespace Renderer
@@ -22,9 +23,62 @@ namespace Renderer
 			SE_ASSERT(assetPackageHeader.numberOfAssets > 0, "Invalid empty asset package detected");
 
 			// Read in the asset package content in one single burst
+			std::vector<v1AssetPackage::SerializedAsset> serializedAssets(assetPackageHeader.numberOfAssets);
+			memoryFile.read(serializedAssets.data(), sizeof(v1AssetPackage::SerializedAsset) * assetPackageHeader.numberOfAssets);
+
+			// The virtual filenames go into the string pool of the asset package
 			AssetPackage::SortedAssetVector& sortedAssetVector = assetPackage.getWritableSortedAssetVector();
 			sortedAssetVector.resize(assetPackageHeader.numberOfAssets);
-			memoryFile.read(sortedAssetVector.data(), sizeof(Asset) * assetPackageHeader.numberOfAssets);
+			for ( uint32_t i = 0; i < assetPackageHeader.numberOfAssets; ++i )
+			{
+				const v1AssetPackage::SerializedAsset& serializedAsset = serializedAssets[i];
+				Asset& asset = sortedAssetVector[i];
+				asset.assetId		  = serializedAsset.assetId;
+				asset.fileHash		  = serializedAsset.fileHash;
+				asset.virtualFilename = assetPackage.addVirtualFilenameToStringPool(serializedAsset.virtualFilename);
+			}
+		}
+	}
+
+	void AssetPackageLoader::loadAssetArchive(AssetPackage& assetPackage, AssetArchive& assetArchive, IFile& file)
+	{
+		// Read in the archive header, the archive isn't LZ4 compressed as a whole so there's no file format header
+		v1AssetArchive::ArchiveHeader archiveHeader;
+		file.read(&archiveHeader, sizeof(v1AssetArchive::ArchiveHeader));
+		if ( v1AssetArchive::FORMAT_TYPE == archiveHeader.formatType && v1AssetArchive::FORMAT_VERSION == archiveHeader.formatVersion )
+		{
+			// Sanity check
+			SE_ASSERT(archiveHeader.numberOfAssets > 0, "Invalid empty asset archive detected")
+
+			// Read in the archive entries in one single burst
+			std::vector<v1AssetArchive::ArchiveEntry> archiveEntries(archiveHeader.numberOfAssets);
+			file.read(archiveEntries.data(), sizeof(v1AssetArchive::ArchiveEntry) * archiveHeader.numberOfAssets);
+
+			// Split the archive entries into the sorted asset vector and the asset archive entries, both share the same order
+			AssetPackage::SortedAssetVector& sortedAssetVector = assetPackage.getWritableSortedAssetVector();
+			AssetArchive::Entries& entries = assetArchive.mEntries;
+			sortedAssetVector.resize(archiveHeader.numberOfAssets);
+			entries.resize(archiveHeader.numberOfAssets);
+			for ( uint32_t i = 0; i < archiveHeader.numberOfAssets; ++i )
+			{
+				const v1AssetArchive::ArchiveEntry& archiveEntry = archiveEntries[i];
+				SE_ASSERT(0 == i || archiveEntries[i - 1].asset.assetId < archiveEntry.asset.assetId, "The asset archive entries must be sorted by asset ID")
+				SE_ASSERT(0 == (archiveEntry.offset % v1AssetArchive::PAYLOAD_ALIGNMENT), "Invalid asset archive payload alignment")
+				Asset& asset = sortedAssetVector[i];
+				asset.assetId		  = archiveEntry.asset.assetId;
+				asset.fileHash		  = archiveEntry.asset.fileHash;
+				asset.virtualFilename = assetPackage.addVirtualFilenameToStringPool(archiveEntry.asset.virtualFilename);
+				AssetArchive::Entry& entry = entries[i];
+				entry.offset					= archiveEntry.offset;
+				entry.numberOfBytes				= archiveEntry.numberOfBytes;
+				entry.numberOfDecompressedBytes = archiveEntry.numberOfDecompressedBytes;
+				entry.flags						= archiveEntry.flags;
+			}
+		}
+		else
+		{
+			// Error!
+			SE_ASSERT(false, "Invalid asset archive header")
 		}
 	}
 } // Renderer
\ No newline at end of file
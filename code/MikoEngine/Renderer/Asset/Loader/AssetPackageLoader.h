@@ -5,6 +5,7 @@ class IFile;
 namespace Renderer
 {
 	class AssetPackage;
+	class AssetArchive;
 }
 
 namespace Renderer
@@ -20,5 +21,6 @@ namespace Renderer
 		AssetPackageLoader& operator=(const AssetPackageLoader&) = delete;
 
 		void loadAssetPackage(AssetPackage& assetPackage, IFile& file);
+		void loadAssetArchive(AssetPackage& assetPackage, AssetArchive& assetArchive, IFile& file);
 	};
 } // Renderer
\ No newline at end of file
@@ -8,32 +8,47 @@ namespace Renderer
 	*  @brief
 	*    Packed element manager template
 	*
+	*  @remarks
+	*    The elements are stored densely packed, iterating by index visits all elements without gaps. Removing an element moves the last
+	*    element into the freed place. The element and slot storages grow by chunks of "NUMBER_OF_ELEMENTS_PER_CHUNK" elements which are
+	*    referenced by fixed capacity chunk directories allocated up-front for the maximum number of elements. So growing never moves memory
+	*    other threads might read at the same time and memory is only spent for chunks which are really used. An ID consists of a slot index inside the lower bits and a
+	*    generation counter inside the upper bits, the generation counter is increased each time a slot is reused so stale IDs are detected.
+	*
 	*  @note
 	*    - Basing on "Managing Decoupling Part 4 -- The ID Lookup Table" https://github.com/niklasfrykholm/blog/blob/master/2011/managing-decoupling-4.md by Niklas Frykholm ( http://www.frykholm.se/ )
+	*    - Free slots are reused in first-in-first-out order to make it unlikely that a stale ID gets valid again
 	*/
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS>
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK>
 	class PackedElementManager final
 	{
 	public:
 		inline PackedElementManager() :
 			mNumberOfElements(0),
-			mFreeListEnqueue(MAXIMUM_NUMBER_OF_ELEMENTS - 1),
-			mFreeListDequeue(0)
+			mElementChunks(new ELEMENT_TYPE*[MAXIMUM_NUMBER_OF_CHUNKS]),
+			mSlotChunks(new Slot*[MAXIMUM_NUMBER_OF_CHUNKS]),
+			mNumberOfChunks(0),
+			mNumberOfSlots(0),
+			mFreeListEnqueue(INVALID_INDEX),
+			mFreeListDequeue(INVALID_INDEX)
 		{
-			for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_ELEMENTS; ++i)
-			{
-				mIndices[i].id = i;
-				mIndices[i].next = static_cast<uint16_t>(i + 1);
-			}
+			static_assert(0 != NUMBER_OF_ELEMENTS_PER_CHUNK && 0 == (NUMBER_OF_ELEMENTS_PER_CHUNK & (NUMBER_OF_ELEMENTS_PER_CHUNK - 1)), "The number of elements per chunk must be a power of two");
 		}
 
 		inline ~PackedElementManager()
 		{
 			// If there are any elements left alive, smash them
-			for (size_t i = 0; i < mNumberOfElements; ++i)
+			for (uint32_t i = 0; i < mNumberOfElements; ++i)
+			{
+				getElementByIndex(i).deinitializeElement();
+			}
+			for (uint32_t i = 0; i < mNumberOfChunks; ++i)
 			{
-				mElements[i].deinitializeElement();
+				delete [] mElementChunks[i];
+				delete [] mSlotChunks[i];
 			}
+			delete [] mElementChunks;
+			delete [] mSlotChunks;
 		}
 
 		[[nodiscard]] inline uint32_t getNumberOfElements() const
@@ -43,15 +58,15 @@ namespace Renderer
 
 		[[nodiscard]] inline ELEMENT_TYPE& getElementByIndex(uint32_t index) const
 		{
-			return mElements[index];
+			return mElementChunks[index / NUMBER_OF_ELEMENTS_PER_CHUNK][index & (NUMBER_OF_ELEMENTS_PER_CHUNK - 1)];
 		}
 
 		[[nodiscard]] inline bool isElementIdValid(ID_TYPE id) const
 		{
-			if (IsValid(id))
+			if (IsValid(id) && (id & INDEX_MASK) < mNumberOfSlots.load(std::memory_order_acquire))
 			{
-				const Index& index = mIndices[id & INDEX_MASK];
-				return (index.id == id && index.index != USHRT_MAX);
+				const Slot& slot = getSlot(id & INDEX_MASK);
+				return (slot.id == id && slot.index != INVALID_INDEX);
 			}
 			return false;
 		}
@@ -59,30 +74,37 @@ namespace Renderer
 		[[nodiscard]] inline ELEMENT_TYPE& getElementById(ID_TYPE id) const
 		{
 			SE_ASSERT(isElementIdValid(id), "Invalid ID")
-			return mElements[mIndices[id & INDEX_MASK].index];
+			return getElementByIndex(getSlot(id & INDEX_MASK).index);
 		}
 
 		[[nodiscard]] inline ELEMENT_TYPE* tryGetElementById(ID_TYPE id) const
 		{
-			if (IsValid(id))
-			{
-				const Index& index = mIndices[id & INDEX_MASK];
-				return (index.id == id && index.index != USHRT_MAX) ? &mElements[index.index] : nullptr;
-			}
-			return nullptr;
+			return isElementIdValid(id) ? &getElementByIndex(getSlot(id & INDEX_MASK).index) : nullptr;
 		}
 
 		[[nodiscard]] inline ELEMENT_TYPE& addElement()
 		{
-			Index& index = mIndices[mFreeListDequeue];
-			mFreeListDequeue = index.next;
-			index.id += NEW_OBJECT_ID_ADD;
-			index.index = static_cast<uint16_t>(mNumberOfElements++);
+			// Grow if there's no free slot left, existing elements stay where they are
+			if (INVALID_INDEX == mFreeListDequeue)
+			{
+				grow();
+			}
+
+			// Take the oldest free slot
+			const uint32_t slotIndex = mFreeListDequeue;
+			Slot& slot = getSlot(slotIndex);
+			mFreeListDequeue = slot.next;
+			if (INVALID_INDEX == mFreeListDequeue)
+			{
+				mFreeListEnqueue = INVALID_INDEX;
+			}
+			slot.id += NEW_OBJECT_ID_ADD;	// The generation counter wraps around, the slot index bits are not touched
+			slot.index = mNumberOfElements++;
 
 			// Initialize the added element
-			// -> "placement new" ("new (static_cast<void*>(&element)) ELEMENT_TYPE(index.id);") is not used by intent to avoid some nasty STL issues
-			ELEMENT_TYPE& element = mElements[index.index];
-			element.initializeElement(index.id);
+			// -> "placement new" ("new (static_cast<void*>(&element)) ELEMENT_TYPE(slot.id);") is not used by intent to avoid some nasty STL issues
+			ELEMENT_TYPE& element = getElementByIndex(slot.index);
+			element.initializeElement(slot.id);
 
 			// Return the added element
 			return element;
@@ -91,8 +113,9 @@ namespace Renderer
 		inline void removeElement(ID_TYPE id)
 		{
 			SE_ASSERT(isElementIdValid(id), "Invalid ID")
-			Index& index = mIndices[id & INDEX_MASK];
-			ELEMENT_TYPE& element = mElements[index.index];
+			const uint32_t slotIndex = (id & INDEX_MASK);
+			Slot& slot = getSlot(slotIndex);
+			ELEMENT_TYPE& element = getElementByIndex(slot.index);
 
 			// Deinitialize the removed element
 			// -> Calling the destructor ("element.~ELEMENT_TYPE();") is not used by intent to avoid some nasty STL issues
@@ -100,16 +123,24 @@ namespace Renderer
 			--mNumberOfElements;
 
 			// If this is the last element, there's no need to swap it with itself
-			if (index.index != mNumberOfElements)
+			if (slot.index != mNumberOfElements)
 			{
-				element = std::move(mElements[mNumberOfElements]);
-				mIndices[element.getId() & INDEX_MASK].index = index.index;
+				element = std::move(getElementByIndex(mNumberOfElements));
+				getSlot(element.getId() & INDEX_MASK).index = slot.index;
 			}
 
 			// Update free list
-			index.index = USHRT_MAX;
-			mIndices[mFreeListEnqueue].next = (id & INDEX_MASK);
-			mFreeListEnqueue = (id & INDEX_MASK);
+			slot.index = INVALID_INDEX;
+			slot.next = INVALID_INDEX;
+			if (INVALID_INDEX == mFreeListEnqueue)
+			{
+				mFreeListDequeue = slotIndex;
+			}
+			else
+			{
+				getSlot(mFreeListEnqueue).next = slotIndex;
+			}
+			mFreeListEnqueue = slotIndex;
 		}
 
 
@@ -120,30 +151,69 @@ namespace Renderer
 		explicit PackedElementManager(const PackedElementManager&) = delete;
 		PackedElementManager& operator=(const PackedElementManager&) = delete;
 
+		inline void grow()
+		{
+			// Sanity check, the last slot index is never used so no ID can become the invalid ID
+			SE_ASSERT(mNumberOfChunks < MAXIMUM_NUMBER_OF_CHUNKS, "Maximum number of packed elements exceeded")
+
+			// Add an element chunk and a slot chunk of free slots, the number of slots and elements is always identical
+			// -> Only unused directory entries are written, the directories themselves and the existing chunks never move
+			const uint32_t firstSlotIndex = mNumberOfChunks * NUMBER_OF_ELEMENTS_PER_CHUNK;
+			const uint32_t lastSlotIndex = firstSlotIndex + NUMBER_OF_ELEMENTS_PER_CHUNK - 1;
+			Slot* slotChunk = new Slot[NUMBER_OF_ELEMENTS_PER_CHUNK];
+			for (uint32_t i = firstSlotIndex; i <= lastSlotIndex; ++i)
+			{
+				Slot& slot = slotChunk[i - firstSlotIndex];
+				slot.id = i;
+				slot.index = INVALID_INDEX;
+				slot.next = (i != lastSlotIndex) ? (i + 1) : INVALID_INDEX;
+			}
+			mElementChunks[mNumberOfChunks] = new ELEMENT_TYPE[NUMBER_OF_ELEMENTS_PER_CHUNK];
+			mSlotChunks[mNumberOfChunks] = slotChunk;
+			++mNumberOfChunks;
+			mNumberOfSlots.store(lastSlotIndex + 1, std::memory_order_release);	// Publish the new slots after the chunks are in place
+			mFreeListDequeue = firstSlotIndex;
+			mFreeListEnqueue = lastSlotIndex;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		static constexpr uint32_t INDEX_MASK		= 0xffff;
-		static constexpr uint32_t NEW_OBJECT_ID_ADD	= 0x10000;
+		static constexpr uint32_t INDEX_MASK		= 0x000fffff;	// Lower 20 bits: Slot index
+		static constexpr uint32_t NEW_OBJECT_ID_ADD	= 0x00100000;	// Upper 12 bits: Generation counter
+		static constexpr uint32_t INVALID_INDEX		= UINT32_MAX;
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_CHUNKS = INDEX_MASK / NUMBER_OF_ELEMENTS_PER_CHUNK;	// Rounded down, so the last slot index is never used
 
-		struct Index final
+		struct Slot final
 		{
-			ID_TYPE  id;
-			uint16_t index;
-			uint16_t next;
+			ID_TYPE  id;	// Slot index and generation counter
+			uint32_t index;	// Index of the element, "INVALID_INDEX" if the slot is free
+			uint32_t next;	// Index of the next free slot, "INVALID_INDEX" if there's none
 		};
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] inline Slot& getSlot(uint32_t slotIndex) const
+		{
+			return mSlotChunks[slotIndex / NUMBER_OF_ELEMENTS_PER_CHUNK][slotIndex & (NUMBER_OF_ELEMENTS_PER_CHUNK - 1)];
+		}
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t			 mNumberOfElements;
-		mutable ELEMENT_TYPE mElements[MAXIMUM_NUMBER_OF_ELEMENTS];
-		Index				 mIndices[MAXIMUM_NUMBER_OF_ELEMENTS];
-		uint16_t			 mFreeListEnqueue;
-		uint16_t			 mFreeListDequeue;
+		uint32_t			  mNumberOfElements;
+		ELEMENT_TYPE**		  mElementChunks;	// Element chunk directory with "MAXIMUM_NUMBER_OF_CHUNKS" entries, each element chunk has "NUMBER_OF_ELEMENTS_PER_CHUNK" elements, chunks are never moved or freed while the packed element manager exists
+		Slot**				  mSlotChunks;		// Slot chunk directory with "MAXIMUM_NUMBER_OF_CHUNKS" entries, ID to element index lookup table which grows together with the element chunks
+		uint32_t			  mNumberOfChunks;	// Number of used element and slot chunk directory entries
+		std::atomic<uint32_t> mNumberOfSlots;	// Number of slots which can be looked up, published after the chunks of a growth are in place
+		uint32_t			  mFreeListEnqueue;	// Index of the most recently freed slot, "INVALID_INDEX" if there's no free slot
+		uint32_t			  mFreeListDequeue;	// Index of the oldest free slot, "INVALID_INDEX" if there's no free slot
 	};
 } // Renderer
@@ -0,0 +1,194 @@
+#pragma once
+
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Lock-free bounded multiple producer multiple consumer queue
+	*
+	*  @remarks
+	*    Each cell of the ring buffer carries a sequence number telling producers and consumers whether or not the cell is ready for them. A
+	*    producer or consumer claims a cell by advancing the enqueue or dequeue position via compare-and-swap, there are no locks involved.
+	*    The queue doesn't block: If it's full "tryPush()" fails and if it's empty "tryPop()" fails, it's up to the user to decide how to wait.
+	*
+	*  @note
+	*    - "TYPE" must be default constructible and copy assignable
+	*    - The capacity must be a power of two
+	*    - Basing on "Bounded MPMC queue" by Dmitry Vyukov - http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+	*/
+	template <typename TYPE>
+	class BoundedMpmcQueue final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] capacity
+		*    Maximum number of elements inside the queue, must be a power of two
+		*/
+		inline explicit BoundedMpmcQueue(uint32_t capacity) :
+			mCells(new Cell[capacity]),
+			mMask(capacity - 1u),
+			mEnqueuePosition(0),
+			mDequeuePosition(0)
+		{
+			SE_ASSERT(capacity >= 2 && 0 == (capacity & (capacity - 1u)), "The bounded MPMC queue capacity must be a power of two")
+			for (uint32_t i = 0; i < capacity; ++i)
+			{
+				mCells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		inline ~BoundedMpmcQueue()
+		{
+			delete [] mCells;
+		}
+
+		/**
+		*  @brief
+		*    Return the maximum number of elements inside the queue
+		*
+		*  @return
+		*    The maximum number of elements inside the queue
+		*/
+		[[nodiscard]] inline uint32_t getCapacity() const
+		{
+			return static_cast<uint32_t>(mMask + 1u);
+		}
+
+		/**
+		*  @brief
+		*    Try to push an element into the queue
+		*
+		*  @param[in] element
+		*    Element to push, copied into the queue
+		*
+		*  @return
+		*    "true" if the element was pushed, "false" if the queue is full
+		*/
+		[[nodiscard]] bool tryPush(const TYPE& element)
+		{
+			Cell* cell = nullptr;
+			size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &mCells[position & mMask];
+				const intptr_t difference = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+				if (0 == difference)
+				{
+					// The cell is free, try to claim it
+					if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					// The queue is full
+					return false;
+				}
+				else
+				{
+					// Another producer was faster
+					position = mEnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			// Fill the claimed cell and publish it to the consumers
+			cell->element = element;
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		*  @brief
+		*    Try to pop an element from the queue
+		*
+		*  @param[out] element
+		*    Receives the popped element, not touched if the queue is empty
+		*
+		*  @return
+		*    "true" if an element was popped, "false" if the queue is empty
+		*/
+		[[nodiscard]] bool tryPop(TYPE& element)
+		{
+			Cell* cell = nullptr;
+			size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &mCells[position & mMask];
+				const intptr_t difference = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + 1);
+				if (0 == difference)
+				{
+					// The cell is filled, try to claim it
+					if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					// The queue is empty
+					return false;
+				}
+				else
+				{
+					// Another consumer was faster
+					position = mDequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			// Read the claimed cell and hand it back to the producers for the next round
+			element = cell->element;
+			cell->sequence.store(position + mMask + 1, std::memory_order_release);
+			return true;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Cell final
+		{
+			std::atomic<size_t> sequence;
+			TYPE				element;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+		BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Cell*						mCells;	// Ring buffer, destroy the instance if you no longer need it
+		const size_t				mMask;
+		alignas(64) std::atomic<size_t> mEnqueuePosition;	// Producers and consumers are on different cache lines to avoid false sharing
+		alignas(64) std::atomic<size_t> mDequeuePosition;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
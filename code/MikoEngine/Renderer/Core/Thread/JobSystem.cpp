@@ -0,0 +1,372 @@
+#include "stdafx.h"
+#include "Renderer/Core/Thread/JobSystem.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_PACKAGES_PER_THREAD = 4;	// Number of item packages per thread a parallel for is split into, more packages than threads give work-stealing room for load balancing
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_IDLE_ITERATIONS = 1024;	// Number of yielding idle iterations before a worker thread goes to sleep
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local Renderer::JobSystem* g_ThreadJobSystem = nullptr;	// Job system the current thread is registered at, null pointer if the current thread isn't a job system thread
+		thread_local uint32_t g_ThreadIndex = GetInvalid<uint32_t>();	// Index of the current thread inside the job system
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	JobSystem::JobSystem(uint32_t numberOfWorkerThreads, uint32_t numberOfReservedHardwareThreads) :
+		mShutdownWorkerThreads(false),
+		mNumberOfQueuedJobs(0),
+		mNumberOfSleepingWorkerThreads(0)
+	{
+		// The calling thread takes part in job processing, so we need one worker thread less than there are hardware threads (minus the reserved ones)
+		if (IsInvalid(numberOfWorkerThreads))
+		{
+			const uint32_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+			numberOfWorkerThreads = (numberOfHardwareThreads > numberOfReservedHardwareThreads + 1) ? (numberOfHardwareThreads - numberOfReservedHardwareThreads - 1) : 0;
+		}
+
+		// Create the thread queues, index 0 is the calling thread
+		mThreadQueues.resize(numberOfWorkerThreads + 1);
+		for (uint32_t threadIndex = 0; threadIndex <= numberOfWorkerThreads; ++threadIndex)
+		{
+			ThreadQueue* threadQueue = new ThreadQueue();
+			threadQueue->randomState = threadIndex * 2654435761u + 1u;	// Xorshift state must never be zero
+			mThreadQueues[threadIndex] = threadQueue;
+		}
+
+		// Register the calling thread
+		SE_ASSERT(nullptr == ::detail::g_ThreadJobSystem, "The calling thread is already registered at a job system")
+		::detail::g_ThreadJobSystem = this;
+		::detail::g_ThreadIndex = 0;
+
+		// Start the worker threads, they're persistent and go to sleep if there's no work to do
+		mWorkerThreads.reserve(numberOfWorkerThreads);
+		for (uint32_t threadIndex = 1; threadIndex <= numberOfWorkerThreads; ++threadIndex)
+		{
+			mWorkerThreads.emplace_back(&JobSystem::workerThread, this, threadIndex);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		SE_ASSERT(this == ::detail::g_ThreadJobSystem && 0 == ::detail::g_ThreadIndex, "The job system must be destroyed by the thread which created it")
+		SE_ASSERT(0 == mNumberOfQueuedJobs, "All jobs must have been finished when the job system gets destroyed")
+
+		// Wake up and join the worker threads
+		mShutdownWorkerThreads = true;
+		{
+			std::unique_lock<std::mutex> sleepMutexLock(mSleepMutex);
+			mSleepConditionVariable.notify_all();
+		}
+		for (std::thread& workerThread : mWorkerThreads)
+		{
+			workerThread.join();
+		}
+
+		// Unregister the calling thread
+		::detail::g_ThreadJobSystem = nullptr;
+		SetInvalid(::detail::g_ThreadIndex);
+
+		// Destroy the thread queues
+		for (ThreadQueue* threadQueue : mThreadQueues)
+		{
+			delete threadQueue;
+		}
+	}
+
+	JobSystem::Job* JobSystem::createJob(JobFunction function, const void* data, size_t numberOfBytes)
+	{
+		SE_ASSERT(nullptr != function, "Invalid job function")
+		SE_ASSERT(numberOfBytes <= JOB_DATA_SIZE, "Job data doesn't fit into the job")
+		Job* job = allocateJob();
+		job->function = function;
+		job->parent = nullptr;
+		job->numberOfUnfinishedJobs.store(1, std::memory_order_relaxed);
+		if (nullptr != data && numberOfBytes > 0)
+		{
+			memcpy(job->data, data, numberOfBytes);
+		}
+		return job;
+	}
+
+	JobSystem::Job* JobSystem::createChildJob(Job& parent, JobFunction function, const void* data, size_t numberOfBytes)
+	{
+		SE_ASSERT(parent.numberOfUnfinishedJobs.load(std::memory_order_relaxed) > 0, "The parent job has already been finished")
+		parent.numberOfUnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+		Job* job = createJob(function, data, numberOfBytes);
+		job->parent = &parent;
+		return job;
+	}
+
+	void JobSystem::run(Job& job)
+	{
+		getThreadQueue().queue.push(&job);
+
+		// Wake up a sleeping worker thread, if there's one (the sleep mutex lock ensures the wake up isn't lost while the worker thread is about to go to sleep)
+		++mNumberOfQueuedJobs;
+		if (mNumberOfSleepingWorkerThreads > 0)
+		{
+			std::unique_lock<std::mutex> sleepMutexLock(mSleepMutex);
+			mSleepConditionVariable.notify_one();
+		}
+	}
+
+	void JobSystem::wait(const Job& job)
+	{
+		// Help executing jobs instead of sleeping
+		while (job.numberOfUnfinishedJobs.load(std::memory_order_acquire) > 0)
+		{
+			Job* nextJob = getJob();
+			if (nullptr != nextJob)
+			{
+				execute(*nextJob);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void JobSystem::parallelForJobFunction(Job& job, const void* data)
+	{
+		// Recursively split the item range in halves until the package size is reached, idle threads will steal the pushed halves
+		JobSystem& jobSystem = *::detail::g_ThreadJobSystem;
+		ParallelForData parallelForData = *static_cast<const ParallelForData*>(data);
+		while (parallelForData.endIndex - parallelForData.startIndex > parallelForData.splitCount)
+		{
+			ParallelForData childParallelForData = parallelForData;
+			childParallelForData.startIndex = parallelForData.startIndex + (parallelForData.endIndex - parallelForData.startIndex) / 2;
+			parallelForData.endIndex = childParallelForData.startIndex;
+			jobSystem.run(*jobSystem.createChildJob(job, &JobSystem::parallelForJobFunction, &childParallelForData, sizeof(ParallelForData)));
+		}
+
+		// Process the remaining package
+		parallelForData.invokeFunction(parallelForData.function, parallelForData.startIndex, parallelForData.endIndex);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	uint32_t JobSystem::getParallelForSplitCount(uint32_t numberOfItems, uint32_t minimumSplitCount) const
+	{
+		const uint32_t numberOfThreads = getNumberOfThreads();
+		if (numberOfThreads <= 1)
+		{
+			// No worker threads, process all items at once
+			return numberOfItems;
+		}
+
+		// Split the items into a few packages per thread, but don't go below the minimum package size
+		const uint32_t numberOfPackages = numberOfThreads * ::detail::NUMBER_OF_PACKAGES_PER_THREAD;
+		const uint32_t splitCount = (numberOfItems + numberOfPackages - 1) / numberOfPackages;
+		return std::max(std::max(splitCount, minimumSplitCount), 1u);
+	}
+
+	JobSystem::ThreadQueue& JobSystem::getThreadQueue() const
+	{
+		SE_ASSERT(this == ::detail::g_ThreadJobSystem, "The calling thread isn't a thread of this job system")
+		return *mThreadQueues[::detail::g_ThreadIndex];
+	}
+
+	JobSystem::Job* JobSystem::allocateJob()
+	{
+		ThreadQueue& threadQueue = getThreadQueue();
+		Job* job = &threadQueue.jobs[threadQueue.numberOfAllocatedJobs & (MAXIMUM_NUMBER_OF_JOBS_PER_THREAD - 1u)];
+		++threadQueue.numberOfAllocatedJobs;
+		SE_ASSERT(job->numberOfUnfinishedJobs.load(std::memory_order_relaxed) <= 0, "Job ring buffer overflow, there are too many unfinished jobs in flight")
+		return job;
+	}
+
+	JobSystem::Job* JobSystem::getJob()
+	{
+		// First try to get a job from the own queue
+		ThreadQueue& threadQueue = getThreadQueue();
+		Job* job = threadQueue.queue.pop();
+		if (nullptr == job)
+		{
+			// Try to steal a job from another thread, start with a random victim to avoid that all threads fight over the same queue
+			const uint32_t numberOfThreads = getNumberOfThreads();
+			if (numberOfThreads > 1)
+			{
+				uint32_t& randomState = threadQueue.randomState;
+				randomState ^= randomState << 13;
+				randomState ^= randomState >> 17;
+				randomState ^= randomState << 5;
+				const uint32_t startThreadIndex = randomState % numberOfThreads;
+				for (uint32_t i = 0; i < numberOfThreads && nullptr == job; ++i)
+				{
+					const uint32_t victimThreadIndex = (startThreadIndex + i) % numberOfThreads;
+					if (victimThreadIndex != ::detail::g_ThreadIndex)
+					{
+						job = mThreadQueues[victimThreadIndex]->queue.steal();
+					}
+				}
+			}
+		}
+		if (nullptr != job)
+		{
+			--mNumberOfQueuedJobs;
+		}
+		return job;
+	}
+
+	void JobSystem::execute(Job& job)
+	{
+		job.function(job, job.data);
+		finish(job);
+	}
+
+	void JobSystem::finish(Job& job)
+	{
+		// A job is finished as soon as the job itself and all of its children have been finished
+		const int32_t numberOfUnfinishedJobs = job.numberOfUnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		if (0 == numberOfUnfinishedJobs && nullptr != job.parent)
+		{
+			finish(*job.parent);
+		}
+	}
+
+	void JobSystem::workerThread(uint32_t threadIndex)
+	{
+		// Register the worker thread
+		::detail::g_ThreadJobSystem = this;
+		::detail::g_ThreadIndex = threadIndex;
+
+		uint32_t numberOfIdleIterations = 0;
+		while (!mShutdownWorkerThreads)
+		{
+			Job* job = getJob();
+			if (nullptr != job)
+			{
+				execute(*job);
+				numberOfIdleIterations = 0;
+			}
+			else if (numberOfIdleIterations < ::detail::MAXIMUM_NUMBER_OF_IDLE_ITERATIONS)
+			{
+				// Stay responsive for a while, jobs usually come in bursts
+				std::this_thread::yield();
+				++numberOfIdleIterations;
+			}
+			else
+			{
+				// Go to sleep until there's new work to do
+				std::unique_lock<std::mutex> sleepMutexLock(mSleepMutex);
+				++mNumberOfSleepingWorkerThreads;
+				mSleepConditionVariable.wait(sleepMutexLock, [this]{ return mShutdownWorkerThreads || mNumberOfQueuedJobs > 0; });
+				--mNumberOfSleepingWorkerThreads;
+				numberOfIdleIterations = 0;
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private WorkStealingQueue methods                     ]
+	//[-------------------------------------------------------]
+	JobSystem::WorkStealingQueue::WorkStealingQueue() :
+		mTop(0),
+		mBottom(0)
+	{
+		for (std::atomic<Job*>& job : mJobs)
+		{
+			job.store(nullptr, std::memory_order_relaxed);
+		}
+	}
+
+	void JobSystem::WorkStealingQueue::push(Job* job)
+	{
+		const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+		SE_ASSERT(bottom - mTop.load(std::memory_order_acquire) < static_cast<int64_t>(MAXIMUM_NUMBER_OF_JOBS_PER_THREAD), "Work-stealing queue overflow")
+		mJobs[bottom & MASK].store(job, std::memory_order_relaxed);
+		mBottom.store(bottom + 1, std::memory_order_release);
+	}
+
+	JobSystem::Job* JobSystem::WorkStealingQueue::pop()
+	{
+		const int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+		mBottom.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = mTop.load(std::memory_order_relaxed);
+		Job* job = nullptr;
+		if (top <= bottom)
+		{
+			// Queue isn't empty
+			job = mJobs[bottom & MASK].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// This is the last job in the queue, there might be a race with a stealing thread
+				if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					// Lost the race
+					job = nullptr;
+				}
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			// Queue is empty
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	JobSystem::Job* JobSystem::WorkStealingQueue::steal()
+	{
+		int64_t top = mTop.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t bottom = mBottom.load(std::memory_order_acquire);
+		Job* job = nullptr;
+		if (top < bottom)
+		{
+			// Queue isn't empty, another stealing thread or a pop of the owning thread might be faster
+			job = mJobs[top & MASK].load(std::memory_order_relaxed);
+			if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				// Lost the race
+				job = nullptr;
+			}
+		}
+		return job;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
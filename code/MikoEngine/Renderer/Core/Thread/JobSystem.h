@@ -0,0 +1,293 @@
+#pragma once
+
+#include "Core/GetInvalid.h"
+
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Persistent work-stealing job system to avoid recreation of threads each tick
+	*
+	*  @remarks
+	*    Each worker thread owns a lock-free work-stealing deque (Chase-Lev). A thread pushes and pops jobs at the bottom of its own deque
+	*    while idle threads steal from the top of other deques. Jobs are allocated from a per-thread ring buffer, so there's no dynamic
+	*    memory allocation during job creation. Jobs can be created as children of another job, waiting for a job means waiting for the job
+	*    and all of its children. Waiting threads don't sleep, they help executing jobs until the waited job has been finished.
+	*
+	*    Usage example:
+	*    // Items which are going to be data-parallel-processed
+	*    typedef std::vector<Item> Items;
+	*    Items items;
+	*
+	*    // Process the items, the calling thread takes part in the processing and returns as soon as all items have been processed
+	*    JobSystem& jobSystem = ... get job system instance...
+	*    jobSystem.parallelFor(static_cast<uint32_t>(items.size()), 64, [&items](uint32_t startIndex, uint32_t endIndex)
+	*    {
+	*        for (uint32_t i = startIndex; i < endIndex; ++i)
+	*        {
+	*            // ... do work...
+	*        }
+	*    });
+	*
+	*  @note
+	*    - Meant for data-parallel as well as task-parallel use-cases
+	*    - Only the thread which created the job system instance as well as the worker threads are allowed to create, run and wait for jobs
+	*    - A job system thread must not have more than "MAXIMUM_NUMBER_OF_JOBS_PER_THREAD" unfinished jobs in flight since job memory gets recycled
+	*    - Basing on "Job System 2.0: Lock-Free Work Stealing" - https://blog.molecular-matters.com/2015/08/24/job-system-2-0-lock-free-work-stealing-part-1-basics/
+	*/
+	class JobSystem final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_JOBS_PER_THREAD = 4096;	// Must be a power of two
+		struct Job;
+		typedef void (*JobFunction)(Job& job, const void* data);
+		static constexpr size_t JOB_DATA_SIZE = 64 - sizeof(JobFunction) - sizeof(Job*) - sizeof(std::atomic<int32_t>);	// One job fits into a single cache line
+		struct alignas(64) Job final
+		{
+			JobFunction			 function;
+			Job*				 parent;
+			std::atomic<int32_t> numberOfUnfinishedJobs;	// The job itself plus all children which haven't been finished, yet
+			uint8_t				 data[JOB_DATA_SIZE];		// Job function payload
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] numberOfWorkerThreads
+		*    Number of worker threads, invalid number of threads means to use as many threads as there are hardware threads on the system (minus the calling thread which takes part in processing and minus the reserved hardware threads)
+		*  @param[in] numberOfReservedHardwareThreads
+		*    Number of hardware threads to leave to other thread pools like the resource streamer stages, only used if an invalid number of worker threads was given
+		*
+		*  @note
+		*    - The calling thread is registered as job system thread and hence can create, run and wait for jobs
+		*/
+		explicit JobSystem(uint32_t numberOfWorkerThreads = GetInvalid<uint32_t>(), uint32_t numberOfReservedHardwareThreads = 0);
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - All jobs must have been finished when the job system gets destroyed
+		*/
+		~JobSystem();
+
+		/**
+		*  @brief
+		*    Return the number of threads taking part in job processing
+		*
+		*  @return
+		*    The number of threads taking part in job processing, worker threads plus the thread which created the job system instance
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfThreads() const
+		{
+			return static_cast<uint32_t>(mThreadQueues.size());
+		}
+
+		/**
+		*  @brief
+		*    Create a job
+		*
+		*  @param[in] function
+		*    Job function, must be valid
+		*  @param[in] data
+		*    Optional job data which is copied into the job, can be a null pointer
+		*  @param[in] numberOfBytes
+		*    Number of job data bytes, must not be above "JOB_DATA_SIZE"
+		*
+		*  @return
+		*    The created job, don't destroy the instance, memory is recycled automatically
+		*
+		*  @note
+		*    - The job isn't executed until "run()" was called
+		*/
+		[[nodiscard]] Job* createJob(JobFunction function, const void* data = nullptr, size_t numberOfBytes = 0);
+
+		/**
+		*  @brief
+		*    Create a job as child of another job
+		*
+		*  @param[in] parent
+		*    Parent job which won't be finished before the created child job has been finished, the parent must not have been finished, yet
+		*  @param[in] function
+		*    Job function, must be valid
+		*  @param[in] data
+		*    Optional job data which is copied into the job, can be a null pointer
+		*  @param[in] numberOfBytes
+		*    Number of job data bytes, must not be above "JOB_DATA_SIZE"
+		*
+		*  @return
+		*    The created job, don't destroy the instance, memory is recycled automatically
+		*/
+		[[nodiscard]] Job* createChildJob(Job& parent, JobFunction function, const void* data = nullptr, size_t numberOfBytes = 0);
+
+		/**
+		*  @brief
+		*    Push the given job into the job queue of the calling thread so it can be executed by any job system thread
+		*
+		*  @param[in] job
+		*    Job to run
+		*/
+		void run(Job& job);
+
+		/**
+		*  @brief
+		*    Wait until the given job and all of its children have been finished
+		*
+		*  @param[in] job
+		*    Job to wait for
+		*
+		*  @note
+		*    - The calling thread doesn't sleep but executes jobs while waiting
+		*/
+		void wait(const Job& job);
+
+		/**
+		*  @brief
+		*    Data-parallel for loop
+		*
+		*  @param[in] numberOfItems
+		*    Number of items to process
+		*  @param[in] minimumSplitCount
+		*    Minimum package size for a job to work on, item ranges are split recursively until they're below the adaptive split count
+		*  @param[in] function
+		*    Function to call per item range, signature "void(uint32_t startIndex, uint32_t endIndex)", must stay valid until this method returns
+		*
+		*  @note
+		*    - Blocking, the calling thread takes part in the processing
+		*    - If there isn't enough work the function is called directly by the calling thread, not worth the additional threading effort
+		*/
+		template <typename FUNCTION>
+		void parallelFor(uint32_t numberOfItems, uint32_t minimumSplitCount, const FUNCTION& function)
+		{
+			const ParallelForData parallelForData =
+			{
+				&function,
+				[](const void* function, uint32_t startIndex, uint32_t endIndex) { (*static_cast<const FUNCTION*>(function))(startIndex, endIndex); },
+				0,
+				numberOfItems,
+				getParallelForSplitCount(numberOfItems, minimumSplitCount)
+			};
+			if (numberOfItems <= parallelForData.splitCount)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				if (numberOfItems > 0)
+				{
+					function(0, numberOfItems);
+				}
+			}
+			else
+			{
+				Job* job = createJob(&JobSystem::parallelForJobFunction, &parallelForData, sizeof(ParallelForData));
+				run(*job);
+				wait(*job);
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef void (*ParallelForInvokeFunction)(const void* function, uint32_t startIndex, uint32_t endIndex);
+		struct ParallelForData final
+		{
+			const void*				  function;
+			ParallelForInvokeFunction invokeFunction;
+			uint32_t				  startIndex;
+			uint32_t				  endIndex;
+			uint32_t				  splitCount;
+		};
+		static_assert(sizeof(ParallelForData) <= JOB_DATA_SIZE, "Parallel for data doesn't fit into the job data");
+
+		/**
+		*  @brief
+		*    Lock-free single producer multiple consumer work-stealing deque
+		*
+		*  @note
+		*    - "push()" and "pop()" must only be called by the owning thread, "steal()" can be called by any thread
+		*    - Basing on "Dynamic Circular Work-Stealing Deque" by David Chase and Yossi Lev with the C++11 memory model corrections of "Correct and Efficient Work-Stealing for Weak Memory Models" by Nhat Minh Le et al.
+		*/
+		class WorkStealingQueue final
+		{
+		public:
+			WorkStealingQueue();
+			void push(Job* job);
+			[[nodiscard]] Job* pop();
+			[[nodiscard]] Job* steal();
+		private:
+			static constexpr int64_t MASK = MAXIMUM_NUMBER_OF_JOBS_PER_THREAD - 1u;
+			alignas(64) std::atomic<int64_t> mTop;		// Stealing threads take jobs from the top
+			alignas(64) std::atomic<int64_t> mBottom;	// The owning thread pushes and pops jobs at the bottom
+			alignas(64) std::atomic<Job*>	 mJobs[MAXIMUM_NUMBER_OF_JOBS_PER_THREAD];
+		};
+
+		struct alignas(64) ThreadQueue final
+		{
+			WorkStealingQueue queue;
+			Job				  jobs[MAXIMUM_NUMBER_OF_JOBS_PER_THREAD];	// Ring buffer of job memory
+			uint32_t		  numberOfAllocatedJobs = 0;
+			uint32_t		  randomState = 0;						// Xorshift random state used to pick steal victims
+		};
+		typedef std::vector<ThreadQueue*> ThreadQueues;
+		typedef std::vector<std::thread>  Threads;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		static void parallelForJobFunction(Job& job, const void* data);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		[[nodiscard]] uint32_t getParallelForSplitCount(uint32_t numberOfItems, uint32_t minimumSplitCount) const;
+		[[nodiscard]] ThreadQueue& getThreadQueue() const;
+		[[nodiscard]] Job* allocateJob();
+		[[nodiscard]] Job* getJob();
+		void execute(Job& job);
+		void finish(Job& job);
+		void workerThread(uint32_t threadIndex);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		ThreadQueues			mThreadQueues;					// Index 0 is the thread which created the job system instance, the other indices are the worker threads, destroy the instances if you no longer need them
+		Threads					mWorkerThreads;
+		std::atomic<bool>		mShutdownWorkerThreads;
+		std::atomic<uint32_t>	mNumberOfQueuedJobs;			// Only a hint used to decide whether or not sleeping worker threads need to be woken up
+		std::atomic<uint32_t>	mNumberOfSleepingWorkerThreads;
+		std::mutex				mSleepMutex;
+		std::condition_variable	mSleepConditionVariable;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
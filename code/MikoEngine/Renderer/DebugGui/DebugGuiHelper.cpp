@@ -442,6 +442,12 @@ namespace Renderer
 						ImGui::Text("Compute shaders: %s", ::detail::stringFormatCommas(statistics.currentNumberOfComputeShaders.load(), temporary));
 						ImGui::TreePop();
 					}
+					if (ImGui::TreeNode("CommandBufferOptimization", "Command buffer optimization: %s", ::detail::stringFormatCommas(statistics.numberOfOptimizedCommandBuffers.load(), temporary)))
+					{
+						ImGui::Text("Removed redundant commands: %s", ::detail::stringFormatCommas(statistics.numberOfRemovedRedundantCommands.load(), temporary));
+						ImGui::Text("Merged draw commands: %s", ::detail::stringFormatCommas(statistics.numberOfMergedDrawCommands.load(), temporary));
+						ImGui::TreePop();
+					}
 				}
 
 				// Pipeline statistics
@@ -31,8 +31,7 @@ namespace Renderer
 	class SkeletonAnimationResourceManager;
 	class MaterialBlueprintResourceManager;
 	class CompositorWorkspaceResourceManager;
-	template <typename ReturnType> class ThreadPool;
-	typedef ThreadPool<void> DefaultThreadPool;
+	class JobSystem;
 	#ifdef RENDERER_IMGUI
 		class DebugGuiManager;
 	#endif
@@ -148,14 +147,14 @@ namespace Renderer
 
 		/**
 		*  @brief
-		*    Return the default thread pool instance
+		*    Return the job system instance
 		*
 		*  @return
-		*    The default thread pool instance, do not release the returned instance
+		*    The job system instance, do not release the returned instance
 		*/
-		[[nodiscard]] inline DefaultThreadPool& getDefaultThreadPool() const
+		[[nodiscard]] inline JobSystem& getJobSystem() const
 		{
-			return *mDefaultThreadPool;
+			return *mJobSystem;
 		}
 
 		/**
@@ -447,6 +446,19 @@ namespace Renderer
 		virtual void loadPipelineStateObjectCache() = 0;
 		virtual void savePipelineStateObjectCache() = 0;
 
+		/**
+		*  @brief
+		*    Return the pipeline state object cache warm-up progress
+		*
+		*  @return
+		*    The warm-up progress inside [0, 1], 1 if there's no warm-up in progress
+		*
+		*  @remarks
+		*    "loadPipelineStateObjectCache()" commits the cached pipeline states to the asynchronous pipeline state compilers instead of
+		*    compiling one after another. Keep calling "update()" e.g. while showing a loading bar until the warm-up progress is 1.
+		*/
+		[[nodiscard]] virtual float getPipelineStateObjectCacheWarmUpProgress() const = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -466,7 +478,7 @@ namespace Renderer
 			mBufferManager(nullptr),
 			mTextureManager(nullptr),
 			mFileManager(nullptr),
-			mDefaultThreadPool(nullptr),
+			mJobSystem(nullptr),
 			mAssetManager(nullptr),
 			mTimeManager(nullptr),
 			// Resource
@@ -509,7 +521,7 @@ namespace Renderer
 		Rhi::IBufferManager*  mBufferManager;	// The used RHI buffer manager instance (we keep a reference to it), always valid
 		Rhi::ITextureManager* mTextureManager;	// The used RHI texture manager instance (we keep a reference to it), always valid
 		IFileManager*		  mFileManager;		// The used file manager instance, always valid
-		DefaultThreadPool*	  mDefaultThreadPool;
+		JobSystem*			  mJobSystem;
 		AssetManager*		  mAssetManager;
 		TimeManager*		  mTimeManager;
 		// Resource
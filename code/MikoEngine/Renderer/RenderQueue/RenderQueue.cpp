@@ -2,6 +2,7 @@
 #include "Renderer/RenderQueue/RenderQueue.h"
 #include "Renderer/RenderQueue/RenderableManager.h"
 #include "Renderer/Resource/CompositorWorkspace/CompositorContextData.h"
+#include "Renderer/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/Resource/Texture/TextureResource.h"
 #include "Renderer/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Resource/Mesh/MeshResourceManager.h"
@@ -17,6 +18,8 @@
 #include "Renderer/Resource/MaterialBlueprint/BufferManager/UniformInstanceBufferManager.h"
 #include "Renderer/Resource/MaterialBlueprint/BufferManager/TextureInstanceBufferManager.h"
 #include "Renderer/Core/IProfiler.h"
+#include "Renderer/Core/Thread/JobSystem.h"
+#include "Renderer/IRenderer.h"
 #include "Math/Transform.h"
 
 //[-------------------------------------------------------]
@@ -186,6 +189,77 @@ namespace
 			}
 		}
 
+		/**
+		*  @brief
+		*    Stable least significant digit (LSD) radix sort by the 64 bit sorting key
+		*
+		*  @param[in, out] elements
+		*    Elements to sort
+		*  @param[in] scratchElements
+		*    Scratch buffer to reduce dynamic memory allocations, might swap its memory with the given elements
+		*
+		*  @remarks
+		*    The histograms of all key bytes are gathered within a single pass. Key bytes which are identical for all elements don't need
+		*    a scatter pass, for example unused sorting key bits.
+		*/
+		template <typename ELEMENT>
+		void radixSort(std::vector<ELEMENT>& elements, std::vector<ELEMENT>& scratchElements)
+		{
+			static constexpr uint32_t MINIMUM_NUMBER_OF_ELEMENTS = 64;	// Below this number of elements a stable comparison based sort is faster
+			static constexpr uint32_t NUMBER_OF_KEY_BYTES = 8;
+			const uint32_t numberOfElements = static_cast<uint32_t>(elements.size());
+			if (numberOfElements < MINIMUM_NUMBER_OF_ELEMENTS)
+			{
+				std::stable_sort(elements.begin(), elements.end());
+				return;
+			}
+
+			// Gather the histograms of all key bytes
+			uint32_t histograms[NUMBER_OF_KEY_BYTES][256] = {};
+			for (const ELEMENT& element : elements)
+			{
+				const uint64_t sortingKey = element.sortingKey;
+				for (uint32_t keyByteIndex = 0; keyByteIndex < NUMBER_OF_KEY_BYTES; ++keyByteIndex)
+				{
+					++histograms[keyByteIndex][(sortingKey >> (keyByteIndex * 8)) & 0xffu];
+				}
+			}
+
+			// Scatter pass per key byte, from the least to the most significant one
+			scratchElements.resize(numberOfElements);
+			ELEMENT* sourceElements = elements.data();
+			ELEMENT* destinationElements = scratchElements.data();
+			for (uint32_t keyByteIndex = 0; keyByteIndex < NUMBER_OF_KEY_BYTES; ++keyByteIndex)
+			{
+				const uint32_t shift = keyByteIndex * 8;
+				uint32_t* histogram = histograms[keyByteIndex];
+				if (histogram[(sourceElements[0].sortingKey >> shift) & 0xffu] == numberOfElements)
+				{
+					// All elements share this key byte
+					continue;
+				}
+
+				// Exclusive prefix sum delivers the destination offsets
+				uint32_t offset = 0;
+				for (uint32_t i = 0; i < 256; ++i)
+				{
+					const uint32_t count = histogram[i];
+					histogram[i] = offset;
+					offset += count;
+				}
+				for (uint32_t i = 0; i < numberOfElements; ++i)
+				{
+					destinationElements[histogram[(sourceElements[i].sortingKey >> shift) & 0xffu]++] = sourceElements[i];
+				}
+				std::swap(sourceElements, destinationElements);
+			}
+			if (sourceElements != elements.data())
+			{
+				// The sorted elements are inside the scratch buffer
+				elements.swap(scratchElements);
+			}
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -214,12 +288,26 @@ namespace Renderer
 		mMaximumRenderQueueIndex(maximumRenderQueueIndex),
 		mPositionOnlyPass(positionOnlyPass),
 		mTransparentPass(transparentPass),
-		mDoSort(doSort)
+		mDoSort(doSort),
+		mNumberOfUsedRecordingCommandBuffers(0)
 	{
 		SE_ASSERT(mMaximumRenderQueueIndex >= mMinimumRenderQueueIndex, "Invalid minimum/maximum render queue index")
 		mQueues.resize(static_cast<size_t>(mMaximumRenderQueueIndex - mMinimumRenderQueueIndex + 1));
 	}
 
+	RenderQueue::~RenderQueue()
+	{
+		// Destroy the multi-threaded command buffer recording command buffers
+		for (Rhi::CommandBuffer* stateCommandBuffer : mStateCommandBuffers)
+		{
+			delete stateCommandBuffer;
+		}
+		for (Rhi::CommandBuffer* recordingCommandBuffer : mRecordingCommandBuffers)
+		{
+			delete recordingCommandBuffer;
+		}
+	}
+
 	void RenderQueue::clear()
 	{
 		if (getNumberOfDrawCalls() > 0)
@@ -231,235 +319,74 @@ namespace Renderer
 			}
 			mNumberOfNullDrawCalls = mNumberOfDrawIndexedCalls = mNumberOfDrawCalls = 0;
 		}
+
+		// The filled command buffers have been executed, so the recording command buffers can be reused
+		mNumberOfUsedRecordingCommandBuffers = 0;
 	}
 
 	void RenderQueue::addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows)
 	{
-		// Sanity check
-		SE_ASSERT(renderableManager.isVisible(), "Invalid renderable manager visibility")
-
-		// Sorting key bits
-		static constexpr uint32_t PIPELINE_STATE_NUMBER_OF_BITS	= 16;
-		static constexpr uint32_t VERTEX_ARRAY_NUMBER_OF_BITS	= 16;
-		static constexpr uint32_t RESOURCE_GROUP_NUMBER_OF_BITS	= 11;	// TODO(co) Add resource group sorting
-		static constexpr uint32_t DEPTH_NUMBER_OF_BITS			= 21;
-
-		// Sorting key bit shift: Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
-		static constexpr uint32_t PIPELINE_STATE_SHIFT_OPAQUE	= 64							- PIPELINE_STATE_NUMBER_OF_BITS;	// = 48
-		static constexpr uint32_t VERTEX_ARRAY_SHIFT_OPAQUE		= PIPELINE_STATE_SHIFT_OPAQUE	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 32
-		static constexpr uint32_t RESOURCE_GROUP_SHIFT_OPAQUE	= VERTEX_ARRAY_SHIFT_OPAQUE		- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 21
-		static constexpr uint32_t DEPTH_SHIFT_OPAQUE			= RESOURCE_GROUP_SHIFT_OPAQUE	- DEPTH_NUMBER_OF_BITS;				// = 0
-
-		// Sorting key transparent bit shift: Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
-		static constexpr uint32_t DEPTH_SHIFT_TRANSPARENT			= 64								- DEPTH_NUMBER_OF_BITS;				// = 43
-		static constexpr uint32_t PIPELINE_STATE_SHIFT_TRANSPARENT	= DEPTH_SHIFT_TRANSPARENT			- PIPELINE_STATE_NUMBER_OF_BITS;	// = 27
-		static constexpr uint32_t VERTEX_ARRAY_SHIFT_TRANSPARENT	= PIPELINE_STATE_SHIFT_TRANSPARENT	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 11
-		static constexpr uint32_t RESOURCE_GROUP_SHIFT_TRANSPARENT	= VERTEX_ARRAY_SHIFT_TRANSPARENT	- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 0
-
-		// Quantize the cached distance to camera
-		// -> Solid: Sort from front to back to benefit from early z rejection
-		// -> Transparent: Sort from back to front to have correct alpha blending
-		const uint32_t quantizedDepth = ::detail::depthToBits(mTransparentPass ? -renderableManager.getCachedDistanceToCamera() : renderableManager.getCachedDistanceToCamera(), DEPTH_NUMBER_OF_BITS);
+		// Pipeline state cache updates are allowed, so all renderables are always gathered
+		mScratchQueuedRenderables.clear();
+		if (gatherQueuedRenderables(renderableManager, materialTechniqueId, compositorContextData, castShadows, true, mScratchShaderProperties, mScratchOptimizedShaderProperties, mScratchQueuedRenderables))
+		{
+			insertQueuedRenderables(mScratchQueuedRenderables);
+		}
+	}
 
-		// Optionally adjust and check the LOD index
-		uint8_t lodIndex = mRenderer.getMeshResourceManager().getNumberOfTopMeshLodsToRemove();
-		SE_ASSERT(0 != renderableManager.getNumberOfLods(), "Invalid renderable manager which has no LODs: There must always be at least one LOD, namely the original none reduced version")
-		const uint8_t numberOfLods = renderableManager.getNumberOfLods();
-		if (lodIndex >= numberOfLods)
+	void RenderQueue::addRenderablesFromRenderableManagers(const std::vector<RenderableManager*>& renderableManagers, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows)
+	{
+		// Not worth the additional threading effort if there are just a few renderable managers
+		const uint32_t numberOfRenderableManagers = static_cast<uint32_t>(renderableManagers.size());
+		const uint32_t numberOfFillBuckets = (numberOfRenderableManagers + NUMBER_OF_RENDERABLE_MANAGERS_PER_FILL_BUCKET - 1) / NUMBER_OF_RENDERABLE_MANAGERS_PER_FILL_BUCKET;
+		if (numberOfFillBuckets < 2)
 		{
-			// Silently clamp to maximum LOD
-			lodIndex = static_cast<uint8_t>(static_cast<int>(numberOfLods) - 1);
+			for (const RenderableManager* renderableManager : renderableManagers)
+			{
+				addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, compositorContextData, castShadows);
+			}
+			return;
 		}
 
-		// Register the renderables inside our renderables queue
-		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
-		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
-		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
-		const bool singlePassStereoInstancing = compositorContextData.getSinglePassStereoInstancing();
-		const RenderableManager::Renderables& renderables = renderableManager.getRenderables();
-		const uint32_t numberOfRenderablesPerLod = static_cast<uint32_t>(renderables.size()) / numberOfLods;	// Each LOD has the same number of renderables
-		uint32_t renderableIndex = numberOfRenderablesPerLod * lodIndex;
-		uint32_t renderableEndIndex = renderableIndex + numberOfRenderablesPerLod;
-		for (; renderableIndex < renderableEndIndex; ++renderableIndex)
+		// Each fill bucket covers a fixed range of renderable managers and is only written by the thread processing this range: The content
+		// of the fill buckets doesn't depend on the number of threads or on the job scheduling, so the result is deterministic
+		if (mFillBuckets.size() < numberOfFillBuckets)
 		{
-			const Renderable& renderable = renderables[renderableIndex];
-			if (!castShadows || renderable.getCastShadows())
+			mFillBuckets.resize(numberOfFillBuckets);
+		}
+		mRenderer.getJobSystem().parallelFor(numberOfFillBuckets, 1, [this, &renderableManagers, materialTechniqueId, &compositorContextData, castShadows, numberOfRenderableManagers](uint32_t startFillBucketIndex, uint32_t endFillBucketIndex)
+		{
+			for (uint32_t fillBucketIndex = startFillBucketIndex; fillBucketIndex < endFillBucketIndex; ++fillBucketIndex)
 			{
-				// It's valid if one or more renderables inside a renderable manager don't fall into the range processed by this render queue
-				// -> At least one renderable should fall into the range processed by this render queue or the render queue is used wrong
-				const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
-				if (renderQueueIndex >= mMinimumRenderQueueIndex && renderQueueIndex <= mMaximumRenderQueueIndex)
+				FillBucket& fillBucket = mFillBuckets[fillBucketIndex];
+				fillBucket.queuedRenderables.clear();
+				fillBucket.deferredRenderableManagers.clear();
+				const uint32_t startIndex = fillBucketIndex * NUMBER_OF_RENDERABLE_MANAGERS_PER_FILL_BUCKET;
+				const uint32_t endIndex = std::min(startIndex + NUMBER_OF_RENDERABLE_MANAGERS_PER_FILL_BUCKET, numberOfRenderableManagers);
+				for (uint32_t i = startIndex; i < endIndex; ++i)
 				{
-					// Material resource
-					const MaterialResource* materialResource = materialResourceManager.tryGetById(renderable.getMaterialResourceId());
-					if (nullptr != materialResource)
+					// Pipeline state cache updates aren't thread safe: Roll back and defer the renderable manager to the serial part
+					const size_t numberOfQueuedRenderables = fillBucket.queuedRenderables.size();
+					if (!gatherQueuedRenderables(*renderableManagers[i], materialTechniqueId, compositorContextData, castShadows, false, fillBucket.scratchShaderProperties, fillBucket.scratchOptimizedShaderProperties, fillBucket.queuedRenderables))
 					{
-						MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
-						if (nullptr != materialTechnique)
-						{
-							MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
-							if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
-							{
-								// Get the pipeline state object (PSO) to use, preferably by using cached information
-								Rhi::IPipelineState* foundPipelineState = nullptr;
-								if (IsValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
-								{
-									// Compute material blueprint resource
-
-									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
-
-									// Get the pipeline state object (PSO) to use, preferably by using cached information
-									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
-									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
-									{
-										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
-										{
-											if (generationCounter != pipelineStateCache.generationCounter)
-											{
-												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-												const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
-
-												// As long as we received a fallback compute pipeline state cache, we can't update the renderable pipeline state cache
-												if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr() && !computePipelineStateCache->isUsingFallback())
-												{
-													pipelineStateCache.generationCounter = generationCounter;
-													pipelineStateCache.pipelineStatePtr = computePipelineStateCache->getComputePipelineStateObjectPtr();
-												}
-											}
-											foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCache.pipelineStatePtr->GetPointer());
-											SE_ASSERT(nullptr != foundPipelineState, "Invalid found compute pipeline state")
-											break;
-										}
-									}
-									if (nullptr == foundPipelineState)
-									{
-										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-										const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
-										if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr())
-										{
-											// As long as we received a fallback compute pipeline state cache, we can't put it into the renderable pipeline state cache
-											if (computePipelineStateCache->isUsingFallback())
-											{
-												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(computePipelineStateCache->getComputePipelineStateObjectPtr());
-											}
-											else
-											{
-												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, computePipelineStateCache->getComputePipelineStateObjectPtr()).pipelineStatePtr.GetPointer());
-											}
-											SE_ASSERT(nullptr != foundPipelineState, "Invalid found compute pipeline state")
-										}
-									}
-								}
-								else
-								{
-									// Graphics material blueprint resource
-
-									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
-
-									// Get the pipeline state object (PSO) to use, preferably by using cached information
-									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
-									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
-									{
-										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
-										{
-											if (generationCounter != pipelineStateCache.generationCounter)
-											{
-												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-												const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
-
-												// As long as we received a fallback graphics pipeline state cache, we can't update the renderable pipeline state cache
-												if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr() && !graphicsPipelineStateCache->isUsingFallback())
-												{
-													pipelineStateCache.generationCounter = generationCounter;
-													pipelineStateCache.pipelineStatePtr = graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr();
-												}
-											}
-											foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCache.pipelineStatePtr->GetPointer());
-											SE_ASSERT(nullptr != foundPipelineState, "Invalid found graphics pipeline state")
-											break;
-										}
-									}
-									if (nullptr == foundPipelineState)
-									{
-										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-										const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
-										if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr())
-										{
-											// As long as we received a fallback graphics pipeline state cache, we can't put it into the renderable pipeline state cache
-											if (graphicsPipelineStateCache->isUsingFallback())
-											{
-												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr());
-											}
-											else
-											{
-												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr()).pipelineStatePtr.GetPointer());
-											}
-											SE_ASSERT(nullptr != foundPipelineState, "Invalid found graphics pipeline state")
-										}
-									}
-								}
-								if (nullptr != foundPipelineState)
-								{
-									const uint16_t pipelineStateId = foundPipelineState->getId();
-									const uint16_t resourceGroupId = 0;	// TODO(co) Add resource group sorting
-									const uint32_t vertexArrayId = mPositionOnlyPass ? ((nullptr != renderable.getPositionOnlyVertexArrayPtrWithFallback()) ? renderable.getPositionOnlyVertexArrayPtrWithFallback()->getId() : 0u) : ((nullptr != renderable.getVertexArrayPtr()) ? renderable.getVertexArrayPtr()->getId() : 0u);
-
-									// Define helper macros
-									#define RENDER_QUEUE_MAKE_MASK(x) ((1u << (x)) - 1u)
-									#define RENDER_QUEUE_HASH(x, bits, shift) (uint64_t((x) & RENDER_QUEUE_MAKE_MASK((bits))) << (shift))
-
-									// Generate the sorting key
-									uint64_t sortingKey;	// Guaranteed to be initialized below
-									if (mTransparentPass)
-									{
-										// Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
-										sortingKey =
-										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_TRANSPARENT)			|
-										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_TRANSPARENT)	|
-										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_TRANSPARENT)		|
-										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_TRANSPARENT);
-									}
-									else
-									{
-										// Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
-										sortingKey =
-										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_OPAQUE)	|
-										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_OPAQUE)		|
-										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_OPAQUE)	|
-										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_OPAQUE);
-									}
-
-									// Undefine helper macros
-									#undef RENDER_QUEUE_HASH
-									#undef RENDER_QUEUE_MAKE_MASK
-
-									// Register the renderable inside our renderables queue
-									Queue& queue = mQueues[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)];
-									SE_ASSERT(!queue.sorted, "Ensure render queue is still in filling state and not already in rendering state")
-									queue.queuedRenderables.emplace_back(renderable, *materialResource, *materialTechnique, *materialBlueprintResource, *foundPipelineState, sortingKey);
-									if (0 != renderable.getNumberOfIndices())
-									{
-										if (renderable.getDrawIndexed())
-										{
-											++mNumberOfDrawIndexedCalls;
-										}
-										else
-										{
-											++mNumberOfDrawCalls;
-										}
-									}
-									else
-									{
-										++mNumberOfNullDrawCalls;
-									}
-								}
-							}
-						}
+						fillBucket.queuedRenderables.erase(fillBucket.queuedRenderables.begin() + static_cast<std::ptrdiff_t>(numberOfQueuedRenderables), fillBucket.queuedRenderables.end());
+						fillBucket.deferredRenderableManagers.push_back(renderableManagers[i]);
 					}
 				}
 			}
+		});
+
+		// Merge the fill buckets in order, followed by the deferred renderable managers which need pipeline state cache updates
+		for (uint32_t fillBucketIndex = 0; fillBucketIndex < numberOfFillBuckets; ++fillBucketIndex)
+		{
+			insertQueuedRenderables(mFillBuckets[fillBucketIndex].queuedRenderables);
+		}
+		for (uint32_t fillBucketIndex = 0; fillBucketIndex < numberOfFillBuckets; ++fillBucketIndex)
+		{
+			for (const RenderableManager* renderableManager : mFillBuckets[fillBucketIndex].deferredRenderableManagers)
+			{
+				addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, compositorContextData, castShadows);
+			}
 		}
 	}
 
@@ -560,8 +487,15 @@ namespace Renderer
 				}
 			}
 		}
+		else if (getNumberOfDrawCalls() >= MINIMUM_NUMBER_OF_QUEUED_RENDERABLES_FOR_RECORDING_RANGES && mRenderer.getJobSystem().getNumberOfThreads() > 1)
+		{
+			fillGraphicsCommandBufferByRecordingRanges(renderTarget, compositorContextData, commandBuffer);
+		}
 		else
 		{
+			// Sort queued renderables
+			sortQueues();
+
 			// Track currently bound RHI resources and states to void generating redundant commands
 			bool vertexArraySet = false;
 			Rhi::IVertexArray* currentVertexArray = nullptr;
@@ -585,7 +519,7 @@ namespace Renderer
 			}
 
 			// For gathering multi-draw-indirect data
-			std::array<Rhi::IResourceGroup*, 16> currentSetGraphicsResourceGroup;	// TODO(co) Use maximum number of graphics resource groups here, 16 is considered a save number of root parameters
+			std::array<Rhi::IResourceGroup*, 16> currentSetGraphicsResourceGroup = {};	// TODO(co) Use maximum number of graphics resource groups here, 16 is considered a save number of root parameters
 			uint32_t currentDrawIndirectBufferOffset = indirectBufferOffset;
 			uint32_t currentNumberOfDraws = 0;
 			bool currentDrawIndexed = false;
@@ -596,21 +530,6 @@ namespace Renderer
 				QueuedRenderables& queuedRenderables = queue.queuedRenderables;
 				if (!queuedRenderables.empty())
 				{
-					// Sort queued renderables
-					if (!queue.sorted && mDoSort)
-					{
-						// TODO(co) Exploit temporal coherence across frames then use insertion sorts as explained by L. Spiro in
-						// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
-						// Keep a list of sorted indices from the previous frame (one per camera).
-						// If we have the sorted list "5, 1, 4, 3, 2, 0":
-						// * If it grew from last frame, append: 5, 1, 4, 3, 2, 0, 6, 7 and use insertion sort.
-						// * If it's the same, leave it as is, and use insertion sort just in case.
-						// * If it's shorter, reset the indices 0, 1, 2, 3, 4; probably use quicksort or other generic sort
-						// TODO(co) Use radix sort? ( https://www.quora.com/What-is-the-most-efficient-way-to-sort-a-million-32-bit-integers )
-						std::sort(queuedRenderables.begin(), queuedRenderables.end());
-						queue.sorted = true;
-					}
-
 					// Inject queued renderables into the RHI
 					for (const QueuedRenderable& queuedRenderable : queuedRenderables)
 					{
@@ -1003,6 +922,613 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	bool RenderQueue::gatherQueuedRenderables(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows, bool pipelineStateCacheUpdateAllowed, ShaderProperties& scratchShaderProperties, ShaderProperties& scratchOptimizedShaderProperties, QueuedRenderables& queuedRenderables) const
+	{
+		// Sanity check
+		SE_ASSERT(renderableManager.isVisible(), "Invalid renderable manager visibility")
+
+		// Contribution culling: Skip renderable managers which are too small on screen to contribute to this render queue
+		const float projectedRadius = renderableManager.getCachedProjectedRadius();
+		if (projectedRadius < mContributionSettings.minimumProjectedRadius)
+		{
+			return true;
+		}
+
+		// Sorting key bits
+		static constexpr uint32_t PIPELINE_STATE_NUMBER_OF_BITS	= 16;
+		static constexpr uint32_t VERTEX_ARRAY_NUMBER_OF_BITS	= 16;
+		static constexpr uint32_t RESOURCE_GROUP_NUMBER_OF_BITS	= 11;	// TODO(co) Add resource group sorting
+		static constexpr uint32_t DEPTH_NUMBER_OF_BITS			= 21;
+
+		// Sorting key bit shift: Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
+		static constexpr uint32_t PIPELINE_STATE_SHIFT_OPAQUE	= 64							- PIPELINE_STATE_NUMBER_OF_BITS;	// = 48
+		static constexpr uint32_t VERTEX_ARRAY_SHIFT_OPAQUE		= PIPELINE_STATE_SHIFT_OPAQUE	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 32
+		static constexpr uint32_t RESOURCE_GROUP_SHIFT_OPAQUE	= VERTEX_ARRAY_SHIFT_OPAQUE		- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 21
+		static constexpr uint32_t DEPTH_SHIFT_OPAQUE			= RESOURCE_GROUP_SHIFT_OPAQUE	- DEPTH_NUMBER_OF_BITS;				// = 0
+
+		// Sorting key transparent bit shift: Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
+		static constexpr uint32_t DEPTH_SHIFT_TRANSPARENT			= 64								- DEPTH_NUMBER_OF_BITS;				// = 43
+		static constexpr uint32_t PIPELINE_STATE_SHIFT_TRANSPARENT	= DEPTH_SHIFT_TRANSPARENT			- PIPELINE_STATE_NUMBER_OF_BITS;	// = 27
+		static constexpr uint32_t VERTEX_ARRAY_SHIFT_TRANSPARENT	= PIPELINE_STATE_SHIFT_TRANSPARENT	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 11
+		static constexpr uint32_t RESOURCE_GROUP_SHIFT_TRANSPARENT	= VERTEX_ARRAY_SHIFT_TRANSPARENT	- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 0
+
+		// Quantize the cached distance to camera
+		// -> Solid: Sort from front to back to benefit from early z rejection
+		// -> Transparent: Sort from back to front to have correct alpha blending
+		const uint32_t quantizedDepth = ::detail::depthToBits(mTransparentPass ? -renderableManager.getCachedDistanceToCamera() : renderableManager.getCachedDistanceToCamera(), DEPTH_NUMBER_OF_BITS);
+
+		// Select the LOD index by the projected bounding sphere radius, optionally adjust and check the LOD index
+		uint8_t lodIndex = 0;
+		while (lodIndex < MAXIMUM_NUMBER_OF_LOD_THRESHOLDS && projectedRadius < mContributionSettings.lodProjectedRadii[lodIndex])
+		{
+			++lodIndex;
+		}
+		lodIndex = std::max(lodIndex, mRenderer.getMeshResourceManager().getNumberOfTopMeshLodsToRemove());
+		SE_ASSERT(0 != renderableManager.getNumberOfLods(), "Invalid renderable manager which has no LODs: There must always be at least one LOD, namely the original none reduced version")
+		const uint8_t numberOfLods = renderableManager.getNumberOfLods();
+		if (lodIndex >= numberOfLods)
+		{
+			// Silently clamp to maximum LOD
+			lodIndex = static_cast<uint8_t>(static_cast<int>(numberOfLods) - 1);
+		}
+
+		// Progressive texture streaming residency feedback: The texture resolution needed by the renderable manager on screen
+		const TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
+		const uint32_t requiredTextureResolution = textureResourceManager.getRequiredTextureResolution(projectedRadius);
+
+		// Register the renderables inside our renderables queue
+		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
+		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
+		const bool singlePassStereoInstancing = compositorContextData.getSinglePassStereoInstancing();
+		const RenderableManager::Renderables& renderables = renderableManager.getRenderables();
+		const uint32_t numberOfRenderablesPerLod = static_cast<uint32_t>(renderables.size()) / numberOfLods;	// Each LOD has the same number of renderables
+		uint32_t renderableIndex = numberOfRenderablesPerLod * lodIndex;
+		uint32_t renderableEndIndex = renderableIndex + numberOfRenderablesPerLod;
+		for (; renderableIndex < renderableEndIndex; ++renderableIndex)
+		{
+			const Renderable& renderable = renderables[renderableIndex];
+			if (!castShadows || renderable.getCastShadows())
+			{
+				// It's valid if one or more renderables inside a renderable manager don't fall into the range processed by this render queue
+				// -> At least one renderable should fall into the range processed by this render queue or the render queue is used wrong
+				const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
+				if (renderQueueIndex >= mMinimumRenderQueueIndex && renderQueueIndex <= mMaximumRenderQueueIndex)
+				{
+					// Material resource
+					const MaterialResource* materialResource = materialResourceManager.tryGetById(renderable.getMaterialResourceId());
+					if (nullptr != materialResource)
+					{
+						MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
+						if (nullptr != materialTechnique)
+						{
+							materialTechnique->requestTextureResolution(textureResourceManager, requiredTextureResolution);
+							MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
+							if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
+							{
+								// Get the pipeline state object (PSO) to use, preferably by using cached information
+								Rhi::IPipelineState* foundPipelineState = nullptr;
+								if (IsValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
+								{
+									// Compute material blueprint resource
+
+									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
+									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
+
+									// Get the pipeline state object (PSO) to use, preferably by using cached information
+									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
+									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
+									{
+										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
+										{
+											if (generationCounter != pipelineStateCache.generationCounter)
+											{
+												if (!pipelineStateCacheUpdateAllowed)
+												{
+													return false;
+												}
+												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, scratchShaderProperties, scratchOptimizedShaderProperties);
+												const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(scratchOptimizedShaderProperties, false);
+
+												// As long as we received a fallback compute pipeline state cache, we can't update the renderable pipeline state cache
+												if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr() && !computePipelineStateCache->isUsingFallback())
+												{
+													pipelineStateCache.generationCounter = generationCounter;
+													pipelineStateCache.pipelineStatePtr = computePipelineStateCache->getComputePipelineStateObjectPtr();
+												}
+											}
+											foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCache.pipelineStatePtr->GetPointer());
+											SE_ASSERT(nullptr != foundPipelineState, "Invalid found compute pipeline state")
+											break;
+										}
+									}
+									if (nullptr == foundPipelineState)
+									{
+										if (!pipelineStateCacheUpdateAllowed)
+										{
+											return false;
+										}
+										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, scratchShaderProperties, scratchOptimizedShaderProperties);
+										const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(scratchOptimizedShaderProperties, false);
+										if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr())
+										{
+											// As long as we received a fallback compute pipeline state cache, we can't put it into the renderable pipeline state cache
+											if (computePipelineStateCache->isUsingFallback())
+											{
+												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(computePipelineStateCache->getComputePipelineStateObjectPtr());
+											}
+											else
+											{
+												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, computePipelineStateCache->getComputePipelineStateObjectPtr()).pipelineStatePtr.GetPointer());
+											}
+											SE_ASSERT(nullptr != foundPipelineState, "Invalid found compute pipeline state")
+										}
+									}
+								}
+								else
+								{
+									// Graphics material blueprint resource
+
+									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
+									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
+
+									// Get the pipeline state object (PSO) to use, preferably by using cached information
+									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
+									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
+									{
+										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
+										{
+											if (generationCounter != pipelineStateCache.generationCounter)
+											{
+												if (!pipelineStateCacheUpdateAllowed)
+												{
+													return false;
+												}
+												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, scratchShaderProperties, scratchOptimizedShaderProperties);
+												const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), scratchOptimizedShaderProperties, false);
+
+												// As long as we received a fallback graphics pipeline state cache, we can't update the renderable pipeline state cache
+												if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr() && !graphicsPipelineStateCache->isUsingFallback())
+												{
+													pipelineStateCache.generationCounter = generationCounter;
+													pipelineStateCache.pipelineStatePtr = graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr();
+												}
+											}
+											foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCache.pipelineStatePtr->GetPointer());
+											SE_ASSERT(nullptr != foundPipelineState, "Invalid found graphics pipeline state")
+											break;
+										}
+									}
+									if (nullptr == foundPipelineState)
+									{
+										if (!pipelineStateCacheUpdateAllowed)
+										{
+											return false;
+										}
+										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, scratchShaderProperties, scratchOptimizedShaderProperties);
+										const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), scratchOptimizedShaderProperties, false);
+										if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr())
+										{
+											// As long as we received a fallback graphics pipeline state cache, we can't put it into the renderable pipeline state cache
+											if (graphicsPipelineStateCache->isUsingFallback())
+											{
+												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr());
+											}
+											else
+											{
+												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr()).pipelineStatePtr.GetPointer());
+											}
+											SE_ASSERT(nullptr != foundPipelineState, "Invalid found graphics pipeline state")
+										}
+									}
+								}
+								if (nullptr != foundPipelineState)
+								{
+									const uint16_t pipelineStateId = foundPipelineState->getId();
+									const uint16_t resourceGroupId = 0;	// TODO(co) Add resource group sorting
+									const uint32_t vertexArrayId = mPositionOnlyPass ? ((nullptr != renderable.getPositionOnlyVertexArrayPtrWithFallback()) ? renderable.getPositionOnlyVertexArrayPtrWithFallback()->getId() : 0u) : ((nullptr != renderable.getVertexArrayPtr()) ? renderable.getVertexArrayPtr()->getId() : 0u);
+
+									// Define helper macros
+									#define RENDER_QUEUE_MAKE_MASK(x) ((1u << (x)) - 1u)
+									#define RENDER_QUEUE_HASH(x, bits, shift) (uint64_t((x) & RENDER_QUEUE_MAKE_MASK((bits))) << (shift))
+
+									// Generate the sorting key
+									uint64_t sortingKey;	// Guaranteed to be initialized below
+									if (mTransparentPass)
+									{
+										// Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
+										sortingKey =
+										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_TRANSPARENT)			|
+										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_TRANSPARENT)	|
+										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_TRANSPARENT)		|
+										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_TRANSPARENT);
+									}
+									else
+									{
+										// Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
+										sortingKey =
+										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_OPAQUE)	|
+										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_OPAQUE)		|
+										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_OPAQUE)	|
+										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_OPAQUE);
+									}
+
+									// Undefine helper macros
+									#undef RENDER_QUEUE_HASH
+									#undef RENDER_QUEUE_MAKE_MASK
+
+									// Gather the renderable, it's registered inside our renderables queue later on
+									queuedRenderables.emplace_back(renderable, *materialResource, *materialTechnique, *materialBlueprintResource, *foundPipelineState, sortingKey);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Done
+		return true;
+	}
+
+	void RenderQueue::insertQueuedRenderables(const QueuedRenderables& queuedRenderables)
+	{
+		for (const QueuedRenderable& queuedRenderable : queuedRenderables)
+		{
+			// Register the renderable inside our renderables queue
+			const Renderable& renderable = *queuedRenderable.renderable;
+			Queue& queue = mQueues[static_cast<size_t>(renderable.getRenderQueueIndex() - mMinimumRenderQueueIndex)];
+			SE_ASSERT(!queue.sorted, "Ensure render queue is still in filling state and not already in rendering state")
+			queue.queuedRenderables.push_back(queuedRenderable);
+			if (0 != renderable.getNumberOfIndices())
+			{
+				if (renderable.getDrawIndexed())
+				{
+					++mNumberOfDrawIndexedCalls;
+				}
+				else
+				{
+					++mNumberOfDrawCalls;
+				}
+			}
+			else
+			{
+				++mNumberOfNullDrawCalls;
+			}
+		}
+	}
+
+	void RenderQueue::sortQueues()
+	{
+		if (mDoSort)
+		{
+			for (Queue& queue : mQueues)
+			{
+				if (!queue.sorted && !queue.queuedRenderables.empty())
+				{
+					// TODO(co) Exploit temporal coherence across frames then use insertion sorts as explained by L. Spiro in
+					// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
+					// Keep a list of sorted indices from the previous frame (one per camera).
+					// If we have the sorted list "5, 1, 4, 3, 2, 0":
+					// * If it grew from last frame, append: 5, 1, 4, 3, 2, 0, 6, 7 and use insertion sort.
+					// * If it's the same, leave it as is, and use insertion sort just in case.
+					// * If it's shorter, reset the indices 0, 1, 2, 3, 4; probably use quicksort or other generic sort
+					// -> Stable sort so renderables with identical sorting keys keep their deterministic insertion order
+					::detail::radixSort(queue.queuedRenderables, mScratchQueuedRenderables);
+					queue.sorted = true;
+				}
+			}
+		}
+	}
+
+	void RenderQueue::fillGraphicsCommandBufferByRecordingRanges(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
+	{
+		// Sort queued renderables
+		sortQueues();
+
+		// Get relevant data
+		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		UniformInstanceBufferManager& uniformInstanceBufferManager = materialBlueprintResourceManager.getUniformInstanceBufferManager();
+		TextureInstanceBufferManager& textureInstanceBufferManager = materialBlueprintResourceManager.getTextureInstanceBufferManager();
+		LightBufferManager& lightBufferManager = materialBlueprintResourceManager.getLightBufferManager();
+		const uint32_t instanceCount = (compositorContextData.getSinglePassStereoInstancing() ? 2u : 1u);
+
+		// Get indirect buffer
+		Rhi::IIndirectBuffer* indirectBuffer = nullptr;
+		uint32_t indirectBufferOffset = 0;
+		uint8_t* indirectBufferData = nullptr;
+		if (mNumberOfDrawIndexedCalls > 0 || mNumberOfDrawCalls > 0 )
+		{
+			IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * mNumberOfDrawIndexedCalls + sizeof(Rhi::DrawArguments) * mNumberOfDrawCalls);
+			SE_ASSERT(nullptr != managedIndirectBuffer, "Invalid managed indirect buffer")
+			indirectBuffer		 = managedIndirectBuffer->indirectBuffer;
+			indirectBufferOffset = managedIndirectBuffer->indirectBufferOffset;
+			indirectBufferData   = managedIndirectBuffer->mappedData;
+		}
+
+		// Prepare pass: Serially process everything touching shared state in the order the serial command buffer filling would do it
+		// -> The pass, instance and light buffer managers as well as the material blueprint resource listener have a single fill cursor
+		//    and lazily create resource groups, the commands they emit are captured per renderable inside state command buffers
+		mPreparedRenderables.clear();
+		uint32_t numberOfUsedStateCommandBuffers = 0;
+		bool enforcePassBufferManagerFillBuffer = true;
+		std::array<Rhi::IResourceGroup*, 16> currentSetGraphicsResourceGroup = {};	// TODO(co) Use maximum number of graphics resource groups here, 16 is considered a save number of root parameters
+		for (const Queue& queue : mQueues)
+		{
+			for (const QueuedRenderable& queuedRenderable : queue.queuedRenderables)
+			{
+				SE_ASSERT(nullptr != queuedRenderable.renderable, "Invalid renderable")
+
+				// Get queued renderable data
+				const Renderable&				 renderable				   = *queuedRenderable.renderable;
+				const MaterialResource&			 materialResource		   = *queuedRenderable.materialResource;
+					  MaterialTechnique&		 materialTechnique		   = *queuedRenderable.materialTechnique;
+					  MaterialBlueprintResource& materialBlueprintResource = *queuedRenderable.materialBlueprintResource;
+
+				// Expensive state change: Handle material blueprint resource switches
+				bool bindMaterialBlueprint = false;
+				PassBufferManager* passBufferManager = nullptr;
+				const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer = materialBlueprintResource.getInstanceUniformBuffer();
+				const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer = materialBlueprintResource.getInstanceTextureBuffer();
+				if (compositorContextData.mCurrentlyBoundMaterialBlueprintResource != &materialBlueprintResource)
+				{
+					compositorContextData.mCurrentlyBoundMaterialBlueprintResource = &materialBlueprintResource;
+					std::fill(currentSetGraphicsResourceGroup.begin(), currentSetGraphicsResourceGroup.end(), nullptr);
+					bindMaterialBlueprint = true;
+				}
+				if (bindMaterialBlueprint || enforcePassBufferManagerFillBuffer)
+				{
+					// Fill the pass buffer manager
+					passBufferManager = materialBlueprintResource.getPassBufferManager();
+					if (nullptr != passBufferManager)
+					{
+						passBufferManager->fillBuffer(&renderTarget, compositorContextData, materialResource);
+						enforcePassBufferManagerFillBuffer = false;
+					}
+				}
+				if (bindMaterialBlueprint)
+				{
+					// Bind the graphics material blueprint resource and instance and light buffer manager to the used RHI
+					materialBlueprintResource.fillGraphicsCommandBuffer(mScratchCommandBuffer);
+					if (nullptr != instanceTextureBuffer)
+					{
+						SE_ASSERT(nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
+						textureInstanceBufferManager.startupBufferFilling(materialBlueprintResource, mScratchCommandBuffer);
+					}
+					else if (nullptr != instanceUniformBuffer)
+					{
+						uniformInstanceBufferManager.startupBufferFilling(materialBlueprintResource, mScratchCommandBuffer);
+					}
+					lightBufferManager.fillGraphicsCommandBuffer(materialBlueprintResource, mScratchCommandBuffer);
+				}
+				else if (nullptr != passBufferManager)
+				{
+					// Bind pass buffer manager since we filled the buffer
+					passBufferManager->fillGraphicsCommandBuffer(mScratchCommandBuffer);
+				}
+
+				{ // Cheap state change: Bind the material technique to the used RHI
+					uint32_t resourceGroupRootParameterIndex = GetInvalid<uint32_t>();
+					Rhi::IResourceGroup* resourceGroup = nullptr;
+					materialTechnique.fillGraphicsCommandBuffer(mRenderer, mScratchCommandBuffer, resourceGroupRootParameterIndex, &resourceGroup);
+					if (IsValid(resourceGroupRootParameterIndex) && nullptr != resourceGroup && currentSetGraphicsResourceGroup[resourceGroupRootParameterIndex] != resourceGroup)
+					{
+						currentSetGraphicsResourceGroup[resourceGroupRootParameterIndex] = resourceGroup;
+						Rhi::Command::SetGraphicsResourceGroup::create(mScratchCommandBuffer, resourceGroupRootParameterIndex, resourceGroup);
+					}
+				}
+
+				// Fill the instance buffer manager
+				PreparedRenderable preparedRenderable;
+				preparedRenderable.queuedRenderable = &queuedRenderable;
+				preparedRenderable.startInstanceLocation = 0;
+				preparedRenderable.indirectBufferOffset = indirectBufferOffset;
+				if (nullptr != instanceTextureBuffer)
+				{
+					SE_ASSERT(nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
+					preparedRenderable.startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
+				}
+				else if (nullptr != instanceUniformBuffer)
+				{
+					preparedRenderable.startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, mScratchCommandBuffer);
+				}
+
+				// Move the captured state commands into a state command buffer
+				if (mScratchCommandBuffer.isEmpty())
+				{
+					SetInvalid(preparedRenderable.stateCommandBufferIndex);
+				}
+				else
+				{
+					if (mStateCommandBuffers.size() <= numberOfUsedStateCommandBuffers)
+					{
+						mStateCommandBuffers.push_back(new Rhi::CommandBuffer());
+					}
+					preparedRenderable.stateCommandBufferIndex = numberOfUsedStateCommandBuffers;
+					mScratchCommandBuffer.submitToCommandBufferAndClear(*mStateCommandBuffers[numberOfUsedStateCommandBuffers]);
+					++numberOfUsedStateCommandBuffers;
+				}
+
+				// Reserve the draw arguments inside the managed indirect buffer
+				if (nullptr == renderable.getIndirectBufferPtr() && 0 != renderable.getNumberOfIndices())
+				{
+					indirectBufferOffset += renderable.getDrawIndexed() ? static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments)) : static_cast<uint32_t>(sizeof(Rhi::DrawArguments));
+				}
+				mPreparedRenderables.push_back(preparedRenderable);
+			}
+		}
+
+		// Record pass: Each recording range covers a fixed range of prepared renderables and is only written by the thread processing this range
+		const uint32_t numberOfPreparedRenderables = static_cast<uint32_t>(mPreparedRenderables.size());
+		const uint32_t numberOfRecordingRanges = (numberOfPreparedRenderables + NUMBER_OF_QUEUED_RENDERABLES_PER_RECORDING_RANGE - 1) / NUMBER_OF_QUEUED_RENDERABLES_PER_RECORDING_RANGE;
+		const uint32_t firstRecordingCommandBufferIndex = mNumberOfUsedRecordingCommandBuffers;
+		mNumberOfUsedRecordingCommandBuffers += numberOfRecordingRanges;
+		while (mRecordingCommandBuffers.size() < mNumberOfUsedRecordingCommandBuffers)
+		{
+			mRecordingCommandBuffers.push_back(new Rhi::CommandBuffer());
+		}
+		const CompositorWorkspaceInstance* compositorWorkspaceInstance = compositorContextData.getCompositorWorkspaceInstance();
+		const bool optimizeCommandBuffers = (nullptr != compositorWorkspaceInstance && compositorWorkspaceInstance->getOptimizeCommandBuffer());
+		mRenderer.getJobSystem().parallelFor(numberOfRecordingRanges, 1, [this, indirectBuffer, indirectBufferData, instanceCount, numberOfPreparedRenderables, firstRecordingCommandBufferIndex, optimizeCommandBuffers](uint32_t startRecordingRangeIndex, uint32_t endRecordingRangeIndex)
+		{
+			for (uint32_t recordingRangeIndex = startRecordingRangeIndex; recordingRangeIndex < endRecordingRangeIndex; ++recordingRangeIndex)
+			{
+				Rhi::CommandBuffer& recordingCommandBuffer = *mRecordingCommandBuffers[firstRecordingCommandBufferIndex + recordingRangeIndex];
+				recordingCommandBuffer.clear();
+				const uint32_t startIndex = recordingRangeIndex * NUMBER_OF_QUEUED_RENDERABLES_PER_RECORDING_RANGE;
+				const uint32_t endIndex = std::min(startIndex + NUMBER_OF_QUEUED_RENDERABLES_PER_RECORDING_RANGE, numberOfPreparedRenderables);
+				recordPreparedRenderables(startIndex, endIndex, indirectBuffer, indirectBufferData, instanceCount, recordingCommandBuffer);
+
+				// The filled command buffer doesn't look into executed command buffers, so optimize the recording command buffer right here
+				if (optimizeCommandBuffers)
+				{
+					recordingCommandBuffer.optimize(mRenderer.getRhi());
+				}
+			}
+		});
+
+		// Stitch the recording command buffers in order into the given command buffer
+		for (uint32_t recordingRangeIndex = 0; recordingRangeIndex < numberOfRecordingRanges; ++recordingRangeIndex)
+		{
+			Rhi::CommandBuffer* recordingCommandBuffer = mRecordingCommandBuffers[firstRecordingCommandBufferIndex + recordingRangeIndex];
+			if (!recordingCommandBuffer->isEmpty())
+			{
+				Rhi::Command::ExecuteCommandBuffer::create(commandBuffer, recordingCommandBuffer);
+			}
+		}
+
+		// The state commands have been copied into the recording command buffers, so the state command buffers can be reused by the next fill call
+		for (uint32_t i = 0; i < numberOfUsedStateCommandBuffers; ++i)
+		{
+			mStateCommandBuffers[i]->clear();
+		}
+	}
+
+	void RenderQueue::recordPreparedRenderables(uint32_t startIndex, uint32_t endIndex, Rhi::IIndirectBuffer* indirectBuffer, uint8_t* indirectBufferData, uint32_t instanceCount, Rhi::CommandBuffer& commandBuffer) const
+	{
+		// Track currently bound RHI resources and states to void generating redundant commands, start from scratch since the previous range is recorded by another thread
+		bool vertexArraySet = false;
+		Rhi::IVertexArray* currentVertexArray = nullptr;
+		Rhi::IGraphicsPipelineState* currentGraphicsPipelineState = nullptr;
+
+		// For gathering multi-draw-indirect data, multi-draw-indirect batches don't cross range boundaries
+		uint32_t currentDrawIndirectBufferOffset = mPreparedRenderables[startIndex].indirectBufferOffset;
+		uint32_t currentNumberOfDraws = 0;
+		bool currentDrawIndexed = false;
+
+		for (uint32_t i = startIndex; i < endIndex; ++i)
+		{
+			// Get prepared renderable data
+			const PreparedRenderable&		   preparedRenderable		  = mPreparedRenderables[i];
+			const Renderable&				   renderable				  = *preparedRenderable.queuedRenderable->renderable;
+				  Rhi::IGraphicsPipelineState& foundGraphicsPipelineState = *static_cast<Rhi::IGraphicsPipelineState*>(preparedRenderable.queuedRenderable->foundPipelineState);
+			const Rhi::IVertexArrayPtr&		   vertexArrayPtr			  = mPositionOnlyPass ? renderable.getPositionOnlyVertexArrayPtrWithFallback() : renderable.getVertexArrayPtr();
+
+			// Emit draw command, if necessary
+			// -> Same rules as the serial command buffer filling: State changes end the current multi-draw-indirect batch
+			const bool setGraphicsPipelineState = (currentGraphicsPipelineState != &foundGraphicsPipelineState);
+			const bool setVertexArray = (!vertexArraySet || currentVertexArray != vertexArrayPtr);
+			const Rhi::IIndirectBufferPtr& renderableIndirectBufferPtr = renderable.getIndirectBufferPtr();
+			if (renderable.getDrawIndexed() != currentDrawIndexed || setGraphicsPipelineState || setVertexArray || IsValid(preparedRenderable.stateCommandBufferIndex) || nullptr != renderableIndirectBufferPtr)
+			{
+				if (currentNumberOfDraws)
+				{
+					if (currentDrawIndexed)
+					{
+						Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+					}
+					else
+					{
+						Rhi::Command::DrawGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+					}
+					currentNumberOfDraws = 0;
+				}
+				currentDrawIndirectBufferOffset = preparedRenderable.indirectBufferOffset;
+			}
+
+			// Set the used graphics pipeline state object (PSO)
+			if (setGraphicsPipelineState)
+			{
+				currentGraphicsPipelineState = &foundGraphicsPipelineState;
+				Rhi::Command::SetGraphicsPipelineState::create(commandBuffer, currentGraphicsPipelineState);
+			}
+
+			// Setup input assembly (IA): Set the used vertex array
+			if (setVertexArray)
+			{
+				vertexArraySet = true;
+				currentVertexArray = vertexArrayPtr;
+				Rhi::Command::SetGraphicsVertexArray::create(commandBuffer, currentVertexArray);
+			}
+
+			// Inject the state commands captured by the prepare pass, state command buffers are only read in here
+			if (IsValid(preparedRenderable.stateCommandBufferIndex))
+			{
+				mStateCommandBuffers[preparedRenderable.stateCommandBufferIndex]->submitToCommandBuffer(commandBuffer);
+			}
+
+			// Render the specified geometric primitive, based on indexing into an array of vertices
+			if (nullptr != renderableIndirectBufferPtr)
+			{
+				// Use a given indirect buffer which content is e.g. filled by a compute shader
+				if (renderable.getDrawIndexed())
+				{
+					Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+				}
+				else
+				{
+					Rhi::Command::DrawGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+				}
+			}
+			// Please note that it's valid that there are no indices, for example "Renderer::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
+			else if (0 != renderable.getNumberOfIndices())
+			{
+				// Sanity checks
+				SE_ASSERT(nullptr != indirectBuffer, "Invalid indirect buffer")
+				SE_ASSERT(nullptr != indirectBufferData, "Invalid indirect buffer data")
+
+				// Fill indirect buffer, the prepare pass reserved a distinct location for each renderable so ranges never write to the same memory
+				if (renderable.getDrawIndexed())
+				{
+					Rhi::DrawIndexedArguments* drawIndexedArguments = reinterpret_cast<Rhi::DrawIndexedArguments*>(indirectBufferData + preparedRenderable.indirectBufferOffset);
+					drawIndexedArguments->indexCountPerInstance	= renderable.getNumberOfIndices();
+					drawIndexedArguments->instanceCount			= instanceCount * renderable.getInstanceCount();
+					drawIndexedArguments->startIndexLocation	= renderable.getStartIndexLocation();
+					drawIndexedArguments->baseVertexLocation	= 0;
+					drawIndexedArguments->startInstanceLocation	= preparedRenderable.startInstanceLocation;
+					currentDrawIndexed = true;
+				}
+				else
+				{
+					Rhi::DrawArguments* drawArguments = reinterpret_cast<Rhi::DrawArguments*>(indirectBufferData + preparedRenderable.indirectBufferOffset);
+					drawArguments->vertexCountPerInstance = renderable.getNumberOfIndices();
+					drawArguments->instanceCount		  = instanceCount * renderable.getInstanceCount();
+					drawArguments->startVertexLocation	  = renderable.getStartIndexLocation();
+					drawArguments->startInstanceLocation  = preparedRenderable.startInstanceLocation;
+					currentDrawIndexed = false;
+				}
+				++currentNumberOfDraws;
+			}
+		}
+
+		// Emit last open draw command, if necessary
+		if (currentNumberOfDraws)
+		{
+			if (currentDrawIndexed)
+			{
+				Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+			}
+			else
+			{
+				Rhi::Command::DrawGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
+			}
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -43,6 +43,27 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint8_t MAXIMUM_NUMBER_OF_LOD_THRESHOLDS = 7;	// Maximum number of LOD thresholds, one less than the maximum number of selectable LODs
+		/**
+		*  @brief
+		*    Contribution culling and level of detail (LOD) selection settings
+		*
+		*  @remarks
+		*    The settings work on the projected bounding sphere radius in pixels which is cached inside the renderable managers during culling,
+		*    see "Renderer::RenderableManager::getCachedProjectedRadius()". Each compositor pass can use its own settings, for example a shadow
+		*    map pass can switch to a coarser LOD earlier than the main scene pass.
+		*/
+		struct ContributionSettings final
+		{
+			float minimumProjectedRadius = 0.0f;							// Renderable managers with a smaller projected bounding sphere radius in pixels are skipped, 0 to render everything which survived the culling
+			float lodProjectedRadii[MAXIMUM_NUMBER_OF_LOD_THRESHOLDS] = {};	// LOD "n + 1" is used for projected bounding sphere radii in pixels below "lodProjectedRadii[n]", must be descending, 0 for unused thresholds
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -66,10 +87,7 @@ namespace Renderer
 		*/
 		RenderQueue(IndirectBufferManager& indirectBufferManager, uint8_t minimumRenderQueueIndex, uint8_t maximumRenderQueueIndex, bool positionOnlyPass, bool transparentPass, bool doSort);
 
-		inline ~RenderQueue()
-		{
-			// Nothing here
-		}
+		~RenderQueue();
 
 		[[nodiscard]] inline uint32_t getNumberOfDrawCalls() const
 		{
@@ -86,18 +104,66 @@ namespace Renderer
 			return mMaximumRenderQueueIndex;
 		}
 
+		[[nodiscard]] inline const ContributionSettings& getContributionSettings() const
+		{
+			return mContributionSettings;
+		}
+
+		inline void setContributionSettings(const ContributionSettings& contributionSettings)
+		{
+			mContributionSettings = contributionSettings;
+		}
+
 		void clear();
 		void addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
-		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
-		void fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 
+		/**
+		*  @brief
+		*    Add the renderables of multiple renderable managers, multi-threaded
+		*
+		*  @param[in] renderableManagers
+		*    Renderable managers to add the renderables from
+		*  @param[in] materialTechniqueId
+		*    Material technique ID
+		*  @param[in] compositorContextData
+		*    Compositor context data
+		*  @param[in] castShadows
+		*    "true" to only add renderables which cast shadows, else "false"
+		*
+		*  @remarks
+		*    The renderable managers are split into fixed ranges which are processed by the job system into one fill bucket per range, the fill
+		*    buckets are merged in order afterwards. Renderable managers which need a pipeline state cache update are deferred and processed
+		*    serially after the merge. The result is identical regardless of the number of threads.
+		*
+		*  @note
+		*    - Must be called by a job system thread
+		*/
+		void addRenderablesFromRenderableManagers(const std::vector<RenderableManager*>& renderableManagers, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit RenderQueue(const RenderQueue&) = delete;
-		RenderQueue& operator=(const RenderQueue&) = delete;
+		/**
+		*  @brief
+		*    Fill the sorted renderables into a graphics command buffer
+		*
+		*  @param[in] renderTarget
+		*    Render target to render into
+		*  @param[in] compositorContextData
+		*    Compositor context data
+		*  @param[out] commandBuffer
+		*    Command buffer to fill
+		*
+		*  @remarks
+		*    Large render queues are recorded multi-threaded: A serial prepare pass processes everything touching shared state (pass, instance and
+		*    light buffer managers, material resource groups, indirect buffer offsets), afterwards fixed contiguous ranges of the sorted renderables are
+		*    recorded by the job system into secondary command buffers owned by the render queue. The secondary command buffers are stitched in order
+		*    into the given command buffer via "Rhi::Command::ExecuteCommandBuffer", so the result doesn't depend on the number of threads.
+		*
+		*  @note
+		*    - Must be called by a job system thread
+		*    - The secondary command buffers stay valid until "Renderer::RenderQueue::clear()" is called, so the given command buffer must have been executed before
+		*/
+		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
+
+		void fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 
 
 	//[-------------------------------------------------------]
@@ -143,6 +209,72 @@ namespace Renderer
 		};
 		typedef std::vector<Queue> Queues;
 
+		static constexpr uint32_t NUMBER_OF_RENDERABLE_MANAGERS_PER_FILL_BUCKET = 256;	// Fixed range size, must not depend on the number of threads to keep the result deterministic
+		struct FillBucket final
+		{
+			QueuedRenderables				queuedRenderables;				// Queued renderables of all render queue indices, in renderable manager order
+			std::vector<RenderableManager*>	deferredRenderableManagers;		// Renderable managers which need a pipeline state cache update, processed serially
+			ShaderProperties				scratchShaderProperties;
+			ShaderProperties				scratchOptimizedShaderProperties;
+		};
+		typedef std::vector<FillBucket> FillBuckets;
+
+		static constexpr uint32_t MINIMUM_NUMBER_OF_QUEUED_RENDERABLES_FOR_RECORDING_RANGES = 1024;	// Below this number of queued renderables the command buffer is filled serially
+		static constexpr uint32_t NUMBER_OF_QUEUED_RENDERABLES_PER_RECORDING_RANGE = 512;			// Fixed range size, must not depend on the number of threads to keep the result deterministic
+		/**
+		*  @brief
+		*    Result of the serial prepare pass for a single queued renderable, everything a recording range needs without touching shared state
+		*/
+		struct PreparedRenderable final
+		{
+			const QueuedRenderable* queuedRenderable;			// Always valid, don't destroy the instance
+			uint32_t				stateCommandBufferIndex;	// Index of the state command buffer holding the commands emitted by the buffer managers and the material technique for this renderable, invalid if there are none
+			uint32_t				startInstanceLocation;
+			uint32_t				indirectBufferOffset;		// Indirect buffer offset the draw arguments of this renderable are written to, only used if the renderable uses the managed indirect buffer
+		};
+		typedef std::vector<PreparedRenderable> PreparedRenderables;
+		typedef std::vector<Rhi::CommandBuffer*> CommandBuffers;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit RenderQueue(const RenderQueue&) = delete;
+		RenderQueue& operator=(const RenderQueue&) = delete;
+
+		/**
+		*  @brief
+		*    Gather the queued renderables of a renderable manager without touching the render queue state
+		*
+		*  @param[in] pipelineStateCacheUpdateAllowed
+		*    "true" if pipeline state caches can be updated, else "false" (thread safe mode)
+		*
+		*  @return
+		*    "false" if a pipeline state cache update would have been required but isn't allowed, the gathered queued renderables of the renderable manager are incomplete in this case
+		*/
+		[[nodiscard]] bool gatherQueuedRenderables(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows, bool pipelineStateCacheUpdateAllowed, ShaderProperties& scratchShaderProperties, ShaderProperties& scratchOptimizedShaderProperties, QueuedRenderables& queuedRenderables) const;
+
+		void insertQueuedRenderables(const QueuedRenderables& queuedRenderables);
+		void sortQueues();
+
+		/**
+		*  @brief
+		*    Multi-threaded version of "Renderer::RenderQueue::fillGraphicsCommandBuffer()", see its documentation for details
+		*/
+		void fillGraphicsCommandBufferByRecordingRanges(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
+
+		/**
+		*  @brief
+		*    Record a contiguous range of prepared renderables into a secondary command buffer, thread safe
+		*
+		*  @remarks
+		*    The graphics pipeline state and vertex array are always set at the start of a range since the previous range is recorded by another
+		*    thread. Resource groups don't need to be set again: They're part of the state commands, and secondary command buffers are executed
+		*    in order by the RHI so the bindings of the previous range are still active.
+		*/
+		void recordPreparedRenderables(uint32_t startIndex, uint32_t endIndex, Rhi::IIndirectBuffer* indirectBuffer, uint8_t* indirectBufferData, uint32_t instanceCount, Rhi::CommandBuffer& commandBuffer) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -159,9 +291,16 @@ namespace Renderer
 		bool					mPositionOnlyPass;
 		bool					mTransparentPass;
 		bool					mDoSort;
+		ContributionSettings	mContributionSettings;
 		// Scratch buffers to reduce dynamic memory allocations
 		Rhi::CommandBuffer		mScratchCommandBuffer;
 		ShaderProperties		mScratchShaderProperties;
 		ShaderProperties		mScratchOptimizedShaderProperties;
+		QueuedRenderables		mScratchQueuedRenderables;
+		FillBuckets				mFillBuckets;				// Used by multi-threaded renderable managers adding
+		PreparedRenderables		mPreparedRenderables;		// Used by multi-threaded command buffer recording
+		CommandBuffers			mStateCommandBuffers;		// Used by multi-threaded command buffer recording, only needed during a fill call, we own the instances so destroy them if no longer needed
+		CommandBuffers			mRecordingCommandBuffers;	// Used by multi-threaded command buffer recording, executed by the filled command buffer, we own the instances so destroy them if no longer needed
+		uint32_t				mNumberOfUsedRecordingCommandBuffers;	// Recording command buffers referenced by filled command buffers, reset by "Renderer::RenderQueue::clear()"
 	};
 } // Renderer
\ No newline at end of file
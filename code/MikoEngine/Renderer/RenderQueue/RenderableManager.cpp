@@ -44,6 +44,7 @@ namespace Renderer
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
 		mCachedDistanceToCamera(GetInvalid<float>()),
+		mCachedProjectedRadius(std::numeric_limits<float>::max()),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
 		mCastShadows(false)
@@ -130,6 +130,16 @@ namespace Renderer
 			mCachedDistanceToCamera = distanceToCamera;
 		}
 
+		[[nodiscard]] inline float getCachedProjectedRadius() const
+		{
+			return mCachedProjectedRadius;
+		}
+
+		inline void setCachedProjectedRadius(float projectedRadius)
+		{
+			mCachedProjectedRadius = projectedRadius;
+		}
+
 		/**
 		*  @brief
 		*    Return the minimum renderables render queue index (inclusive)
@@ -210,6 +220,7 @@ namespace Renderer
 		bool			 mVisible;
 		// Cached data
 		float			 mCachedDistanceToCamera;	// Cached distance to camera is updated during the culling phase
+		float			 mCachedProjectedRadius;	// Cached projected bounding sphere radius in pixels is updated during the culling phase, used for contribution culling and LOD selection
 		uint8_t			 mMinimumRenderQueueIndex;	// The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		uint8_t			 mMaximumRenderQueueIndex;	// The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		bool			 mCastShadows;				// "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
@@ -4,7 +4,7 @@
 #include "Core/File/MemoryFile.h"
 #include "Renderer/Core/Time/TimeManager.h"
 #include "Core/File/IFileManager.h"
-#include "Renderer/Core/Thread/ThreadPool.h"
+#include "Renderer/Core/Thread/JobSystem.h"
 #include "Renderer/Resource/ResourceStreamer.h"
 #include "Renderer/Resource/RendererResourceManager.h"
 #include "Renderer/Resource/Mesh/MeshResourceManager.h"
@@ -60,7 +60,7 @@ namespace
 		namespace PipelineStateCache
 		{
 			static constexpr uint32_t FORMAT_TYPE	 = SE_STRING_ID("PipelineStateCache");
-			static constexpr uint32_t FORMAT_VERSION = 1;
+			static constexpr uint32_t FORMAT_VERSION = 3;
 		}
 
 
@@ -154,7 +154,8 @@ namespace Renderer
 		mFileManager = &context.getFileManager();
 
 		// Create the core manager instances
-		mDefaultThreadPool = new DefaultThreadPool();
+		// -> The job system leaves a quarter of the hardware threads to the asynchronous resource streamer stages, which size their worker thread pools from what's left
+		mJobSystem = new JobSystem(GetInvalid<uint32_t>(), std::max(std::thread::hardware_concurrency() / 4, 1u));
 		mAssetManager = new AssetManager(*this);
 		mTimeManager = new TimeManager();
 
@@ -235,7 +236,7 @@ namespace Renderer
 		// Destroy the core manager instances
 		delete mTimeManager;
 		delete mAssetManager;
-		delete mDefaultThreadPool;
+		delete mJobSystem;
 
 		// Release the texture and buffer manager instance
 		mTextureManager->ReleaseReference();
@@ -343,6 +344,21 @@ namespace Renderer
 		}
 	}
 
+	float RendererImpl::getPipelineStateObjectCacheWarmUpProgress() const
+	{
+		// The in flight compiler requests might include a few compiler requests which aren't part of the warm-up, hence the clamping
+		const uint32_t numberOfGraphicsWarmUpCompilerRequests = mGraphicsPipelineStateCompiler->getNumberOfWarmUpCompilerRequests();
+		const uint32_t numberOfComputeWarmUpCompilerRequests = mComputePipelineStateCompiler->getNumberOfWarmUpCompilerRequests();
+		const uint32_t numberOfWarmUpCompilerRequests = numberOfGraphicsWarmUpCompilerRequests + numberOfComputeWarmUpCompilerRequests;
+		if (0 == numberOfWarmUpCompilerRequests)
+		{
+			// No warm-up in progress
+			return 1.0f;
+		}
+		const uint32_t numberOfPendingWarmUpCompilerRequests = std::min(mGraphicsPipelineStateCompiler->getNumberOfInFlightCompilerRequests(), numberOfGraphicsWarmUpCompilerRequests) + std::min(mComputePipelineStateCompiler->getNumberOfInFlightCompilerRequests(), numberOfComputeWarmUpCompilerRequests);
+		return static_cast<float>(numberOfWarmUpCompilerRequests - numberOfPendingWarmUpCompilerRequests) / static_cast<float>(numberOfWarmUpCompilerRequests);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual RefCount methods               ]
@@ -81,6 +81,7 @@ namespace Renderer
 		virtual void clearPipelineStateObjectCache() override;
 		virtual void loadPipelineStateObjectCache() override;
 		virtual void savePipelineStateObjectCache() override;
+		[[nodiscard]] virtual float getPipelineStateObjectCacheWarmUpProgress() const override;
 
 
 	//[-------------------------------------------------------]
@@ -3,6 +3,10 @@
 #include "Renderer/Resource/CompositorNode/CompositorTarget.h"
 #include "Renderer/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "Renderer/Resource/CompositorNode/Pass/ICompositorResourcePass.h"
+#include "Renderer/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
+#include "Renderer/Core/IProfiler.h"
+#include "Renderer/IRenderer.h"
+#include "Renderer/Context.h"
 
 #include <limits>
 
@@ -67,7 +71,30 @@ namespace Renderer
 				}
 
 				// Let the compositor instance pass fill the command buffer
-				compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				if (compositorInstancePass->isCommandBufferCacheable())
+				{
+					// Record the frame-persistent command buffer, if necessary
+					if (compositorInstancePass->mCachedCommandBuffer.isEmpty() || compositorInstancePass->mCachedRenderTarget != currentRenderTarget || !compositorInstancePass->isCachedCommandBufferValid())
+					{
+						compositorInstancePass->invalidateCachedCommandBuffer();
+						compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, compositorInstancePass->mCachedCommandBuffer);
+						compositorInstancePass->mCachedRenderTarget = currentRenderTarget;
+					}
+
+					// Replay the cached command buffer, an empty one is recorded again during the next execution
+					if (!compositorInstancePass->mCachedCommandBuffer.isEmpty())
+					{
+						// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
+						RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(mCompositorWorkspaceInstance.getRenderer().getContext(), commandBuffer, compositorResourcePass.getDebugName())
+
+						// Execute the cached command buffer
+						Rhi::Command::ExecuteCommandBuffer::create(commandBuffer, &compositorInstancePass->mCachedCommandBuffer);
+					}
+				}
+				else
+				{
+					compositorInstancePass->onFillCommandBuffer(currentRenderTarget, compositorContextData, commandBuffer);
+				}
 			}
 
 			// Update the number of compositor instance pass execution requests and don't forget to avoid integer range overflow
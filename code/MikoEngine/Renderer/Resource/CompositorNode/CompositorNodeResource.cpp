@@ -17,14 +17,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	void CompositorNodeResource::enforceFullyLoaded()
 	{
-		// TODO(co) Implement more efficient solution: We need to extend "Renderer::ResourceStreamer" to request emergency immediate processing of requested resources
-		ResourceStreamer& resourceStreamer = getResourceManager<CompositorNodeResourceManager>().getRenderer().getResourceStreamer();
-		while (IResource::LoadingState::LOADED != getLoadingState())
-		{
-			using namespace std::chrono_literals;
-			std::this_thread::sleep_for(1ms);
-			resourceStreamer.dispatch();
-		}
+		getResourceManager<CompositorNodeResourceManager>().getRenderer().getResourceStreamer().enforceFullyLoaded(*this);
 	}
 
 
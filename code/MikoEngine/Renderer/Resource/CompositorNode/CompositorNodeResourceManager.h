@@ -19,7 +19,7 @@ namespace Renderer
 	class CompositorNodeResource;
 	class RenderTargetTextureManager;
 	class CompositorNodeResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 }
 
 
@@ -58,7 +58,7 @@ namespace Renderer
 			return mRenderer;
 		}
 
-		void loadCompositorNodeResourceByAssetId(AssetId assetId, CompositorNodeResourceId& compositorNodeResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>());	// Asynchronous
+		void loadCompositorNodeResourceByAssetId(AssetId assetId, CompositorNodeResourceId& compositorNodeResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>(), ResourceLoadPriority priority = ResourceLoadPriority::PREFETCH);	// Asynchronous
 		void setInvalidResourceId(CompositorNodeResourceId& compositorNodeResourceId, IResourceListener& resourceListener) const;
 
 		[[nodiscard]] inline const ICompositorPassFactory& getCompositorPassFactory() const
@@ -22,11 +22,9 @@ namespace Renderer
 		// Sanity check
 		SE_ASSERT(nullptr != renderTarget, "The clear compositor instance pass needs a valid render target")
 
-		// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
-		const CompositorResourcePassClear& compositorResourcePassClear = static_cast<const CompositorResourcePassClear&>(getCompositorResourcePass());
-		RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), commandBuffer, compositorResourcePassClear.getDebugName())
-
 		// Push the clear graphics command
+		// -> The command buffer is cached, the compositor node instance emits the combined scoped profiler event when replaying it
+		const CompositorResourcePassClear& compositorResourcePassClear = static_cast<const CompositorResourcePassClear&>(getCompositorResourcePass());
 		Rhi::Command::ClearGraphics::create(commandBuffer, compositorResourcePassClear.getFlags(), glm::value_ptr(compositorResourcePassClear.getClearColor()), compositorResourcePassClear.getZ(), compositorResourcePassClear.getStencil());
 	}
 
@@ -21,6 +21,15 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
+	bool CompositorInstancePassCopy::isCachedCommandBufferValid() const
+	{
+		// The texture resources might have been destroyed or reloaded since the cached command buffer has been recorded
+		const TextureResourceManager& textureResourceManager = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager();
+		const TextureResource* destinationTextureResource = static_cast<const TextureResource*>(textureResourceManager.tryGetResourceByResourceId(mDestinationTextureResourceId));
+		const TextureResource* sourceTextureResource = static_cast<const TextureResource*>(textureResourceManager.tryGetResourceByResourceId(mSourceTextureResourceId));
+		return (nullptr != destinationTextureResource && nullptr != sourceTextureResource && destinationTextureResource->getTexturePtr().GetPointer() == mDestinationTexture && sourceTextureResource->getTexturePtr().GetPointer() == mSourceTexture);
+	}
+
 	void CompositorInstancePassCopy::onFillCommandBuffer([[maybe_unused]] const Rhi::IRenderTarget* renderTarget, const CompositorContextData&, Rhi::CommandBuffer& commandBuffer)
 	{
 		const CompositorResourcePassCopy& compositorResourcePassCopy = static_cast<const CompositorResourcePassCopy&>(getCompositorResourcePass());
@@ -29,10 +38,8 @@ namespace Renderer
 		// Sanity check
 		SE_ASSERT(nullptr == renderTarget, "The copy compositor instance pass needs an invalid render target")
 
-		// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
-		RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, compositorResourcePassCopy.getDebugName())
-
 		// Get destination and source texture resources
+		// -> The command buffer is cached, the compositor node instance emits the combined scoped profiler event when replaying it
 		// TODO(co) "Renderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
 		const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
 		const TextureResource* destinationTextureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassCopy.getDestinationTextureAssetId());
@@ -43,6 +50,13 @@ namespace Renderer
 			const Rhi::ITexturePtr& sourceTexturePtr = sourceTextureResource->getTexturePtr();
 			if (nullptr != destinationTexturePtr && nullptr != sourceTexturePtr)
 			{
+				// Remember the referenced textures so the cached command buffer can be validated
+				mDestinationTextureResourceId = destinationTextureResource->getId();
+				mSourceTextureResourceId = sourceTextureResource->getId();
+				mDestinationTexture = destinationTexturePtr;
+				mSourceTexture = sourceTexturePtr;
+
+				// Copy resource
 				Rhi::Command::CopyResource::create(commandBuffer, *destinationTexturePtr, *sourceTexturePtr);
 			}
 			else
@@ -63,7 +77,11 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	CompositorInstancePassCopy::CompositorInstancePassCopy(const CompositorResourcePassCopy& compositorResourcePassCopy, const CompositorNodeInstance& compositorNodeInstance) :
-		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance)
+		ICompositorInstancePass(compositorResourcePassCopy, compositorNodeInstance),
+		mDestinationTextureResourceId(GetInvalid<TextureResourceId>()),
+		mSourceTextureResourceId(GetInvalid<TextureResourceId>()),
+		mDestinationTexture(nullptr),
+		mSourceTexture(nullptr)
 	{
 		// Nothing here
 	}
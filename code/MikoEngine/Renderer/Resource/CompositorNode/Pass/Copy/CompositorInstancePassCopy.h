@@ -23,6 +23,12 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef uint32_t TextureResourceId;	// POD texture resource identifier
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -40,6 +46,12 @@ namespace Renderer
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
 	protected:
+		[[nodiscard]] inline virtual bool isCommandBufferCacheable() const override
+		{
+			return true;
+		}
+
+		[[nodiscard]] virtual bool isCachedCommandBufferValid() const override;
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
 
 
@@ -58,6 +70,17 @@ namespace Renderer
 		CompositorInstancePassCopy& operator=(const CompositorInstancePassCopy&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Textures referenced by the cached command buffer, a texture resource reload results in new RHI textures
+		TextureResourceId	 mDestinationTextureResourceId;
+		TextureResourceId	 mSourceTextureResourceId;
+		const Rhi::ITexture* mDestinationTexture;	///< Don't destroy the instance
+		const Rhi::ITexture* mSourceTexture;		///< Don't destroy the instance
+
+
 	};
 
 
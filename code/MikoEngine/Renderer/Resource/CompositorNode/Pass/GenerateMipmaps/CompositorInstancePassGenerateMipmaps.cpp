@@ -24,6 +24,13 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
+	bool CompositorInstancePassGenerateMipmaps::isCachedCommandBufferValid() const
+	{
+		// The texture resource might have been destroyed or reloaded since the cached command buffer has been recorded
+		const TextureResource* textureResource = static_cast<const TextureResource*>(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager().tryGetResourceByResourceId(mTextureResourceId));
+		return (nullptr != textureResource && textureResource->getTexturePtr().GetPointer() == mTexture);
+	}
+
 	void CompositorInstancePassGenerateMipmaps::onFillCommandBuffer([[maybe_unused]] const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer)
 	{
 		const IRenderer& renderer = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer();
@@ -40,7 +47,7 @@ namespace Renderer
 			// Sanity check
 			SE_ASSERT(IsValid(compositorResourcePassGenerateMipmaps.getTextureMaterialBlueprintProperty()), "Invalid compositor resource pass generate mipmaps texture material blueprint property")
 
-			{ // Record reusable command buffer, if necessary
+			{ // Record the commands directly into the given command buffer
 				const TextureResourceManager& textureResourceManager = renderer.getTextureResourceManager();
 				// TODO(co) "Renderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
 				TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId());
@@ -71,14 +78,14 @@ namespace Renderer
 							}
 						}
 
-						// Record reusable command buffer
-						// TODO(co) Optimization: Make this hot-reloading ready and also listen to other critical compositor setting changes like number of multisamples, when done we can fill the following command buffer once and then just reuse it
+						// Record the commands
+						// -> Can't be cached via "Renderer::ICompositorInstancePass::isCommandBufferCacheable()": The compute pass fills pass uniform buffers while recording and those are reused by other passes during the same frame
+						// -> Recorded inline instead of into a member command buffer, a member command buffer executed via "Rhi::Command::ExecuteCommandBuffer" would be overwritten if the pass is filled multiple times before the command buffer execution
 						// TODO(co) There's certainly room for command buffer optimization here (e.g. the graphics pipeline state stays the same)
-						mCommandBuffer.clear();
 						if (!mFramebuffersPtrs.empty())
 						{
 							// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
-							RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), mCommandBuffer, compositorResourcePassGenerateMipmaps.getDebugName())
+							RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, compositorResourcePassGenerateMipmaps.getDebugName())
 
 							// Basing on "Hierarchical-Z map based occlusion culling" - "Hi-Z map construction" - http://rastergrid.com/blog/2010/10/hierarchical-z-map-based-occlusion-culling/
 							uint32_t currentWidth = renderTargetWidth;
@@ -90,22 +97,22 @@ namespace Renderer
 								currentHeight = Rhi::ITexture::getHalfSize(currentHeight);
 
 								// Set graphics render target
-								Rhi::Command::SetGraphicsRenderTarget::create(mCommandBuffer, mFramebuffersPtrs[mipmapIndex]);
+								Rhi::Command::SetGraphicsRenderTarget::create(commandBuffer, mFramebuffersPtrs[mipmapIndex]);
 
 								// Set the graphics viewport and scissor rectangle
-								Rhi::Command::SetGraphicsViewportAndScissorRectangle::create(mCommandBuffer, 0, 0, currentWidth, currentHeight);
+								Rhi::Command::SetGraphicsViewportAndScissorRectangle::create(commandBuffer, 0, 0, currentWidth, currentHeight);
 
 								// Restrict fetches only to previous depth texture mipmap level
-								Rhi::Command::SetTextureMinimumMaximumMipmapIndex::create(mCommandBuffer, *texture, mipmapIndex - 1, mipmapIndex - 1);
+								Rhi::Command::SetTextureMinimumMaximumMipmapIndex::create(commandBuffer, *texture, mipmapIndex - 1, mipmapIndex - 1);
 
 								// Execute the compute pass
 								CompositorContextData localCompositorContextData(compositorContextData.getCompositorWorkspaceInstance(), nullptr);
-								mCompositorInstancePassCompute->onFillCommandBuffer(mFramebuffersPtrs[mipmapIndex], localCompositorContextData, mCommandBuffer);
+								mCompositorInstancePassCompute->onFillCommandBuffer(mFramebuffersPtrs[mipmapIndex], localCompositorContextData, commandBuffer);
 								mCompositorInstancePassCompute->onPostCommandBufferExecution();
 							}
 
 							// Reset mipmap level range for the depth texture
-							Rhi::Command::SetTextureMinimumMaximumMipmapIndex::create(mCommandBuffer, *texture, 0, numberOfMipmaps - 1);
+							Rhi::Command::SetTextureMinimumMaximumMipmapIndex::create(commandBuffer, *texture, 0, numberOfMipmaps - 1);
 						}
 					}
 					else
@@ -120,12 +127,6 @@ namespace Renderer
 					SE_ASSERT(false, "Failed to get texture resource by asset ID")
 				}
 			}
-
-			// Fill given command buffer, if necessary
-			if (!mCommandBuffer.isEmpty())
-			{
-				mCommandBuffer.submitToCommandBuffer(commandBuffer);
-			}
 		}
 		else
 		{
@@ -133,13 +134,15 @@ namespace Renderer
 			SE_ASSERT(IsInvalid(compositorResourcePassGenerateMipmaps.getTextureMaterialBlueprintProperty()), "Invalid compositor resource pass generate mipmaps texture material blueprint property")
 
 			// Generate mipmaps
-			// TODO(co) "Renderer::TextureResourceManager::getTextureResourceByAssetId()" is considered to be inefficient, don't use it in here
+			// -> The command buffer is cached, so the inefficient "Renderer::TextureResourceManager::getTextureResourceByAssetId()" is only used while recording
 			TextureResource* textureResource = getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getTextureResourceManager().getTextureResourceByAssetId(compositorResourcePassGenerateMipmaps.getTextureAssetId());
 			if (nullptr != textureResource)
 			{
 				Rhi::ITexture* texture = textureResource->getTexturePtr();
 				if (nullptr != texture)
 				{
+					mTextureResourceId = textureResource->getId();
+					mTexture = texture;
 					Rhi::Command::GenerateMipmaps::create(commandBuffer, *texture);
 				}
 			}
@@ -155,7 +158,9 @@ namespace Renderer
 		mCompositorResourcePassCompute(nullptr),
 		mCompositorInstancePassCompute(nullptr),
 		mRenderTargetWidth(GetInvalid<uint32_t>()),
-		mRenderTargetHeight(GetInvalid<uint32_t>())
+		mRenderTargetHeight(GetInvalid<uint32_t>()),
+		mTextureResourceId(GetInvalid<TextureResourceId>()),
+		mTexture(nullptr)
 	{
 		// Handle texture mipmap generation via custom material blueprint
 		const AssetId materialBlueprintAssetId = compositorResourcePassGenerateMipmaps.getMaterialBlueprintAssetId();
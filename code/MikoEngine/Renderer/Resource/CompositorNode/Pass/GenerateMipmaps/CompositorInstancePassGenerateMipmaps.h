@@ -27,6 +27,12 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef uint32_t TextureResourceId;	// POD texture resource identifier
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
@@ -44,6 +50,13 @@ namespace Renderer
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
 	protected:
+		[[nodiscard]] inline virtual bool isCommandBufferCacheable() const override
+		{
+			// Texture mipmap generation via custom material blueprint fills pass uniform buffers during recording, so only the RHI mipmap generation can be cached
+			return (nullptr == mCompositorInstancePassCompute);
+		}
+
+		[[nodiscard]] virtual bool isCachedCommandBufferValid() const override;
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
 
 
@@ -69,12 +82,14 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		// For texture mipmap generation via custom material blueprint
-		Rhi::CommandBuffer			   mCommandBuffer;
 		CompositorResourcePassCompute* mCompositorResourcePassCompute;
 		CompositorInstancePassCompute* mCompositorInstancePassCompute;
 		uint32_t					   mRenderTargetWidth;
 		uint32_t					   mRenderTargetHeight;
 		FramebufferPtrs				   mFramebuffersPtrs;
+		// For texture mipmap generation via the RHI: Texture referenced by the cached command buffer, a texture resource reload results in a new RHI texture
+		TextureResourceId			   mTextureResourceId;
+		const Rhi::ITexture*		   mTexture;	///< Don't destroy the instance
 
 
 	};
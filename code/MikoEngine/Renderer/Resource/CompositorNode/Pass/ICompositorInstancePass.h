@@ -72,6 +72,40 @@ namespace Renderer
 			// Nothing here
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the commands filled by "Renderer::ICompositorInstancePass::onFillCommandBuffer()" can be recorded once and then be reused across frames
+		*
+		*  @return
+		*    "true" if the compositor instance pass is recorded into a frame-persistent command buffer which is replayed via "Rhi::Command::ExecuteCommandBuffer", else "false"
+		*
+		*  @note
+		*    - Only return "true" if the filled commands don't depend on per-frame data like the camera, the render queue or pass uniform buffer content
+		*    - The cached command buffer is recorded again on render target change, on resolution or number of multisamples change (see "Renderer::CompositorWorkspaceInstance") and if "Renderer::ICompositorInstancePass::isCachedCommandBufferValid()" returns "false", compositor node hot-reloading recreates the compositor instance passes anyway
+		*    - The compositor node instance emits the combined scoped profiler event around the replay, so a cacheable compositor instance pass must not use profiler samples inside "Renderer::ICompositorInstancePass::onFillCommandBuffer()" since those would only be taken during recording
+		*    - The default implementation returns "false"
+		*/
+		[[nodiscard]] inline virtual bool isCommandBufferCacheable() const
+		{
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the cached command buffer of a cacheable compositor instance pass is still valid
+		*
+		*  @return
+		*    "true" if the cached command buffer can be replayed, "false" if it has to be recorded again
+		*
+		*  @note
+		*    - Used to check resources referenced by the cached commands which can change independent of the compositor workspace instance (e.g. reloaded textures)
+		*    - The default implementation returns "true"
+		*/
+		[[nodiscard]] inline virtual bool isCachedCommandBufferValid() const
+		{
+			return true;
+		}
+
 		/**
 		*  @brief
 		*    Fill the compositor pass into the given command buffer
@@ -106,7 +140,8 @@ namespace Renderer
 			mCompositorResourcePass(compositorResourcePass),
 			mCompositorNodeInstance(compositorNodeInstance),
 			mRenderTarget(nullptr),
-			mNumberOfExecutionRequests(0)
+			mNumberOfExecutionRequests(0),
+			mCachedRenderTarget(nullptr)
 		{
 			// Nothing here
 		}
@@ -119,6 +154,12 @@ namespace Renderer
 		explicit ICompositorInstancePass(const ICompositorInstancePass&) = delete;
 		ICompositorInstancePass& operator=(const ICompositorInstancePass&) = delete;
 
+		inline void invalidateCachedCommandBuffer()
+		{
+			mCachedCommandBuffer.clear();
+			mCachedRenderTarget = nullptr;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -128,6 +169,8 @@ namespace Renderer
 		const CompositorNodeInstance&  mCompositorNodeInstance;
 		Rhi::IRenderTarget*			   mRenderTarget;	/// Render target, can be a null pointer, don't destroy the instance
 		uint32_t					   mNumberOfExecutionRequests;
+		Rhi::CommandBuffer			   mCachedCommandBuffer;	/// Frame-persistent command buffer of cacheable compositor instance passes, empty if it has to be recorded
+		const Rhi::IRenderTarget*	   mCachedRenderTarget;		/// Render target the cached command buffer was recorded for, can be a null pointer, don't destroy the instance
 
 
 	};
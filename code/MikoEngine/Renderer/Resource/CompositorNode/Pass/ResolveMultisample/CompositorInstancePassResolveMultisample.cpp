@@ -26,10 +26,9 @@ namespace Renderer
 		// Sanity check
 		SE_ASSERT(nullptr != renderTarget, "The resolve multisample compositor instance pass needs a valid render target")
 
-		// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
-		RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, getCompositorResourcePass().getDebugName())
-
 		// Resolve
+		// -> The command buffer is cached, the compositor node instance emits the combined scoped profiler event when replaying it
+		// -> The framebuffer is only destroyed together with the cached command buffer, see "Renderer::CompositorWorkspaceInstance::destroyFramebuffersAndRenderTargetTextures()"
 		Rhi::IFramebuffer* framebuffer = renderer.getCompositorWorkspaceResourceManager().getFramebufferManager().getFramebufferByCompositorFramebufferId(static_cast<const CompositorResourcePassResolveMultisample&>(getCompositorResourcePass()).getSourceMultisampleCompositorFramebufferId());
 		if (nullptr != framebuffer)
 		{
@@ -40,6 +40,11 @@ namespace Renderer
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
 	protected:
+		[[nodiscard]] inline virtual bool isCommandBufferCacheable() const override
+		{
+			return true;
+		}
+
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
 
 
@@ -38,6 +38,28 @@ namespace Renderer
 		friend class CompositorPassFactory;	// The only one allowed to create instances of this class
 
 
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		[[nodiscard]] inline const RenderQueue::ContributionSettings& getContributionSettings() const
+		{
+			return mRenderQueue.getContributionSettings();
+		}
+
+		/**
+		*  @brief
+		*    Set the contribution culling and LOD selection settings of this compositor pass
+		*
+		*  @param[in] contributionSettings
+		*    Contribution culling and LOD selection settings, see "Renderer::RenderQueue::ContributionSettings"
+		*/
+		inline void setContributionSettings(const RenderQueue::ContributionSettings& contributionSettings)
+		{
+			mRenderQueue.setContributionSettings(contributionSettings);
+		}
+
+
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
 	//[-------------------------------------------------------]
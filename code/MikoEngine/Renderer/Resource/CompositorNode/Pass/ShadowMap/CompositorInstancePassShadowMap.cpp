@@ -1,5 +1,6 @@
 #include "stdafx.h"
 #include "Renderer/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
+#include "Renderer/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Resource/CompositorNode/Pass/Compute/CompositorInstancePassCompute.h"
 #include "Renderer/Resource/CompositorNode/Pass/Compute/CompositorResourcePassCompute.h"
 #include "Renderer/Resource/CompositorNode/CompositorNodeInstance.h"
@@ -8,6 +9,8 @@
 #include "Renderer/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "Renderer/Resource/Scene/SceneNode.h"
+#include "Renderer/Resource/Scene/SceneResource.h"
+#include "Renderer/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/RenderQueue/RenderableManager.h"
 #include "Math/Math.h"
 #include "Renderer/Core/IProfiler.h"
@@ -308,24 +311,16 @@ namespace Renderer
 						Rhi::Command::ClearGraphics::create(commandBuffer, Rhi::ClearFlag::DEPTH, color);
 					}
 
-					// Render shadow casters
-					// TODO(co) Optimization: Do only render stuff which calls into the current shadow cascade
-					SE_ASSERT(nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
+					// Render the shadow casters which can cast a shadow into the current shadow cascade
+					// -> Shadow casters don't need to be visible to the camera, hence they're culled against the shadow cascade and not taken from the render queue index range
+					cameraSceneItem->getSceneResource().getSceneCullingManager().gatherShadowCastersRenderableManagers(compositorContextData, viewSpaceToClipSpace, mShadowCasterRenderableManagers);
+					RenderQueue& renderQueue = *mShadowCascadeRenderQueues[cascadeIndex];
+					renderQueue.setContributionSettings(mRenderQueue.getContributionSettings());
 					const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
-					for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
+					renderQueue.addRenderablesFromRenderableManagers(mShadowCasterRenderableManagers, materialTechniqueId, shadowCompositorContextData, true);	// The render queue only considers renderables inside its render queue index range
+					if (renderQueue.getNumberOfDrawCalls() > 0)
 					{
-						// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
-						// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
-						// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-						if (renderableManager->getCastShadows())
-						{
-							mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, shadowCompositorContextData, true);
-						}
-					}
-					if (mRenderQueue.getNumberOfDrawCalls() > 0)
-					{
-						mRenderQueue.fillGraphicsCommandBuffer(*mDepthFramebufferPtr, shadowCompositorContextData, commandBuffer);
-						mRenderQueue.clear();
+						renderQueue.fillGraphicsCommandBuffer(*mDepthFramebufferPtr, shadowCompositorContextData, commandBuffer);
 					}
 				}
 
@@ -406,6 +401,20 @@ namespace Renderer
 	}
 
 
+	void CompositorInstancePassShadowMap::onPostCommandBufferExecution()
+	{
+		// Call the base implementation
+		CompositorInstancePassScene::onPostCommandBufferExecution();
+
+		// Directly clear the shadow cascade render queues as soon as the frame rendering has been finished to avoid evil dangling pointers
+		for (RenderQueue* renderQueue : mShadowCascadeRenderQueues)
+		{
+			renderQueue->clear();
+		}
+		mShadowCasterRenderableManagers.clear();
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -433,13 +442,24 @@ namespace Renderer
 		mVerticalBlurCompositorInstancePassCompute(nullptr)
 	{
 		mPassData.shadowMatrix = Math::MAT4_IDENTITY;
+		IndirectBufferManager& indirectBufferManager = compositorNodeInstance.getCompositorWorkspaceInstance().getRenderer().getMaterialBlueprintResourceManager().getIndirectBufferManager();
 		for (int i = 0; i < CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES; ++i)
 		{
 			mPassData.shadowCascadeScales[i] = Math::VEC4_ONE;
+			mShadowCascadeRenderQueues[i] = new RenderQueue(indirectBufferManager, compositorResourcePassShadowMap.getMinimumRenderQueueIndex(), compositorResourcePassShadowMap.getMaximumRenderQueueIndex(), true, compositorResourcePassShadowMap.isTransparentPass(), true);
 		}
 		createShadowMapRenderTarget();
 	}
 
+	CompositorInstancePassShadowMap::~CompositorInstancePassShadowMap()
+	{
+		destroyShadowMapRenderTarget();
+		for (RenderQueue* renderQueue : mShadowCascadeRenderQueues)
+		{
+			delete renderQueue;
+		}
+	}
+
 	void CompositorInstancePassShadowMap::createShadowMapRenderTarget()
 	{
 		const CompositorResourcePassShadowMap& compositorResourcePassShadowMap = static_cast<const CompositorResourcePassShadowMap&>(getCompositorResourcePass());
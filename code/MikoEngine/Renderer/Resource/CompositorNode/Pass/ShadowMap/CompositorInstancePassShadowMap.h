@@ -156,6 +156,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	protected:
 		virtual void onFillCommandBuffer(const Rhi::IRenderTarget* renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer) override;
+		virtual void onPostCommandBufferExecution() override;
 
 
 	//[-------------------------------------------------------]
@@ -164,10 +165,7 @@ namespace Renderer
 	private:
 		CompositorInstancePassShadowMap(const CompositorResourcePassShadowMap& compositorResourcePassShadowMap, const CompositorNodeInstance& compositorNodeInstance);
 
-		inline virtual ~CompositorInstancePassShadowMap() override
-		{
-			destroyShadowMapRenderTarget();
-		}
+		virtual ~CompositorInstancePassShadowMap() override;
 
 		explicit CompositorInstancePassShadowMap(const CompositorInstancePassShadowMap&) = delete;
 		CompositorInstancePassShadowMap& operator=(const CompositorInstancePassShadowMap&) = delete;
@@ -191,6 +189,8 @@ namespace Renderer
 		uint32_t					   mSettingsGenerationCounter;	// Most simple solution to detect settings changes which make internal data invalid
 		uint32_t					   mUsedSettingsGenerationCounter;
 		PassData					   mPassData;
+		RenderQueue*				   mShadowCascadeRenderQueues[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];	// Render queue per shadow cascade, filled with the shadow casters inside the shadow cascade only, always valid, destroy the instances if you no longer need them
+		CompositorWorkspaceInstance::RenderableManagers mShadowCasterRenderableManagers;	// Shadow casting renderable managers of the current shadow cascade, only valid during filling the command buffer
 		Rhi::IFramebufferPtr		   mDepthFramebufferPtr;
 		Rhi::IFramebufferPtr		   mVarianceFramebufferPtr[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 		Rhi::IFramebufferPtr		   mIntermediateFramebufferPtr;
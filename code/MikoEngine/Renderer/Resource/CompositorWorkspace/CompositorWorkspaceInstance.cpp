@@ -51,6 +51,7 @@ namespace Renderer
 		mCompositorWorkspaceResourceId(GetInvalid<CompositorWorkspaceResourceId>()),
 		mFramebufferManagerInitialized(false),
 		mExecutionRenderTarget(nullptr),
+		mOptimizeCommandBuffer(false),
 		mCompositorInstancePassShadowMap(nullptr)
 		#ifdef RHI_STATISTICS
 			, mPipelineStatisticsQueryPoolPtr((renderer.getRhi().getNameId() == Rhi::NameId::OPENGL && strstr(renderer.getRhi().getCapabilities().deviceName, "AMD ") != nullptr) ? nullptr : renderer.getRhi().createQueryPool(Rhi::QueryType::PIPELINE_STATISTICS, 2 RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"))),	// TODO(co) When using OpenGL "GL_ARB_pipeline_statistics_query" features, "glCopyImageSubData()" will horribly stall/freeze on Windows using AMD Radeon 18.12.2 (tested on 16 December 2018). No issues with NVIDIA GeForce game ready driver 417.35 (release data 12/12/2018).
@@ -231,6 +232,10 @@ namespace Renderer
 							Rhi::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
 						}
 					#endif
+					if (mOptimizeCommandBuffer)
+					{
+						mCommandBuffer.optimize(rhi);
+					}
 					mCommandBuffer.submitToRhi(rhi);
 
 					// The command buffer has been submitted, inform everyone who cares about this
@@ -480,13 +485,14 @@ namespace Renderer
 
 	void CompositorWorkspaceInstance::destroyFramebuffersAndRenderTargetTextures(bool clearManagers)
 	{
-		// All compositor instance passes need to forget about the render targets
+		// All compositor instance passes need to forget about the render targets as well as cached commands referencing them
 		for (CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 		{
 			for (ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
 			{
 				compositorInstancePass->mRenderTarget = nullptr;
 				compositorInstancePass->mNumberOfExecutionRequests = 0;
+				compositorInstancePass->invalidateCachedCommandBuffer();
 			}
 		}
 
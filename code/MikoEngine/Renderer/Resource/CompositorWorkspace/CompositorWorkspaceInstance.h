@@ -135,6 +135,16 @@ namespace Renderer
 			return mCommandBuffer;
 		}
 
+		[[nodiscard]] inline bool getOptimizeCommandBuffer() const
+		{
+			return mOptimizeCommandBuffer;
+		}
+
+		inline void setOptimizeCommandBuffer(bool optimizeCommandBuffer)	// Remove redundant state changes and merge multi-draw-indirect draws via "Rhi::CommandBuffer::optimize()" before submitting the command buffers to the RHI, disabled by default
+		{
+			mOptimizeCommandBuffer = optimizeCommandBuffer;
+		}
+
 		#ifdef RHI_STATISTICS
 			[[nodiscard]] inline const Rhi::PipelineStatisticsQueryResult& getPipelineStatisticsQueryResult() const
 			{
@@ -182,6 +192,7 @@ namespace Renderer
 		Rhi::IRenderTarget*				 mExecutionRenderTarget;				// Only valid during compositor workspace instance execution
 		std::vector<ISceneItem*>		 mExecuteOnRenderingSceneItems;			// Scene items which requested an execute call on rendering, no duplicates allowed
 		Rhi::CommandBuffer				 mCommandBuffer;						// RHI command buffer
+		bool							 mOptimizeCommandBuffer;
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		// Can be a null pointer, don't destroy the instance
 		#ifdef RHI_STATISTICS
 			Rhi::IQueryPoolPtr				   mPipelineStatisticsQueryPoolPtr;					// Double buffered asynchronous pipeline statistics query pool, can be a null pointer
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Renderer/Asset/Asset.h"
+#include "Core/File/AsyncFileReader.h"
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -108,6 +109,30 @@ namespace Renderer
 		*/
 		[[nodiscard]] virtual bool hasDeserialization() const = 0;
 
+		/**
+		*  @brief
+		*    Asynchronous called to add the asset file ranges the asynchronous file reader has to read before the deserialization
+		*
+		*  @param[in,out] readRequest
+		*    Asynchronous read request of the asset file, the file ranges added by former calls have already been read
+		*
+		*  @return
+		*    "true" if file ranges have been added which have to be read before this method is called again, else "false" to continue with the deserialization
+		*
+		*  @note
+		*    - Allows to e.g. read a file header first and afterwards only the parts of the file which are really needed
+		*    - The default implementation reads the whole file at once
+		*/
+		[[nodiscard]] inline virtual bool addAsynchronousReadRanges(AsyncFileReader::ReadRequest& readRequest)
+		{
+			if (readRequest.getReadRanges().empty())
+			{
+				readRequest.addReadRange(0);
+				return true;
+			}
+			return false;
+		}
+
 		/**
 		*  @brief
 		*    Asynchronous called when the resource loader has to deserialize (usually from file) the internal data into memory
@@ -24,6 +24,17 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	typedef StringId ResourceLoaderTypeId;	// Resource loader type identifier, internally just a POD "uint32_t", usually created by hashing the file format extension (if the resource loader is processing file data in the first place)
 
+	/**
+	*  @brief
+	*    Resource load request priority class, lower values are dispatched first by the resource streamer
+	*/
+	enum class ResourceLoadPriority : uint8_t
+	{
+		VISIBLE_NOW = 0,	// The resource is needed right now, e.g. it's visible and a fallback placeholder is shown instead or the caller blocks until it's loaded
+		PREFETCH	= 1,	// The resource will likely be needed soon (default)
+		BACKGROUND	= 2		// The resource isn't needed any time soon, e.g. it's part of a far away streaming cell
+	};
+
 
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
@@ -110,6 +110,18 @@ namespace Renderer
 		fillCommandBuffer(renderer, resourceGroupRootParameterIndex, resourceGroup);
 	}
 
+	void MaterialTechnique::requestTextureResolution(const TextureResourceManager& textureResourceManager, uint32_t resolution) const
+	{
+		for (const Texture& texture : mTextures)
+		{
+			TextureResource* textureResource = textureResourceManager.tryGetById(texture.textureResourceId);
+			if (nullptr != textureResource)
+			{
+				textureResource->requestResolution(resolution);
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -163,7 +175,7 @@ namespace Renderer
 						{
 							// TODO(co) Error handling: Usage mismatch etc.
 							texture.materialProperty = *materialProperty;
-							textureResourceManager.loadTextureResourceByAssetId(texture.materialProperty.getTextureAssetIdValue(), blueprintTexture.fallbackTextureAssetId, texture.textureResourceId, this, blueprintTexture.rgbHardwareGammaCorrection);
+							textureResourceManager.loadTextureResourceByAssetId(texture.materialProperty.getTextureAssetIdValue(), blueprintTexture.fallbackTextureAssetId, texture.textureResourceId, this, blueprintTexture.rgbHardwareGammaCorrection, false, GetInvalid<ResourceLoaderTypeId>(), true, ResourceLoadPriority::VISIBLE_NOW);	// The material is about to be rendered, the fallback placeholder is shown instead
 						}
 					}
 
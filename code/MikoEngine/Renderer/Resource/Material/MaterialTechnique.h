@@ -15,6 +15,7 @@ namespace Renderer
 {
 	class IRenderer;
 	class MaterialBufferManager;
+	class TextureResourceManager;
 }
 
 
@@ -152,6 +153,20 @@ namespace Renderer
 		*/
 		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
 
+		/**
+		*  @brief
+		*    Request the texture resolution needed to display the material technique on screen, residency feedback for progressive texture streaming
+		*
+		*  @param[in] textureResourceManager
+		*    Texture resource manager to use
+		*  @param[in] resolution
+		*    Needed texture resolution, see "Renderer::TextureResourceManager::getRequiredTextureResolution()"
+		*
+		*  @note
+		*    - Thread-safe, only the textures already gathered by binding the material technique are taken into account
+		*/
+		void requestTextureResolution(const TextureResourceManager& textureResourceManager, uint32_t resolution) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
@@ -96,6 +96,7 @@ namespace Renderer
 		ComputePipelineStateSignature mComputePipelineStateSignature;
 		Rhi::IComputePipelineStatePtr mComputePipelineStateObjectPtr;
 		bool						  mIsUsingFallback;					// If "true", this compute pipeline state cache is currently using fallback data because it's in asynchronous compilation
+		Rhi::PipelineStateBinary	  mPipelineStateBinary;				// Backend binary read from the pipeline state object cache, cleared as soon as the compute pipeline state object has been created
 
 
 	};
@@ -160,14 +160,13 @@ namespace Renderer
 		return nullptr;
 	}
 
-	void ComputePipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file)
+	void ComputePipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file, bool usePipelineStateBinaries)
 	{
 		// Material blueprint resource ID, all compute pipeline state cache share the same material blueprint resource ID
 		MaterialBlueprintResourceId materialBlueprintResourceId = GetInvalid<MaterialBlueprintResourceId>();
 		file.read(&materialBlueprintResourceId, sizeof(uint32_t));
 		SE_ASSERT(mMaterialBlueprintResource.getId() == materialBlueprintResourceId, "Invalid material blueprint resource ID")
 
-		// TODO(co) Currently only the compute pipeline state signature ID is loaded, not the resulting binary pipeline state cache
 		uint32_t numberOfComputePipelineStateCaches = GetInvalid<uint32_t>();
 		file.read(&numberOfComputePipelineStateCaches, sizeof(uint32_t));
 		mComputePipelineStateCacheByComputePipelineStateSignatureId.reserve(numberOfComputePipelineStateCaches);
@@ -189,8 +188,24 @@ namespace Renderer
 			// Register
 			mTemporaryComputePipelineStateSignature.set(mMaterialBlueprintResource, shaderProperties);
 			ComputePipelineStateCache* computePipelineStateCache = new ComputePipelineStateCache(mTemporaryComputePipelineStateSignature);
+
+			{ // Read the backend pipeline state binary, it's only used if it was created by the currently used GPU and driver
+				uint32_t numberOfBinaryBytes = 0;
+				file.read(&numberOfBinaryBytes, sizeof(uint32_t));
+				if (numberOfBinaryBytes > 0)
+				{
+					if (usePipelineStateBinaries)
+					{
+						file.read(computePipelineStateCache->mPipelineStateBinary.allocateBinary(numberOfBinaryBytes), numberOfBinaryBytes);
+					}
+					else
+					{
+						file.skip(numberOfBinaryBytes);
+					}
+				}
+			}
 			mComputePipelineStateCacheByComputePipelineStateSignatureId.emplace(mTemporaryComputePipelineStateSignature.getComputePipelineStateSignatureId(), computePipelineStateCache);
-			computePipelineStateCompiler.instantSynchronousCompilerRequest(mMaterialBlueprintResource, *computePipelineStateCache);
+			computePipelineStateCompiler.addWarmUpCompilerRequest(mMaterialBlueprintResource, *computePipelineStateCache);
 		}
 
 		// Done
@@ -203,7 +218,6 @@ namespace Renderer
 		const MaterialBlueprintResourceId materialBlueprintResourceId = mMaterialBlueprintResource.getId();
 		file.write(&materialBlueprintResourceId, sizeof(uint32_t));
 
-		// TODO(co) Currently only the compute pipeline state signature ID is saved, not the resulting binary pipeline state cache
 		const uint32_t numberOfComputePipelineStateCaches = static_cast<uint32_t>(mComputePipelineStateCacheByComputePipelineStateSignatureId.size());
 		file.write(&numberOfComputePipelineStateCaches, sizeof(uint32_t));
 		for (const auto& elementPair : mComputePipelineStateCacheByComputePipelineStateSignatureId)
@@ -222,6 +236,23 @@ namespace Renderer
 					file.write(sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * numberOfShaderProperties);
 				}
 			}
+
+			{ // Write the backend pipeline state binary
+				// -> Prefer the binary of the created pipeline state object, else keep the loaded binary of a pipeline state object which hasn't been created, yet
+				const ComputePipelineStateCache& computePipelineStateCache = *elementPair.second;
+				Rhi::PipelineStateBinary createdPipelineStateBinary;
+				const Rhi::PipelineStateBinary* pipelineStateBinary = &computePipelineStateCache.mPipelineStateBinary;
+				if (!computePipelineStateCache.mIsUsingFallback && nullptr != computePipelineStateCache.mComputePipelineStateObjectPtr && computePipelineStateCache.mComputePipelineStateObjectPtr->getPipelineStateBinary(createdPipelineStateBinary))
+				{
+					pipelineStateBinary = &createdPipelineStateBinary;
+				}
+				const uint32_t numberOfBinaryBytes = pipelineStateBinary->getNumberOfBytes();
+				file.write(&numberOfBinaryBytes, sizeof(uint32_t));
+				if (numberOfBinaryBytes > 0)
+				{
+					file.write(pipelineStateBinary->getBinary(), numberOfBinaryBytes);
+				}
+			}
 		}
 
 		// Done
@@ -66,7 +66,6 @@ namespace Renderer
 	*
 	*  @todo
 	*    - TODO(co) For Vulkan, DirectX 12 and Apple Metal the pipeline state object instance will be managed in here
-	*    - TODO(co) Direct3D 12: Pipeline state object: Add support for "GetCachedBlob" (super efficient material cache), see https://github.com/Microsoft/DirectX-Graphics-Samples/blob/master/Samples/D3D12PipelineStateCache/src/PSOLibrary.cpp
 	*/
 	class ComputePipelineStateCacheManager final
 	{
@@ -140,7 +139,7 @@ namespace Renderer
 		//[-------------------------------------------------------]
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
-		void loadPipelineStateObjectCache(IFile& file);
+		void loadPipelineStateObjectCache(IFile& file, bool usePipelineStateBinaries);
 
 		[[nodiscard]] inline bool doesPipelineStateObjectCacheNeedSaving() const
 		{
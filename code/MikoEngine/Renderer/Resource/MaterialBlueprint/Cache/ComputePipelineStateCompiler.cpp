@@ -73,7 +73,6 @@ namespace Renderer
 	void ComputePipelineStateCompiler::dispatch()
 	{
 		// Synchronous dispatch
-		// TODO(co) Add maximum dispatch time budget
 		// TODO(co) More clever mutex usage in order to reduce pipeline state compiler stalls due to synchronization
 		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
 		while (!mDispatchQueue.empty())
@@ -86,9 +85,16 @@ namespace Renderer
 			ComputePipelineStateCache& computePipelineStateCache = compilerRequest.computePipelineStateCache;
 			computePipelineStateCache.mComputePipelineStateObjectPtr = compilerRequest.computePipelineStateObject;
 			computePipelineStateCache.mIsUsingFallback = false;
+			computePipelineStateCache.mPipelineStateBinary.clear();
 			SE_ASSERT(0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
 			--mNumberOfInFlightCompilerRequests;
 		}
+
+		// The pipeline state object cache warm-up is finished as soon as there are no in flight compiler requests left
+		if (0 == mNumberOfInFlightCompilerRequests)
+		{
+			mNumberOfWarmUpCompilerRequests = 0;
+		}
 	}
 
 
@@ -100,6 +106,7 @@ namespace Renderer
 		mAsynchronousCompilationEnabled(renderer.getRhi().getCapabilities().nativeMultithreading),
 		mNumberOfCompilerThreads(0),
 		mNumberOfInFlightCompilerRequests(0),
+		mNumberOfWarmUpCompilerRequests(0),
 		mShutdownBuilderThread(false),
 		mBuilderThread(&ComputePipelineStateCompiler::builderThreadWorker, this),
 		mShutdownCompilerThread(false)
@@ -130,6 +137,20 @@ namespace Renderer
 		mBuilderConditionVariable.notify_one();
 	}
 
+	void ComputePipelineStateCompiler::addWarmUpCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, ComputePipelineStateCache& computePipelineStateCache)
+	{
+		// Spread the pipeline state object cache warm-up across the builder thread and the compiler threads, the synchronous fallback compiles one pipeline state after another
+		if (mAsynchronousCompilationEnabled)
+		{
+			++mNumberOfWarmUpCompilerRequests;
+			addAsynchronousCompilerRequest(computePipelineStateCache);
+		}
+		else
+		{
+			instantSynchronousCompilerRequest(materialBlueprintResource, computePipelineStateCache);
+		}
+	}
+
 	void ComputePipelineStateCompiler::instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, ComputePipelineStateCache& computePipelineStateCache)
 	{
 		// Get the compute program cache; synchronous processing
@@ -142,7 +163,8 @@ namespace Renderer
 				Rhi::IShader* shader = shaderCache->getShaderPtr();
 				if (nullptr != shader)
 				{
-					computePipelineStateCache.mComputePipelineStateObjectPtr = createComputePipelineState(materialBlueprintResource, *shader);
+					computePipelineStateCache.mComputePipelineStateObjectPtr = createComputePipelineState(materialBlueprintResource, *shader, computePipelineStateCache.mPipelineStateBinary);
+					computePipelineStateCache.mPipelineStateBinary.clear();
 				}
 			}
 		}
@@ -181,7 +203,7 @@ namespace Renderer
 		{
 			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
 			std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
-			mBuilderConditionVariable.wait(builderMutexLock);
+			mBuilderConditionVariable.wait(builderMutexLock, [this]() { return (!mBuilderQueue.empty() || mShutdownBuilderThread); });
 			while (!mBuilderQueue.empty() && !mShutdownBuilderThread)
 			{
 				// Get the compiler request
@@ -276,12 +298,13 @@ namespace Renderer
 	{
 		Rhi::IShaderLanguage& shaderLanguage = mRenderer.getRhi().getDefaultShaderLanguage();
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		ShaderCacheManager& shaderCacheManager = mRenderer.getShaderBlueprintResourceManager().getShaderCacheManager();
 		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 2", "Renderer: Pipeline state compiler stage: 2. Asynchronous shader compilation")
 		while (!mShutdownCompilerThread)
 		{
 			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
 			std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
-			mCompilerConditionVariable.wait(compilerMutexLock);
+			mCompilerConditionVariable.wait(compilerMutexLock, [this]() { return (!mCompilerQueue.empty() || mShutdownCompilerThread); });
 			while (!mCompilerQueue.empty() && !mShutdownCompilerThread)
 			{
 				// Get the compiler request
@@ -301,9 +324,16 @@ namespace Renderer
 						const std::string& shaderSourceCode = compilerRequest.shaderSourceCode;
 						if (shaderSourceCode.empty())
 						{
-							// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master we need to wait for
+							// We're not aware of any shader source code but we need a shader cache: Either the shader cache was loaded from the pipeline state object cache
+							// and the shader instance is created using the cached shader bytecode, or there must be a shader cache master we need to wait for
 							// SE_ASSERT(nullptr != shaderCache->getMasterShaderCache(), "Invalid master shader cache")	// No assert by intent
-							needToWaitForShaderCache = true;
+							ShaderCache& masterShaderCache = (nullptr != shaderCache->getMasterShaderCache()) ? *shaderCache->getMasterShaderCache() : *shaderCache;
+							std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+							if (nullptr == masterShaderCache.mShaderPtr.GetPointer() && masterShaderCache.hasShaderBytecode())
+							{
+								shaderCacheManager.createComputeShaderFromBytecode(shaderCacheManagerMutexLock, masterShaderCache, shaderLanguage);
+							}
+							shader = masterShaderCache.mShaderPtr;
 						}
 						else
 						{
@@ -311,15 +341,28 @@ namespace Renderer
 							shader = shaderLanguage.createComputeShaderFromSourceCode(shaderSourceCode.c_str(), &shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("Compute pipeline state compiler"));
 							SE_ASSERT(nullptr != shader, "Invalid shader")	// TODO(co) Error handling
 							shaderCache->mShaderPtr = shader;
-
-							// Create the compute pipeline state object (PSO)
-							compilerRequest.computePipelineStateObject = createComputePipelineState(materialBlueprintResourceManager.getById(compilerRequest.computePipelineStateCache.getComputePipelineStateSignature().getMaterialBlueprintResourceId()), *shader);
-
-							// Push the compiler request into the queue of the synchronous shader dispatch
-							std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-							mDispatchQueue.emplace_back(compilerRequest);
 						}
 					}
+					if (nullptr == shader)
+					{
+						needToWaitForShaderCache = true;
+					}
+					else
+					{
+						// Create the compute pipeline state object (PSO)
+						compilerRequest.computePipelineStateObject = createComputePipelineState(materialBlueprintResourceManager.getById(compilerRequest.computePipelineStateCache.getComputePipelineStateSignature().getMaterialBlueprintResourceId()), *shader, compilerRequest.computePipelineStateCache.mPipelineStateBinary);
+
+						// Push the compiler request into the queue of the synchronous shader dispatch
+						std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+						mDispatchQueue.emplace_back(compilerRequest);
+					}
+				}
+				else
+				{
+					// There's no shader cache, the compiler request is dropped and the compute pipeline state cache keeps using the fallback
+					// -> The compiler request is no longer in flight, else the pipeline state compiler never gets idle and the warm-up never finishes
+					SE_ASSERT(0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
+					--mNumberOfInFlightCompilerRequests;
 				}
 
 				// We're ready for the next round
@@ -333,12 +376,12 @@ namespace Renderer
 		}
 	}
 
-	Rhi::IComputePipelineState* ComputePipelineStateCompiler::createComputePipelineState(const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShader& shader) const
+	Rhi::IComputePipelineState* ComputePipelineStateCompiler::createComputePipelineState(const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShader& shader, const Rhi::PipelineStateBinary& pipelineStateBinary) const
 	{
-		// Create the compute pipeline state object (PSO)
+		// Create the compute pipeline state object (PSO), the backend binary from the pipeline state object cache skips the driver compilation
 		const Rhi::IRootSignaturePtr& rootSignaturePtr = materialBlueprintResource.getRootSignaturePtr();
 		SE_ASSERT(shader.getResourceType() == Rhi::ResourceType::COMPUTE_SHADER, "Invalid shader resource type")
-		return rootSignaturePtr->getRhi().createComputePipelineState(*rootSignaturePtr, static_cast<Rhi::IComputeShader&>(shader) RHI_RESOURCE_DEBUG_NAME("Compute pipeline state compiler"));
+		return rootSignaturePtr->getRhi().createComputePipelineState(*rootSignaturePtr, static_cast<Rhi::IComputeShader&>(shader), (0 != pipelineStateBinary.getNumberOfBytes()) ? &pipelineStateBinary : nullptr RHI_RESOURCE_DEBUG_NAME("Compute pipeline state compiler"));
 	}
 
 
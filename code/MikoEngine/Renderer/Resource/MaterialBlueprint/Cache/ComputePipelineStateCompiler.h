@@ -72,6 +72,21 @@ namespace Renderer
 			return mNumberOfInFlightCompilerRequests;
 		}
 
+		/**
+		*  @brief
+		*    Return the number of compiler requests committed by the pipeline state object cache warm-up
+		*
+		*  @return
+		*    The number of warm-up compiler requests, reset to zero as soon as there are no in flight compiler requests left
+		*
+		*  @note
+		*    - Together with "getNumberOfInFlightCompilerRequests()" this is the progress of the pipeline state object cache warm-up
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfWarmUpCompilerRequests() const
+		{
+			return mNumberOfWarmUpCompilerRequests;
+		}
+
 		inline void flushBuilderQueue()
 		{
 			flushQueue(mBuilderMutex, mBuilderQueue);
@@ -135,11 +150,12 @@ namespace Renderer
 		~ComputePipelineStateCompiler();
 		ComputePipelineStateCompiler& operator=(const ComputePipelineStateCompiler&) = delete;
 		void addAsynchronousCompilerRequest(ComputePipelineStateCache& computePipelineStateCache);
+		void addWarmUpCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, ComputePipelineStateCache& computePipelineStateCache);
 		void instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, ComputePipelineStateCache& computePipelineStateCache);
 		void flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests);
 		void builderThreadWorker();
 		void compilerThreadWorker();
-		[[nodiscard]] Rhi::IComputePipelineState* createComputePipelineState(const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShader& shader) const;
+		[[nodiscard]] Rhi::IComputePipelineState* createComputePipelineState(const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShader& shader, const Rhi::PipelineStateBinary& pipelineStateBinary) const;
 
 
 	//[-------------------------------------------------------]
@@ -150,6 +166,7 @@ namespace Renderer
 		bool				  mAsynchronousCompilationEnabled;
 		uint32_t			  mNumberOfCompilerThreads;
 		std::atomic<uint32_t> mNumberOfInFlightCompilerRequests;
+		uint32_t			  mNumberOfWarmUpCompilerRequests;	// Only touched by the main thread
 
 		// Asynchronous building (moderate cost)
 		std::atomic<bool>		mShutdownBuilderThread;
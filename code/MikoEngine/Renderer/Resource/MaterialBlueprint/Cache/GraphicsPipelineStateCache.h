@@ -97,6 +97,7 @@ namespace Renderer
 		GraphicsPipelineStateSignature mGraphicsPipelineStateSignature;
 		Rhi::IGraphicsPipelineStatePtr mGraphicsPipelineStateObjectPtr;
 		bool						   mIsUsingFallback;					// If "true", this graphics pipeline state cache is currently using fallback data because it's in asynchronous compilation
+		Rhi::PipelineStateBinary	   mPipelineStateBinary;				// Backend binary read from the pipeline state object cache, cleared as soon as the graphics pipeline state object has been created
 
 
 	};
@@ -169,14 +169,13 @@ namespace Renderer
 		return nullptr;
 	}
 
-	void GraphicsPipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file)
+	void GraphicsPipelineStateCacheManager::loadPipelineStateObjectCache(IFile& file, bool usePipelineStateBinaries)
 	{
 		// Material blueprint resource ID, all graphics pipeline state cache share the same material blueprint resource ID
 		MaterialBlueprintResourceId materialBlueprintResourceId = GetInvalid<MaterialBlueprintResourceId>();
 		file.read(&materialBlueprintResourceId, sizeof(uint32_t));
 		SE_ASSERT(mMaterialBlueprintResource.getId() == materialBlueprintResourceId, "Invalid material blueprint resource ID")
 
-		// TODO(co) Currently only the graphics pipeline state signature ID is loaded, not the resulting binary pipeline state cache
 		uint32_t numberOfGraphicsPipelineStateCaches = GetInvalid<uint32_t>();
 		file.read(&numberOfGraphicsPipelineStateCaches, sizeof(uint32_t));
 		mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.reserve(numberOfGraphicsPipelineStateCaches);
@@ -202,8 +201,24 @@ namespace Renderer
 			// Register
 			mTemporaryGraphicsPipelineStateSignature.set(mMaterialBlueprintResource, serializedGraphicsPipelineStateHash, shaderProperties);
 			GraphicsPipelineStateCache* graphicsPipelineStateCache = new GraphicsPipelineStateCache(mTemporaryGraphicsPipelineStateSignature);
+
+			{ // Read the backend pipeline state binary, it's only used if it was created by the currently used GPU and driver
+				uint32_t numberOfBinaryBytes = 0;
+				file.read(&numberOfBinaryBytes, sizeof(uint32_t));
+				if (numberOfBinaryBytes > 0)
+				{
+					if (usePipelineStateBinaries)
+					{
+						file.read(graphicsPipelineStateCache->mPipelineStateBinary.allocateBinary(numberOfBinaryBytes), numberOfBinaryBytes);
+					}
+					else
+					{
+						file.skip(numberOfBinaryBytes);
+					}
+				}
+			}
 			mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.emplace(mTemporaryGraphicsPipelineStateSignature.getGraphicsPipelineStateSignatureId(), graphicsPipelineStateCache);
-			graphicsPipelineStateCompiler.instantSynchronousCompilerRequest(mMaterialBlueprintResource, *graphicsPipelineStateCache);
+			graphicsPipelineStateCompiler.addWarmUpCompilerRequest(mMaterialBlueprintResource, *graphicsPipelineStateCache);
 		}
 
 		// Done
@@ -216,7 +231,6 @@ namespace Renderer
 		const MaterialBlueprintResourceId materialBlueprintResourceId = mMaterialBlueprintResource.getId();
 		file.write(&materialBlueprintResourceId, sizeof(uint32_t));
 
-		// TODO(co) Currently only the graphics pipeline state signature ID is saved, not the resulting binary pipeline state cache
 		const uint32_t numberOfGraphicsPipelineStateCaches = static_cast<uint32_t>(mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId.size());
 		file.write(&numberOfGraphicsPipelineStateCaches, sizeof(uint32_t));
 		for (const auto& elementPair : mGraphicsPipelineStateCacheByGraphicsPipelineStateSignatureId)
@@ -240,6 +254,23 @@ namespace Renderer
 					file.write(sortedPropertyVector.data(), sizeof(ShaderProperties::Property) * numberOfShaderProperties);
 				}
 			}
+
+			{ // Write the backend pipeline state binary
+				// -> Prefer the binary of the created pipeline state object, else keep the loaded binary of a pipeline state object which hasn't been created, yet
+				const GraphicsPipelineStateCache& graphicsPipelineStateCache = *elementPair.second;
+				Rhi::PipelineStateBinary createdPipelineStateBinary;
+				const Rhi::PipelineStateBinary* pipelineStateBinary = &graphicsPipelineStateCache.mPipelineStateBinary;
+				if (!graphicsPipelineStateCache.mIsUsingFallback && nullptr != graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr && graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr->getPipelineStateBinary(createdPipelineStateBinary))
+				{
+					pipelineStateBinary = &createdPipelineStateBinary;
+				}
+				const uint32_t numberOfBinaryBytes = pipelineStateBinary->getNumberOfBytes();
+				file.write(&numberOfBinaryBytes, sizeof(uint32_t));
+				if (numberOfBinaryBytes > 0)
+				{
+					file.write(pipelineStateBinary->getBinary(), numberOfBinaryBytes);
+				}
+			}
 		}
 
 		// Done
@@ -22,6 +22,28 @@
 SE_PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_IDLE_ITERATIONS = 1024;	// Number of yielding idle iterations before a builder thread goes to sleep
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -47,6 +69,33 @@ namespace Renderer
 		}
 	}
 
+	void GraphicsPipelineStateCompiler::setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads)
+	{
+		if (mNumberOfBuilderThreads != numberOfBuilderThreads)
+		{
+			// Builder threads shutdown, compiler requests still inside the builder queue are processed by the new builder threads
+			{
+				std::lock_guard<std::mutex> builderSleepMutexLock(mBuilderSleepMutex);
+				mShutdownBuilderThreads = true;
+			}
+			mBuilderConditionVariable.notify_all();
+			for (std::thread& thread : mBuilderThreads)
+			{
+				thread.join();
+			}
+
+			// Create the builder threads building the shader source codes, each builder thread has its own shader builder
+			mNumberOfBuilderThreads = numberOfBuilderThreads;
+			mBuilderThreads.clear();
+			mBuilderThreads.reserve(mNumberOfBuilderThreads);
+			mShutdownBuilderThreads = false;
+			for (uint32_t i = 0; i < mNumberOfBuilderThreads; ++i)
+			{
+				mBuilderThreads.push_back(std::thread(&GraphicsPipelineStateCompiler::builderThreadWorker, this));
+			}
+		}
+	}
+
 	void GraphicsPipelineStateCompiler::setNumberOfCompilerThreads(uint32_t numberOfCompilerThreads)
 	{
 		if (mNumberOfCompilerThreads != numberOfCompilerThreads)
@@ -71,11 +120,24 @@ namespace Renderer
 		}
 	}
 
+	void GraphicsPipelineStateCompiler::flushBuilderQueue()
+	{
+		// The builder stage is flushed as soon as all compiler requests left it, including the ones currently built
+		while (0 != mNumberOfBuilderCompilerRequests)
+		{
+			dispatch();
+
+			// Wait for a moment to not totally pollute the CPU
+			using namespace std::chrono_literals;
+			std::this_thread::sleep_for(1ms);
+		}
+		dispatch();
+	}
+
 	void GraphicsPipelineStateCompiler::dispatch()
 	{
 		// Synchronous dispatch
-		// TODO(co) Add maximum dispatch time budget
-		// TODO(co) More clever mutex usage in order to reduce pipeline state compiler stalls due to synchronization
+		// -> The RHI resources were already created by the compiler threads, in here the compiled graphics pipeline state objects are just handed over
 		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
 		while (!mDispatchQueue.empty())
 		{
@@ -87,9 +149,16 @@ namespace Renderer
 			GraphicsPipelineStateCache& graphicsPipelineStateCache = compilerRequest.graphicsPipelineStateCache;
 			graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = compilerRequest.graphicsPipelineStateObject;
 			graphicsPipelineStateCache.mIsUsingFallback = false;
+			graphicsPipelineStateCache.mPipelineStateBinary.clear();
 			SE_ASSERT(0 != mNumberOfInFlightCompilerRequests, "Invalid number of in flight compiler requests")
 			--mNumberOfInFlightCompilerRequests;
 		}
+
+		// The pipeline state object cache warm-up is finished as soon as there are no in flight compiler requests left
+		if (0 == mNumberOfInFlightCompilerRequests)
+		{
+			mNumberOfWarmUpCompilerRequests = 0;
+		}
 	}
 
 
@@ -101,34 +170,61 @@ namespace Renderer
 		mAsynchronousCompilationEnabled(renderer.getRhi().getCapabilities().nativeMultithreading),
 		mNumberOfCompilerThreads(0),
 		mNumberOfInFlightCompilerRequests(0),
-		mShutdownBuilderThread(false),
-		mBuilderThread(&GraphicsPipelineStateCompiler::builderThreadWorker, this),
+		mNumberOfWarmUpCompilerRequests(0),
+		mNumberOfBuilderThreads(0),
+		mShutdownBuilderThreads(false),
+		mBuilderQueue(BUILDER_QUEUE_CAPACITY),
+		mNumberOfQueuedBuilderCompilerRequests(0),
+		mNumberOfBuilderCompilerRequests(0),
+		mNumberOfSleepingBuilderThreads(0),
 		mShutdownCompilerThread(false)
 	{
 		// Create and start the threads
+		setNumberOfBuilderThreads(2);
 		setNumberOfCompilerThreads(2);
 	}
 
 	GraphicsPipelineStateCompiler::~GraphicsPipelineStateCompiler()
 	{
-		// Builder thread shutdown
-		mShutdownBuilderThread = true;
-		mBuilderConditionVariable.notify_one();
-		mBuilderThread.join();
+		// Builder threads shutdown
+		setNumberOfBuilderThreads(0);
 
 		// Compiler threads shutdown
 		setNumberOfCompilerThreads(0);
+
+		// Destroy the compiler requests which never left the builder stage
+		CompilerRequest* compilerRequest = nullptr;
+		while (mBuilderQueue.tryPop(compilerRequest))
+		{
+			delete compilerRequest;
+		}
+		for (auto& waitingCompilerRequestElement : mWaitingCompilerRequests)
+		{
+			delete waitingCompilerRequestElement.second;
+		}
 	}
 
 	void GraphicsPipelineStateCompiler::addAsynchronousCompilerRequest(GraphicsPipelineStateCache& graphicsPipelineStateCache)
 	{
-		// Push the load request into the builder queue
+		// Push the compiler request into the builder queue
 		SE_ASSERT(mAsynchronousCompilationEnabled, "Asynchronous compilation isn't enabled")
 		++mNumberOfInFlightCompilerRequests;
-		std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
-		mBuilderQueue.emplace_back(CompilerRequest(graphicsPipelineStateCache));
-		builderMutexLock.unlock();
-		mBuilderConditionVariable.notify_one();
+		++mNumberOfBuilderCompilerRequests;
+		pushToBuilderQueue(*new CompilerRequest(graphicsPipelineStateCache));
+	}
+
+	void GraphicsPipelineStateCompiler::addWarmUpCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache)
+	{
+		// Spread the pipeline state object cache warm-up across the builder threads and the compiler threads, the synchronous fallback compiles one pipeline state after another
+		if (mAsynchronousCompilationEnabled)
+		{
+			++mNumberOfWarmUpCompilerRequests;
+			addAsynchronousCompilerRequest(graphicsPipelineStateCache);
+		}
+		else
+		{
+			instantSynchronousCompilerRequest(materialBlueprintResource, graphicsPipelineStateCache);
+		}
 	}
 
 	void GraphicsPipelineStateCompiler::instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache)
@@ -141,7 +237,8 @@ namespace Renderer
 			const Rhi::IGraphicsProgramPtr& graphicsProgramPtr = graphicsProgramCache->getGraphicsProgramPtr();
 			if (nullptr != graphicsProgramPtr)
 			{
-				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramPtr);
+				graphicsPipelineStateCache.mGraphicsPipelineStateObjectPtr = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgramPtr, graphicsPipelineStateCache.mPipelineStateBinary);
+				graphicsPipelineStateCache.mPipelineStateBinary.clear();
 			}
 		}
 	}
@@ -166,169 +263,208 @@ namespace Renderer
 		} while (!everythingFlushed);
 	}
 
-	void GraphicsPipelineStateCompiler::builderThreadWorker()
+	void GraphicsPipelineStateCompiler::pushToBuilderQueue(CompilerRequest& compilerRequest)
+	{
+		// The builder queue is bounded, if it's full the producer has to wait until a builder thread made some room
+		while (!mBuilderQueue.tryPush(&compilerRequest))
+		{
+			std::this_thread::yield();
+		}
+
+		// Wake up a sleeping builder thread, if there's one (the sleep mutex lock ensures the wake up isn't lost while the builder thread is about to go to sleep)
+		++mNumberOfQueuedBuilderCompilerRequests;
+		if (mNumberOfSleepingBuilderThreads > 0)
+		{
+			std::lock_guard<std::mutex> builderSleepMutexLock(mBuilderSleepMutex);
+			mBuilderConditionVariable.notify_one();
+		}
+	}
+
+	bool GraphicsPipelineStateCompiler::popFromBuilderQueue(CompilerRequest*& compilerRequest)
+	{
+		// Blocks until there's a compiler request or the builder threads get shut down, in which case "false" is returned
+		uint32_t numberOfIdleIterations = 0;
+		while (!mShutdownBuilderThreads)
+		{
+			if (mBuilderQueue.tryPop(compilerRequest))
+			{
+				--mNumberOfQueuedBuilderCompilerRequests;
+				return true;
+			}
+
+			if (numberOfIdleIterations < ::detail::MAXIMUM_NUMBER_OF_IDLE_ITERATIONS)
+			{
+				// Stay responsive for a while, compiler requests usually come in bursts
+				std::this_thread::yield();
+				++numberOfIdleIterations;
+			}
+			else
+			{
+				// Go to sleep until there's new work to do
+				std::unique_lock<std::mutex> builderSleepMutexLock(mBuilderSleepMutex);
+				++mNumberOfSleepingBuilderThreads;
+				mBuilderConditionVariable.wait(builderSleepMutexLock, [this]() { return (mShutdownBuilderThreads || mNumberOfQueuedBuilderCompilerRequests > 0); });
+				--mNumberOfSleepingBuilderThreads;
+				numberOfIdleIterations = 0;
+			}
+		}
+		return false;
+	}
+
+	bool GraphicsPipelineStateCompiler::buildCompilerRequest(CompilerRequest& compilerRequest, ShaderBuilder& shaderBuilder)
 	{
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
 		ShaderBlueprintResourceManager& shaderBlueprintResourceManager = mRenderer.getShaderBlueprintResourceManager();
 		ShaderCacheManager& shaderCacheManager = shaderBlueprintResourceManager.getShaderCacheManager();
 		const ShaderPieceResourceManager& shaderPieceResourceManager = mRenderer.getShaderPieceResourceManager();
-		ShaderBuilder shaderBuilder;
+		const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = compilerRequest.graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
+		MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(graphicsPipelineStateSignature.getMaterialBlueprintResourceId());
+
+		// First at all, check whether or not the graphics program cache entry we need already exists, if so we can take a shortcut and only have to care about creating the graphics pipeline state
+		// -> There are multiple builder threads, so checking and claiming an in flight graphics program cache must be done at once
+		GraphicsProgramCacheManager& graphicsProgramCacheManager = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager();
+		GraphicsProgramCacheId graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId;
+		if (IsInvalid(graphicsProgramCacheId))
+		{
+			graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId = GraphicsProgramCacheManager::generateGraphicsProgramCacheId(graphicsPipelineStateSignature);
+		}
+		Rhi::IGraphicsProgram* graphicsProgram = nullptr;
+		{
+			std::lock_guard<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
+			if (mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId) != mInFlightGraphicsProgramCaches.end())
+			{
+				// Another compiler request is already creating the graphics program cache we need, park the compiler request until it's done
+				mWaitingCompilerRequests.emplace(graphicsProgramCacheId, &compilerRequest);
+				return false;
+			}
+			std::lock_guard<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
+			const GraphicsProgramCacheManager::GraphicsProgramCacheById::const_iterator iterator = graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId);
+			if (graphicsProgramCacheManager.mGraphicsProgramCacheById.cend() != iterator)
+			{
+				graphicsProgram = iterator->second->getGraphicsProgramPtr();
+			}
+			else
+			{
+				// Graphics program cache is now in flight
+				mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId);
+			}
+		}
+		if (nullptr != graphicsProgram)
+		{
+			// Shortcut since the graphics program cache entry already exists: Just create the graphics pipeline state object (PSO) and push the compiler request into the queue of the synchronous shader dispatch
+			compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgram, compilerRequest.graphicsPipelineStateCache.mPipelineStateBinary);
+			std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+			mDispatchQueue.emplace_back(compilerRequest);
+			return true;
+		}
 
-		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 1", "Renderer: Pipeline state compiler stage: 1. Asynchronous shader building")
-		while (!mShutdownBuilderThread)
+		// Build the shader source code for the required combination
+		for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
 		{
-			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> builderMutexLock(mBuilderMutex);
-			mBuilderConditionVariable.wait(builderMutexLock);
-			while (!mBuilderQueue.empty() && !mShutdownBuilderThread)
+			// Get the shader blueprint resource ID
+			const GraphicsShaderType graphicsShaderType = static_cast<GraphicsShaderType>(i);
+			const ShaderBlueprintResourceId shaderBlueprintResourceId = materialBlueprintResource.getGraphicsShaderBlueprintResourceId(graphicsShaderType);
+			if (IsValid(shaderBlueprintResourceId))
 			{
-				// Get the compiler request
-				CompilerRequest compilerRequest(mBuilderQueue.back());
-				mBuilderQueue.pop_back();
-				builderMutexLock.unlock();
-				bool pushToCompilerQueue = true;
-				bool needToWaitForGraphicsProgramCache = false;
-
-				{ // Do the work: Building the shader source code for the required combination
-					const GraphicsPipelineStateSignature& graphicsPipelineStateSignature = compilerRequest.graphicsPipelineStateCache.getGraphicsPipelineStateSignature();
-					MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(graphicsPipelineStateSignature.getMaterialBlueprintResourceId());
-
-					// First at all, check whether or not the graphics program cache entry we need already exists, if so we can take a shortcut and only have to care about creating the graphics pipeline state
-					GraphicsProgramCacheManager& graphicsProgramCacheManager = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager();
-					GraphicsProgramCacheId graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId;
-					if (IsInvalid(graphicsProgramCacheId))
+				// Get the shader cache identifier, often but not always identical to the shader combination ID
+				const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
+
+				// Does the shader cache already exist?
+				ShaderCache* shaderCache = nullptr;
+				{
+					std::lock_guard<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+					ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
+					if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
 					{
-						graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId = GraphicsProgramCacheManager::generateGraphicsProgramCacheId(graphicsPipelineStateSignature);
-					}
-					{ // In flight graphics program caches handling
-						std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-						if (mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId) != mInFlightGraphicsProgramCaches.end())
-						{
-							needToWaitForGraphicsProgramCache = true;
-						}
+						shaderCache = shaderCacheIdIterator->second;
 					}
-					if (!needToWaitForGraphicsProgramCache)
+				}
+				if (nullptr == shaderCache)
+				{
+					// Try to create the new graphics shader cache instance
+					const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
+					if (nullptr != shaderBlueprintResource)
 					{
-						std::unique_lock<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
-						const GraphicsProgramCacheManager::GraphicsProgramCacheById::const_iterator iterator = graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId);
-						if (graphicsProgramCacheManager.mGraphicsProgramCacheById.cend() != iterator)
+						// Build the shader source code
+						// -> The shader cache manager isn't locked while building, so the builder threads don't stall each other
+						ShaderBuilder::BuildShader buildShader;
+						shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, graphicsPipelineStateSignature.getShaderProperties(), buildShader);
+						std::string& sourceCode = buildShader.sourceCode;
+						if (sourceCode.empty())
 						{
-							// Shortcut since the graphics program cache entry already exists: Just create the graphics pipeline state and be done with it
-
-							// Create the graphics pipeline state object (PSO)
-							compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *iterator->second->getGraphicsProgramPtr());
-							pushToCompilerQueue = false;
+							// TODO(co) Error handling
+							SE_ASSERT(false, "Invalid source code")
 						}
 						else
 						{
-							// Build the shader source code for the required combination
-							graphicsProgramCacheManagerMutexLock.unlock();
-							{ // Graphics program cache is now in flight
-								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-								mInFlightGraphicsProgramCaches.insert(graphicsProgramCacheId);
+							// Add the virtual filename of the shader blueprint asset as first shader source code line to make shader debugging easier
+							sourceCode = std::string("// ") + mRenderer.getAssetManager().getAssetByAssetId(shaderBlueprintResource->getAssetId()).virtualFilename + '\n' + sourceCode;
+
+							// Generate the shader source code ID
+							// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
+							// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
+							const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
+							std::lock_guard<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+							ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
+							if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
+							{
+								// Another builder thread was faster
+								shaderCache = shaderCacheIdIterator->second;
 							}
-							for (uint8_t i = 0; i < NUMBER_OF_GRAPHICS_SHADER_TYPES; ++i)
+							else
 							{
-								// Get the shader blueprint resource ID
-								const GraphicsShaderType graphicsShaderType = static_cast<GraphicsShaderType>(i);
-								const ShaderBlueprintResourceId shaderBlueprintResourceId = materialBlueprintResource.getGraphicsShaderBlueprintResourceId(graphicsShaderType);
-								if (IsValid(shaderBlueprintResourceId))
+								ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
+								if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
 								{
-									// Get the shader cache identifier, often but not always identical to the shader combination ID
-									const ShaderCacheId shaderCacheId = graphicsPipelineStateSignature.getShaderCombinationId(graphicsShaderType);
-
-									// Does the shader cache already exist?
-									ShaderCache* shaderCache = nullptr;
-									std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
-									ShaderCacheManager::ShaderCacheByShaderCacheId::const_iterator shaderCacheIdIterator = shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderCacheId);
-									if (shaderCacheIdIterator != shaderCacheManager.mShaderCacheByShaderCacheId.cend())
-									{
-										shaderCache = shaderCacheIdIterator->second;
-									}
-									else
-									{
-										// Try to create the new graphics shader cache instance
-										const ShaderBlueprintResource* shaderBlueprintResource = shaderBlueprintResourceManager.tryGetById(shaderBlueprintResourceId);
-										if (nullptr != shaderBlueprintResource)
-										{
-											// Build the shader source code
-											ShaderBuilder::BuildShader buildShader;
-											shaderBuilder.createSourceCode(shaderPieceResourceManager, *shaderBlueprintResource, graphicsPipelineStateSignature.getShaderProperties(), buildShader);
-											std::string& sourceCode = buildShader.sourceCode;
-											if (sourceCode.empty())
-											{
-												// TODO(co) Error handling
-												SE_ASSERT(false, "Invalid source code")
-											}
-											else
-											{
-												// Add the virtual filename of the shader blueprint asset as first shader source code line to make shader debugging easier
-												sourceCode = std::string("// ") + mRenderer.getAssetManager().getAssetByAssetId(shaderBlueprintResource->getAssetId()).virtualFilename + '\n' + sourceCode;
-
-												// Generate the shader source code ID
-												// -> Especially in complex shaders, there are situations where different shader combinations result in one and the same shader source code
-												// -> Shader compilation is considered to be expensive, so we need to be pretty sure that we really need to perform this heavy work
-												const ShaderSourceCodeId shaderSourceCodeId = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(sourceCode.c_str()), static_cast<uint32_t>(sourceCode.size()));
-												ShaderCacheManager::ShaderCacheByShaderSourceCodeId::const_iterator shaderSourceCodeIdIterator = shaderCacheManager.mShaderCacheByShaderSourceCodeId.find(shaderSourceCodeId);
-												if (shaderSourceCodeIdIterator != shaderCacheManager.mShaderCacheByShaderSourceCodeId.cend())
-												{
-													// Reuse already existing shader instance
-													// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
-													shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-												}
-												else
-												{
-													// Create the new shader cache instance
-													shaderCache = new ShaderCache(shaderCacheId);
-													shaderCache->mAssetIds = buildShader.assetIds;
-													shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
-													shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
-													shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
-													compilerRequest.shaderSourceCode[i] = sourceCode;
-												}
-											}
-										}
-										else
-										{
-											// TODO(co) Error handling
-											SE_ASSERT(false, "Invalid shader blueprint resource")
-										}
-									}
-									compilerRequest.shaderCache[i] = shaderCache;
+									// Reuse already existing shader instance
+									// -> We still have to create a shader cache instance so we don't need to build the shader source code again next time
+									shaderCache = new ShaderCache(shaderCacheId, shaderCacheManager.mShaderCacheByShaderCacheId.find(shaderSourceCodeIdIterator->second)->second);
+									shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+								}
+								else
+								{
+									// Create the new shader cache instance
+									shaderCache = new ShaderCache(shaderCacheId);
+									shaderCache->mAssetIds = buildShader.assetIds;
+									shaderCache->mCombinedAssetFileHashes = buildShader.combinedAssetFileHashes;
+									shaderCacheManager.mShaderCacheByShaderCacheId.emplace(shaderCacheId, shaderCache);
+									shaderCacheManager.mShaderCacheByShaderSourceCodeId.emplace(shaderSourceCodeId, shaderCacheId);
+									compilerRequest.shaderSourceCode[i] = sourceCode;
 								}
 							}
 						}
 					}
-				}
-
-				// Push the compiler request into the correct queue
-				if (needToWaitForGraphicsProgramCache)
-				{
-					// Throw the fish back into the see
-					builderMutexLock.lock();
-					mBuilderQueue.emplace_front(compilerRequest);
-				}
-				else
-				{
-					if (pushToCompilerQueue)
-					{
-						// Push the compiler request into the queue of the asynchronous shader compilation
-						std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
-						mCompilerQueue.emplace_back(compilerRequest);
-						compilerMutexLock.unlock();
-						mCompilerConditionVariable.notify_one();
-					}
 					else
 					{
-						// Shortcut: Push the compiler request into the queue of the synchronous shader dispatch
-						std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-						mDispatchQueue.emplace_back(compilerRequest);
+						// TODO(co) Error handling
+						SE_ASSERT(false, "Invalid shader blueprint resource")
 					}
-
-					// We're ready for the next round
-					builderMutexLock.lock();
 				}
+				compilerRequest.shaderCache[i] = shaderCache;
+			}
+		}
+
+		// Push the compiler request into the queue of the asynchronous shader compilation
+		std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
+		mCompilerQueue.emplace_back(compilerRequest);
+		compilerMutexLock.unlock();
+		mCompilerConditionVariable.notify_one();
+		return true;
+	}
+
+	void GraphicsPipelineStateCompiler::builderThreadWorker()
+	{
+		ShaderBuilder shaderBuilder;	// Each builder thread has its own shader builder scratch state
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 1", "Renderer: Pipeline state compiler stage: 1. Asynchronous shader building")
+		CompilerRequest* compilerRequest = nullptr;
+		while (popFromBuilderQueue(compilerRequest))
+		{
+			// A compiler request which doesn't leave the builder stage is parked and pushed back into the builder queue by the compiler thread creating the graphics program cache it's waiting for
+			if (buildCompilerRequest(*compilerRequest, shaderBuilder))
+			{
+				// The compiler request left the builder stage
+				delete compilerRequest;
+				--mNumberOfBuilderCompilerRequests;
 			}
 		}
 	}
@@ -337,12 +473,13 @@ namespace Renderer
 	{
 		Rhi::IShaderLanguage& shaderLanguage = mRenderer.getRhi().getDefaultShaderLanguage();
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		ShaderCacheManager& shaderCacheManager = mRenderer.getShaderBlueprintResourceManager().getShaderCacheManager();
 		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("PSC: Stage 2", "Renderer: Pipeline state compiler stage: 2. Asynchronous shader compilation")
 		while (!mShutdownCompilerThread)
 		{
 			// Continue as long as there's a compiler request left inside the queue, if it's empty go to sleep
 			std::unique_lock<std::mutex> compilerMutexLock(mCompilerMutex);
-			mCompilerConditionVariable.wait(compilerMutexLock);
+			mCompilerConditionVariable.wait(compilerMutexLock, [this]() { return (!mCompilerQueue.empty() || mShutdownCompilerThread); });
 			while (!mCompilerQueue.empty() && !mShutdownCompilerThread)
 			{
 				// Get the compiler request
@@ -365,9 +502,20 @@ namespace Renderer
 							const std::string& shaderSourceCode = compilerRequest.shaderSourceCode[i];
 							if (shaderSourceCode.empty())
 							{
-								// We're not aware of any shader source code but we need a shader cache, so, there must be a shader cache master we need to wait for
+								// We're not aware of any shader source code but we need a shader cache: Either the shader cache was loaded from the pipeline state object cache
+								// and the shader instance is created using the cached shader bytecode, or there must be a shader cache master we need to wait for
+								// -> A shader cache loaded from the pipeline state object cache has no shader instance, no shader source code and no one else is going to create
+								//    the shader instance, so waiting for it would requeue the compiler request forever and the warm-up would never finish
 								// SE_ASSERT(nullptr != shaderCache->getMasterShaderCache(), "Invalid master shader cache")	// No assert by intent
-								needToWaitForShaderCache = true;
+								ShaderCache& masterShaderCache = (nullptr != shaderCache->getMasterShaderCache()) ? *shaderCache->getMasterShaderCache() : *shaderCache;
+								std::unique_lock<std::mutex> shaderCacheManagerMutexLock(shaderCacheManager.mMutex);
+								if (nullptr == masterShaderCache.mShaderPtr.GetPointer() && masterShaderCache.hasShaderBytecode())
+								{
+									const MaterialBlueprintResource& materialBlueprintResource = materialBlueprintResourceManager.getById(compilerRequest.graphicsPipelineStateCache.getGraphicsPipelineStateSignature().getMaterialBlueprintResourceId());
+									shaderCacheManager.createGraphicsShaderFromBytecode(shaderCacheManagerMutexLock, masterShaderCache, materialBlueprintResource, shaderLanguage, static_cast<GraphicsShaderType>(i));
+								}
+								shaders[i] = masterShaderCache.mShaderPtr;
+								needToWaitForShaderCache = (nullptr == shaders[i]);
 							}
 							else
 							{
@@ -426,23 +574,39 @@ namespace Renderer
 						);
 
 						// Create the graphics pipeline state object (PSO)
-						compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgram);
+						compilerRequest.graphicsPipelineStateObject = createGraphicsPipelineState(materialBlueprintResource, graphicsPipelineStateSignature.getSerializedGraphicsPipelineStateHash(), *graphicsProgram, compilerRequest.graphicsPipelineStateCache.mPipelineStateBinary);
 
 						{ // Graphics program cache entry
 							GraphicsProgramCacheManager& graphicsProgramCacheManager = materialBlueprintResource.getGraphicsPipelineStateCacheManager().getGraphicsProgramCacheManager();
 							const GraphicsProgramCacheId graphicsProgramCacheId = compilerRequest.graphicsProgramCacheId;
 							SE_ASSERT(IsValid(graphicsProgramCacheId), "Invalid graphics program cache ID")
-							std::unique_lock<std::mutex> mutexLock(graphicsProgramCacheManager.mMutex);
-							SE_ASSERT(graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId) == graphicsProgramCacheManager.mGraphicsProgramCacheById.cend(), "Invalid graphics program cache ID")	// TODO(co) Error handling
-							graphicsProgramCacheManager.mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
-
-							{ // The graphics program cache is no longer in flight
-								std::unique_lock<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
-								const InFlightGraphicsProgramCaches::const_iterator iterator = mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId);
-								SE_ASSERT(mInFlightGraphicsProgramCaches.end() != iterator, "Invalid graphics program cache ID")
-								mInFlightGraphicsProgramCaches.erase(iterator);
+							{
+								std::lock_guard<std::mutex> graphicsProgramCacheManagerMutexLock(graphicsProgramCacheManager.mMutex);
+								SE_ASSERT(graphicsProgramCacheManager.mGraphicsProgramCacheById.find(graphicsProgramCacheId) == graphicsProgramCacheManager.mGraphicsProgramCacheById.cend(), "Invalid graphics program cache ID")	// TODO(co) Error handling
+								graphicsProgramCacheManager.mGraphicsProgramCacheById.emplace(graphicsProgramCacheId, new GraphicsProgramCache(graphicsProgramCacheId, *graphicsProgram));
+							}
+
+							{ // The graphics program cache is no longer in flight, waiting compiler requests inside the builder stage can now take the shortcut
+								// -> Not locked together with the graphics program cache manager mutex, the builder threads lock the in flight graphics program caches mutex first
+								// -> The parked compiler requests are pushed back into the builder queue outside the lock since the bounded builder queue might be full
+								std::vector<CompilerRequest*> waitingCompilerRequests;
+								{
+									std::lock_guard<std::mutex> inFlightGraphicsProgramCachesMutexLock(mInFlightGraphicsProgramCachesMutex);
+									const InFlightGraphicsProgramCaches::const_iterator iterator = mInFlightGraphicsProgramCaches.find(graphicsProgramCacheId);
+									SE_ASSERT(mInFlightGraphicsProgramCaches.end() != iterator, "Invalid graphics program cache ID")
+									mInFlightGraphicsProgramCaches.erase(iterator);
+									const std::pair<WaitingCompilerRequests::iterator, WaitingCompilerRequests::iterator> range = mWaitingCompilerRequests.equal_range(graphicsProgramCacheId);
+									for (WaitingCompilerRequests::iterator waitingIterator = range.first; waitingIterator != range.second; ++waitingIterator)
+									{
+										waitingCompilerRequests.push_back(waitingIterator->second);
+									}
+									mWaitingCompilerRequests.erase(range.first, range.second);
+								}
+								for (CompilerRequest* waitingCompilerRequest : waitingCompilerRequests)
+								{
+									pushToBuilderQueue(*waitingCompilerRequest);
+								}
 							}
-							mBuilderConditionVariable.notify_one();
 						}
 					}
 
@@ -462,7 +626,7 @@ namespace Renderer
 		}
 	}
 
-	Rhi::IGraphicsPipelineState* GraphicsPipelineStateCompiler::createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram) const
+	Rhi::IGraphicsPipelineState* GraphicsPipelineStateCompiler::createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram, const Rhi::PipelineStateBinary& pipelineStateBinary) const
 	{
 		// Start with the graphics pipeline state of the material blueprint resource, then copy over serialized graphics pipeline state
 		Rhi::GraphicsPipelineState graphicsPipelineState = materialBlueprintResource.getGraphicsPipelineState();
@@ -474,6 +638,7 @@ namespace Renderer
 		graphicsPipelineState.rootSignature	   = rootSignaturePtr;
 		graphicsPipelineState.graphicsProgram  = &graphicsProgram;
 		graphicsPipelineState.vertexAttributes = renderer.getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+		graphicsPipelineState.pipelineStateBinary = (0 != pipelineStateBinary.getNumberOfBytes()) ? &pipelineStateBinary : nullptr;	// Backend binary from the pipeline state object cache, skips the driver compilation
 
 		{ // TODO(co) Render pass related update, the render pass in here is currently just a dummy so the debug compositor works
 			Rhi::IRhi& rhi = rootSignaturePtr->getRhi();
@@ -5,6 +5,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Resource/ShaderBlueprint/GraphicsShaderType.h"
+#include "Renderer/Core/Thread/BoundedMpmcQueue.h"
 #include "Core/GetInvalid.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -26,6 +27,7 @@ SE_PRAGMA_WARNING_PUSH
 	#include <mutex>
 	#include <thread>
 	#include <unordered_set>
+	#include <unordered_map>
 	#include <condition_variable>
 SE_PRAGMA_WARNING_POP
 
@@ -41,6 +43,7 @@ namespace Rhi
 namespace Renderer
 {
 	class ShaderCache;
+	class ShaderBuilder;
 	class IRenderer;
 	class MaterialBlueprintResource;
 	class GraphicsPipelineStateCache;
@@ -73,6 +76,10 @@ namespace Renderer
 	*    2. Asynchronous shader compilation
 	*    3. Synchronous RHI implementation dispatch TODO(co) Asynchronous RHI implementation dispatch if supported by the RHI implementation
 	*
+	*    The shader building is done by a pool of builder threads, each with its own shader builder, fed by a lock-free queue. Shader
+	*    permutation bursts e.g. after a material swap are spread across all builder threads. Compiler requests waiting for an in flight
+	*    graphics program cache are parked until the compiler thread creating it is done, they don't keep the builder threads busy.
+	*
 	*  @note
 	*    - Takes care of asynchronous graphics pipeline state compilation
 	*/
@@ -87,6 +94,13 @@ namespace Renderer
 		friend class GraphicsPipelineStateCacheManager;	// Only the graphics pipeline state cache manager is allowed to commit compiler requests
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t BUILDER_QUEUE_CAPACITY = 4096;	// Maximum number of compiler requests inside the builder queue, must be a power of two
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -98,6 +112,13 @@ namespace Renderer
 
 		void setAsynchronousCompilationEnabled(bool enabled);
 
+		[[nodiscard]] inline uint32_t getNumberOfBuilderThreads() const
+		{
+			return mNumberOfBuilderThreads;
+		}
+
+		void setNumberOfBuilderThreads(uint32_t numberOfBuilderThreads);
+
 		[[nodiscard]] inline uint32_t getNumberOfCompilerThreads() const
 		{
 			return mNumberOfCompilerThreads;
@@ -110,11 +131,23 @@ namespace Renderer
 			return mNumberOfInFlightCompilerRequests;
 		}
 
-		inline void flushBuilderQueue()
+		/**
+		*  @brief
+		*    Return the number of compiler requests committed by the pipeline state object cache warm-up
+		*
+		*  @return
+		*    The number of warm-up compiler requests, reset to zero as soon as there are no in flight compiler requests left
+		*
+		*  @note
+		*    - Together with "getNumberOfInFlightCompilerRequests()" this is the progress of the pipeline state object cache warm-up
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfWarmUpCompilerRequests() const
 		{
-			flushQueue(mBuilderMutex, mBuilderQueue);
+			return mNumberOfWarmUpCompilerRequests;
 		}
 
+		void flushBuilderQueue();
+
 		inline void flushCompilerQueue()
 		{
 			flushQueue(mCompilerMutex, mCompilerQueue);
@@ -167,6 +200,9 @@ namespace Renderer
 			CompilerRequest& operator=(const CompilerRequest&) = delete;
 		};
 
+		typedef std::vector<std::thread> BuilderThreads;
+		typedef BoundedMpmcQueue<CompilerRequest*> BuilderQueue;
+		typedef std::unordered_multimap<GraphicsProgramCacheId, CompilerRequest*> WaitingCompilerRequests;
 		typedef std::vector<std::thread> CompilerThreads;
 		typedef std::deque<CompilerRequest> CompilerRequests;
 		typedef std::unordered_set<GraphicsProgramCacheId> InFlightGraphicsProgramCaches;
@@ -181,11 +217,15 @@ namespace Renderer
 		~GraphicsPipelineStateCompiler();
 		GraphicsPipelineStateCompiler& operator=(const GraphicsPipelineStateCompiler&) = delete;
 		void addAsynchronousCompilerRequest(GraphicsPipelineStateCache& graphicsPipelineStateCache);
+		void addWarmUpCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache);
 		void instantSynchronousCompilerRequest(MaterialBlueprintResource& materialBlueprintResource, GraphicsPipelineStateCache& graphicsPipelineStateCache);
 		void flushQueue(std::mutex& mutex, const CompilerRequests& compilerRequests);
+		void pushToBuilderQueue(CompilerRequest& compilerRequest);
+		[[nodiscard]] bool popFromBuilderQueue(CompilerRequest*& compilerRequest);
+		[[nodiscard]] bool buildCompilerRequest(CompilerRequest& compilerRequest, ShaderBuilder& shaderBuilder);
 		void builderThreadWorker();
 		void compilerThreadWorker();
-		[[nodiscard]] Rhi::IGraphicsPipelineState* createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram) const;
+		[[nodiscard]] Rhi::IGraphicsPipelineState* createGraphicsPipelineState(const MaterialBlueprintResource& materialBlueprintResource, uint32_t serializedGraphicsPipelineStateHash, Rhi::IGraphicsProgram& graphicsProgram, const Rhi::PipelineStateBinary& pipelineStateBinary) const;
 
 
 	//[-------------------------------------------------------]
@@ -196,15 +236,21 @@ namespace Renderer
 		bool						  mAsynchronousCompilationEnabled;
 		uint32_t					  mNumberOfCompilerThreads;
 		std::atomic<uint32_t>		  mNumberOfInFlightCompilerRequests;
-		std::mutex					  mInFlightGraphicsProgramCachesMutex;
+		uint32_t					  mNumberOfWarmUpCompilerRequests;	// Only touched by the main thread
+		std::mutex					  mInFlightGraphicsProgramCachesMutex;	// Also guards the waiting compiler requests, so a compiler request can't be parked after the graphics program cache it waits for is done
 		InFlightGraphicsProgramCaches mInFlightGraphicsProgramCaches;
+		WaitingCompilerRequests		  mWaitingCompilerRequests;				// Compiler requests parked until the in flight graphics program cache they're waiting for is done, then they're pushed back into the builder queue
 
 		// Asynchronous building (moderate cost)
-		std::atomic<bool>		mShutdownBuilderThread;
-		std::mutex				mBuilderMutex;
+		uint32_t				mNumberOfBuilderThreads;
+		std::atomic<bool>		mShutdownBuilderThreads;
+		BuilderQueue			mBuilderQueue;							// Lock-free queue of compiler requests, the builder threads destroy the compiler requests after building
+		std::atomic<uint32_t>	mNumberOfQueuedBuilderCompilerRequests;	// Only a hint used to decide whether or not sleeping builder threads need to be woken up
+		std::atomic<uint32_t>	mNumberOfBuilderCompilerRequests;		// Number of compiler requests which haven't left the builder stage, yet
+		std::atomic<uint32_t>	mNumberOfSleepingBuilderThreads;
+		std::mutex				mBuilderSleepMutex;
 		std::condition_variable	mBuilderConditionVariable;
-		CompilerRequests		mBuilderQueue;
-		std::thread				mBuilderThread;
+		BuilderThreads			mBuilderThreads;
 
 		// Asynchronous compilation (nuts cost)
 		std::atomic<bool>		mShutdownCompilerThread;
@@ -17,7 +17,7 @@ namespace Renderer
 {
 	class IRenderer;
 	class MaterialBlueprintResource;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 	namespace v1MaterialBlueprint
 	{
 		struct Texture;
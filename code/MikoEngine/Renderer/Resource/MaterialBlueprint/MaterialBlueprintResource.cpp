@@ -9,9 +9,6 @@
 #include "Renderer/Asset/AssetManager.h"
 #include "Renderer/IRenderer.h"
 
-#include <chrono>
-#include <thread>
-
 
 // Disable warnings
 // TODO(co) See "Renderer::MaterialBlueprintResource::MaterialBlueprintResource()": How the heck should we avoid such a situation without using complicated solutions like a pointer to an instance? (= more individual allocations/deallocations)
@@ -219,14 +216,7 @@ namespace Renderer
 
 	void MaterialBlueprintResource::enforceFullyLoaded()
 	{
-		// TODO(co) Implement more efficient solution: We need to extend "::ResourceStreamer" to request emergency immediate processing of requested resources
-		ResourceStreamer& resourceStreamer = getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getResourceStreamer();
-		while (LoadingState::LOADED != getLoadingState())
-		{
-			using namespace std::chrono_literals;
-			std::this_thread::sleep_for(1ms);
-			resourceStreamer.dispatch();
-		}
+		getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getResourceStreamer().enforceFullyLoaded(*this);
 	}
 
 	void MaterialBlueprintResource::fillGraphicsCommandBuffer(Rhi::CommandBuffer& commandBuffer)
@@ -509,10 +499,10 @@ namespace Renderer
 		mComputePipelineStateCacheManager.clearCache();
 	}
 
-	void MaterialBlueprintResource::loadPipelineStateObjectCache(IFile& file)
+	void MaterialBlueprintResource::loadPipelineStateObjectCache(IFile& file, bool usePipelineStateBinaries)
 	{
-		mGraphicsPipelineStateCacheManager.loadPipelineStateObjectCache(file);
-		mComputePipelineStateCacheManager.loadPipelineStateObjectCache(file);
+		mGraphicsPipelineStateCacheManager.loadPipelineStateObjectCache(file, usePipelineStateBinaries);
+		mComputePipelineStateCacheManager.loadPipelineStateObjectCache(file, usePipelineStateBinaries);
 	}
 
 	bool MaterialBlueprintResource::doesPipelineStateObjectCacheNeedSaving() const
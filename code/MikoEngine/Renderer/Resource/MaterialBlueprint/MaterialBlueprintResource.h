@@ -21,8 +21,8 @@ namespace Renderer
 	
 	class PassBufferManager;
 	class MaterialBufferManager;
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 	class MaterialBlueprintResourceLoader;
 }
 
@@ -543,7 +543,7 @@ namespace Renderer
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
 		void clearPipelineStateObjectCache();
-		void loadPipelineStateObjectCache(IFile& file);
+		void loadPipelineStateObjectCache(IFile& file, bool usePipelineStateBinaries);
 		[[nodiscard]] bool doesPipelineStateObjectCacheNeedSaving() const;
 		void savePipelineStateObjectCache(IFile& file);
 
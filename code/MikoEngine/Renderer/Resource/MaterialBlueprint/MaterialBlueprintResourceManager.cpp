@@ -62,48 +62,9 @@ namespace Renderer
 	// TODO(co) Work-in-progress
 	void MaterialBlueprintResourceManager::loadMaterialBlueprintResourceByAssetId(AssetId assetId, MaterialBlueprintResourceId& materialBlueprintResourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId, bool createInitialPipelineStateCaches)
 	{
-		// Choose default resource loader type ID, if necessary
-		if (IsInvalid(resourceLoaderTypeId))
-		{
-			resourceLoaderTypeId = MaterialBlueprintResourceLoader::TYPE_ID;
-		}
-
-		// Get or create the instance
-		MaterialBlueprintResource* materialBlueprintResource = mInternalResourceManager->getResourceByAssetId(assetId);
-
-		// Create the resource instance
-		const Asset* asset = mRenderer.getAssetManager().tryGetAssetByAssetId(assetId);
-		SE_ASSERT(nullptr != asset, "Unknown asset ID")
-		bool load = (reload && nullptr != asset);
-		if (nullptr == materialBlueprintResource && nullptr != asset)
-		{
-			materialBlueprintResource = &mInternalResourceManager->getResources().addElement();
-			materialBlueprintResource->setResourceManager(this);
-			materialBlueprintResource->setAssetId(assetId);
-			materialBlueprintResource->setResourceLoaderTypeId(resourceLoaderTypeId);
-			load = true;
-		}
-
-		// Before connecting a resource listener, ensure we set the output resource ID at once so it can already directly be used inside the resource listener
+		MaterialBlueprintResource* materialBlueprintResource = commitMaterialBlueprintResourceLoadRequest(assetId, materialBlueprintResourceId, resourceListener, reload, resourceLoaderTypeId);
 		if (nullptr != materialBlueprintResource)
 		{
-			materialBlueprintResourceId = materialBlueprintResource->getId();
-			if (nullptr != resourceListener)
-			{
-				materialBlueprintResource->connectResourceListener(*resourceListener);
-			}
-		}
-		else
-		{
-			materialBlueprintResourceId = GetInvalid<MaterialBlueprintResourceId>();
-		}
-
-		// Load the resource, if required
-		if (load)
-		{
-			// Commit resource streamer asset load request
-			mRenderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, *this, materialBlueprintResourceId));
-
 			// TODO(co) Currently material blueprint resource loading is a blocking process.
 			//          Later on, we can probably just write "mInternalResourceManager->loadResourceByAssetId(assetId, meshResourceId, resourceListener, reload, resourceLoaderTypeId);" and be done in this method.
 			materialBlueprintResource->enforceFullyLoaded();
@@ -369,6 +330,59 @@ namespace Renderer
 		::detail::defaultMaterialBlueprintResourceListener.clear();
 	}
 
+	MaterialBlueprintResource* MaterialBlueprintResourceManager::commitMaterialBlueprintResourceLoadRequest(AssetId assetId, MaterialBlueprintResourceId& materialBlueprintResourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)
+	{
+		// Choose default resource loader type ID, if necessary
+		if (IsInvalid(resourceLoaderTypeId))
+		{
+			resourceLoaderTypeId = MaterialBlueprintResourceLoader::TYPE_ID;
+		}
+
+		// Get or create the instance
+		MaterialBlueprintResource* materialBlueprintResource = mInternalResourceManager->getResourceByAssetId(assetId);
+
+		// Create the resource instance
+		const Asset* asset = mRenderer.getAssetManager().tryGetAssetByAssetId(assetId);
+		SE_ASSERT(nullptr != asset, "Unknown asset ID")
+		bool load = (reload && nullptr != asset);
+		if (nullptr == materialBlueprintResource && nullptr != asset)
+		{
+			materialBlueprintResource = &mInternalResourceManager->getResources().addElement();
+			materialBlueprintResource->setResourceManager(this);
+			materialBlueprintResource->setAssetId(assetId);
+			materialBlueprintResource->setResourceLoaderTypeId(resourceLoaderTypeId);
+			load = true;
+		}
+
+		// Before connecting a resource listener, ensure we set the output resource ID at once so it can already directly be used inside the resource listener
+		if (nullptr != materialBlueprintResource)
+		{
+			materialBlueprintResourceId = materialBlueprintResource->getId();
+			if (nullptr != resourceListener)
+			{
+				materialBlueprintResource->connectResourceListener(*resourceListener);
+			}
+		}
+		else
+		{
+			materialBlueprintResourceId = GetInvalid<MaterialBlueprintResourceId>();
+		}
+
+		// Load the resource, if required
+		if (load)
+		{
+			// Commit resource streamer asset load request
+			// -> Highest priority class: Material blueprint resource loading is a blocking process, the caller enforces a fully loaded state right away
+			mRenderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, *this, materialBlueprintResourceId, ResourceLoadPriority::VISIBLE_NOW));
+
+			// Done
+			return materialBlueprintResource;
+		}
+
+		// No load request committed
+		return nullptr;
+	}
+
 	void MaterialBlueprintResourceManager::addSerializedGraphicsPipelineState(uint32_t serializedGraphicsPipelineStateHash, const Rhi::SerializedGraphicsPipelineState& serializedGraphicsPipelineState)
 	{
 		std::lock_guard<std::mutex> serializedGraphicsPipelineStatesMutexLock(mSerializedGraphicsPipelineStatesMutex);
@@ -419,6 +433,11 @@ namespace Renderer
 			}
 		}
 
+		// Read the pipeline state binary ID, backend pipeline state binaries are only used if they were created by the currently used GPU and driver
+		uint32_t pipelineStateBinaryId = 0;
+		file.read(&pipelineStateBinaryId, sizeof(uint32_t));
+		const bool usePipelineStateBinaries = (0 != pipelineStateBinaryId && mRenderer.getRhi().getCapabilities().pipelineStateBinaryId == pipelineStateBinaryId);
+
 		{ // Read the pipeline state object cache header which consists of information about the contained material blueprint resources
 			uint32_t numberOfElements = 0;
 			file.read(&numberOfElements, sizeof(uint32_t));
@@ -428,23 +447,33 @@ namespace Renderer
 				materialBlueprintCacheEntries.resize(numberOfElements);
 				file.read(materialBlueprintCacheEntries.data(), sizeof(::detail::MaterialBlueprintCacheEntry) * numberOfElements);
 
+				// Commit the load requests of all material blueprint resources at once so the resource streamer loads them in parallel
+				std::vector<MaterialBlueprintResourceId> materialBlueprintResourceIds;
+				materialBlueprintResourceIds.resize(numberOfElements);
+				for (uint32_t i = 0; i < numberOfElements; ++i)
+				{
+					commitMaterialBlueprintResourceLoadRequest(materialBlueprintCacheEntries[i].materialBlueprintAssetId, materialBlueprintResourceIds[i], nullptr, false, GetInvalid<ResourceLoaderTypeId>());
+				}
+
 				// Loop through all material blueprint resources and read the cache entries
+				// -> Each cached pipeline state is committed to the pipeline state compilers, the warm-up progress is available via "Renderer::IRenderer::getPipelineStateObjectCacheWarmUpProgress()"
 				for (uint32_t i = 0; i < numberOfElements; ++i)
 				{
-					// TODO(co) Currently material blueprint resource loading is a blocking process
 					const ::detail::MaterialBlueprintCacheEntry& materialBlueprintCacheEntry = materialBlueprintCacheEntries[i];
-					MaterialBlueprintResourceId materialBlueprintResourceId = GetInvalid<MaterialBlueprintResourceId>();
-					loadMaterialBlueprintResourceByAssetId(materialBlueprintCacheEntry.materialBlueprintAssetId, materialBlueprintResourceId, nullptr, false, GetInvalid<ResourceLoaderTypeId>(), false);
+					const MaterialBlueprintResourceId materialBlueprintResourceId = materialBlueprintResourceIds[i];
 					if (IsValid(materialBlueprintResourceId))
 					{
-						mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId).loadPipelineStateObjectCache(file);
+						MaterialBlueprintResource& materialBlueprintResource = mInternalResourceManager->getResources().getElementById(materialBlueprintResourceId);
+						materialBlueprintResource.enforceFullyLoaded();
+						materialBlueprintResource.loadPipelineStateObjectCache(file, usePipelineStateBinaries);
 					}
 					else
 					{
 						RHI_LOG(COMPATIBILITY_WARNING, "The pipeline state object cache contains an unknown material blueprint asset. Might have happened due to renaming or removal which can be considered normal during development, but not in shipped builds.")
-
-						// TODO(co) Enable file skip after "Renderer::MaterialBlueprintResource::savePipelineStateObjectCache()" has been implemented
-						// file.skip(materialBlueprintCacheEntry.numberOfBytes);
+						if (materialBlueprintCacheEntry.numberOfBytes > 0)
+						{
+							file.skip(materialBlueprintCacheEntry.numberOfBytes);
+						}
 					}
 				}
 			}
@@ -483,6 +512,11 @@ namespace Renderer
 			}
 		}
 
+		{ // Write the pipeline state binary ID of the currently used GPU and driver
+			const uint32_t pipelineStateBinaryId = mRenderer.getRhi().getCapabilities().pipelineStateBinaryId;
+			memoryFile.write(&pipelineStateBinaryId, sizeof(uint32_t));
+		}
+
 		{ // Write the pipeline state object cache header which consists of information about the contained material blueprint resources
 			const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
 			memoryFile.write(&numberOfElements, sizeof(uint32_t));
@@ -498,13 +532,14 @@ namespace Renderer
 					firstMaterialBlueprintCacheEntryIndex = static_cast<uint32_t>(memoryFile.getNumberOfBytes() - sizeof(::detail::MaterialBlueprintCacheEntry));
 				}
 			}
-			::detail::MaterialBlueprintCacheEntry* firstMaterialBlueprintCacheEntry = reinterpret_cast< ::detail::MaterialBlueprintCacheEntry*>(&memoryFile.getByteVector()[firstMaterialBlueprintCacheEntryIndex]);
 
 			// Loop through all material blueprint resources and write the cache entries
+			// -> Writing might reallocate the byte vector, so the cache entry address must be fetched after writing
 			for (uint32_t i = 0; i < numberOfElements; ++i)
 			{
 				const uint32_t fileStart = static_cast<uint32_t>(memoryFile.getNumberOfBytes());
 				mInternalResourceManager->getResources().getElementByIndex(i).savePipelineStateObjectCache(memoryFile);
+				::detail::MaterialBlueprintCacheEntry* firstMaterialBlueprintCacheEntry = reinterpret_cast< ::detail::MaterialBlueprintCacheEntry*>(&memoryFile.getByteVector()[firstMaterialBlueprintCacheEntryIndex]);
 				firstMaterialBlueprintCacheEntry[i].numberOfBytes = static_cast<uint32_t>(memoryFile.getNumberOfBytes() - fileStart);
 			}
 		}
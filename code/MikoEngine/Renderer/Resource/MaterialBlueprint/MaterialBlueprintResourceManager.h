@@ -39,7 +39,7 @@ namespace Renderer
 	class TextureInstanceBufferManager;
 	class MaterialBlueprintResourceLoader;
 	class IMaterialBlueprintResourceListener;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 }
 
 
@@ -214,6 +214,7 @@ namespace Renderer
 		virtual ~MaterialBlueprintResourceManager() override;
 		explicit MaterialBlueprintResourceManager(const MaterialBlueprintResourceManager&) = delete;
 		MaterialBlueprintResourceManager& operator=(const MaterialBlueprintResourceManager&) = delete;
+		MaterialBlueprintResource* commitMaterialBlueprintResourceLoadRequest(AssetId assetId, MaterialBlueprintResourceId& materialBlueprintResourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId);	// Returns the material blueprint resource if a load request has been committed, else null pointer
 
 		//[-------------------------------------------------------]
 		//[ Pipeline state object cache                           ]
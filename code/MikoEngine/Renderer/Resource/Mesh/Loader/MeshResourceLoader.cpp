@@ -155,6 +155,7 @@ namespace Renderer
 			createVertexArrays();
 		}
 		mMeshResource->setVertexArray(mVertexArray, mPositionOnlyVertexArray);
+		mMeshResource->setNumberOfResidentBytes(mNumberOfUsedVertexBufferDataBytes + mNumberOfUsedIndexBufferDataBytes + mNumberOfUsedPositionOnlyIndexBufferDataBytes);
 
 		{ // Create sub-meshes
 			MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
@@ -14,8 +14,8 @@
 //[-------------------------------------------------------]
 namespace Renderer
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 	class IMeshResourceLoader;
 }
 
@@ -41,6 +41,11 @@ namespace Renderer
 	/**
 	*  @brief
 	*    Mesh resource class
+	*
+	*  @remarks
+	*    If the mesh memory budget is exceeded, the mesh resource manager evicts the vertex array objects of mesh resources which weren't
+	*    needed for a while (see "Renderer::MeshResourceManager"). An evicted mesh resource is unloaded, bounding and sub-mesh information
+	*    stay valid so the scene culling keeps working. As soon as the mesh resource is needed again it's reloaded.
 	*/
 	class MeshResource final : public IResource
 	{
@@ -51,6 +56,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 		friend PackedElementManager<MeshResource, MeshResourceId, 4096>;							// Type definition of template class
 		friend ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>;	// Type definition of template class
+		friend class MeshResourceManager;
 
 
 	//[-------------------------------------------------------]
@@ -139,6 +145,29 @@ namespace Renderer
 			mPositionOnlyVertexArray = positionOnlyVertexArray;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfResidentBytes() const
+		{
+			return mNumberOfResidentBytes;
+		}
+
+		inline void setNumberOfResidentBytes(uint32_t numberOfResidentBytes)
+		{
+			mNumberOfResidentBytes = numberOfResidentBytes;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Residency                                             ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isEvicted() const
+		{
+			return mEvicted;
+		}
+
+		inline void setReferenced()	// Tell the mesh resource manager the mesh is needed, called by the scene culling for visible mesh scene items, do only call on the main thread
+		{
+			mReferenced = true;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Sub-meshes and LODs                                   ]
 		//[-------------------------------------------------------]
@@ -189,10 +218,15 @@ namespace Renderer
 			// Vertex and index data
 			mNumberOfVertices(0),
 			mNumberOfIndices(0),
+			mNumberOfResidentBytes(0),
 			// Sub-meshes and LODs
 			mNumberOfLods(0),
 			// Optional skeleton
-			mSkeletonResourceId(GetInvalid<SkeletonResourceId>())
+			mSkeletonResourceId(GetInvalid<SkeletonResourceId>()),
+			// Residency
+			mLastReferencedUpdateNumber(0),
+			mReferenced(false),
+			mEvicted(false)
 		{
 			// Nothing here
 		}
@@ -251,11 +285,15 @@ namespace Renderer
 			SetInvalid(mBoundingSphereRadius);
 			mNumberOfVertices = 0;
 			mNumberOfIndices = 0;
+			mNumberOfResidentBytes = 0;
 			mVertexArray = nullptr;
 			mPositionOnlyVertexArray = nullptr;
 			mSubMeshes.clear();
 			mNumberOfIndices = 0;
 			SetInvalid(mSkeletonResourceId);
+			mLastReferencedUpdateNumber = 0;
+			mReferenced = false;
+			mEvicted = false;
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -274,6 +312,7 @@ namespace Renderer
 		// Vertex and index data
 		uint32_t			 mNumberOfVertices;			// Number of vertices
 		uint32_t			 mNumberOfIndices;			// Number of indices
+		uint32_t			 mNumberOfResidentBytes;	// Number of vertex and index buffer bytes of the vertex array objects, 0 if there are no vertex array objects
 		Rhi::IVertexArrayPtr mVertexArray;				// Vertex array object (VAO), can be a null pointer, directly containing also the index data of all LODs
 		Rhi::IVertexArrayPtr mPositionOnlyVertexArray;	// Optional position-only vertex array object (VAO) which can reduce the number of processed vertices up to half, can be a null pointer, can be used for position-only rendering (e.g. shadow map rendering) using the same vertex data that the original vertex array object (VAO) uses, directly containing also the index data of all LODs
 		// Sub-meshes and LODs
@@ -281,6 +320,10 @@ namespace Renderer
 		uint8_t				 mNumberOfLods;			// Number of LODs, there's always at least one LOD, namely the original none reduced version
 		// Optional skeleton
 		SkeletonResourceId	 mSkeletonResourceId;	// Resource ID of the used skeleton, can be invalid
+		// Residency, do only touch on the main thread
+		uint32_t mLastReferencedUpdateNumber;	// Mesh resource manager update number the mesh was needed the last time, 0 if it was never needed
+		bool	 mReferenced;					// Set if the mesh was needed since the last mesh resource manager update
+		bool	 mEvicted;						// If true, the vertex array objects were released by the mesh resource manager and the mesh resource gets reloaded as soon as it's needed again
 
 
 	};
@@ -62,7 +62,7 @@ namespace Renderer
 		return mInternalResourceManager->getResourceByAssetId(assetId);
 	}
 
-	void MeshResourceManager::loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)
+	void MeshResourceManager::loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId, ResourceLoadPriority priority)
 	{
 		// Choose default resource loader type ID, if necessary
 		if (IsInvalid(resourceLoaderTypeId))
@@ -70,8 +70,16 @@ namespace Renderer
 			resourceLoaderTypeId = MeshResourceLoader::TYPE_ID;
 		}
 
+		// Evicted mesh resources are reloaded as soon as someone asks for them, the new resource listener would else have to wait until the mesh gets visible
+		MeshResource* meshResource = getMeshResourceByAssetId(assetId);
+		if (nullptr != meshResource && meshResource->mEvicted)
+		{
+			meshResource->mEvicted = false;
+			reload = true;
+		}
+
 		// Load
-		mInternalResourceManager->loadResourceByAssetId(assetId, meshResourceId, resourceListener, reload, resourceLoaderTypeId);
+		mInternalResourceManager->loadResourceByAssetId(assetId, meshResourceId, resourceListener, reload, resourceLoaderTypeId, priority);
 	}
 
 	MeshResourceId MeshResourceManager::createEmptyMeshResourceByAssetId(AssetId assetId)
@@ -122,7 +130,51 @@ namespace Renderer
 
 	void MeshResourceManager::update()
 	{
-		// Nothing here
+		++mUpdateNumber;
+
+		// Gather the mesh resources which are candidates for eviction, evicted mesh resources needed again are reloaded
+		// -> The mesh resources were marked as needed by the scene culling, see "Renderer::MeshResource::setReferenced()"
+		mScratchMeshResources.clear();
+		mNumberOfResidentBytes = 0;
+		const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (uint32_t i = 0; i < numberOfElements; ++i)
+		{
+			MeshResource& meshResource = mInternalResourceManager->getResources().getElementByIndex(i);
+			if (meshResource.mReferenced)
+			{
+				meshResource.mReferenced = false;
+				meshResource.mLastReferencedUpdateNumber = mUpdateNumber;
+				if (meshResource.mEvicted)
+				{
+					MeshResourceId meshResourceId = GetInvalid<MeshResourceId>();
+					loadMeshResourceByAssetId(meshResource.getAssetId(), meshResourceId, nullptr, true, meshResource.getResourceLoaderTypeId(), ResourceLoadPriority::VISIBLE_NOW);	// Needed by the scene culling, there are no renderables in the meantime
+				}
+			}
+			mNumberOfResidentBytes += meshResource.mNumberOfResidentBytes;
+			if (IResource::LoadingState::LOADED == meshResource.getLoadingState() && 0 != meshResource.mNumberOfResidentBytes && 0 != meshResource.mLastReferencedUpdateNumber && mUpdateNumber - meshResource.mLastReferencedUpdateNumber >= MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION)
+			{
+				mScratchMeshResources.push_back(&meshResource);
+			}
+		}
+
+		// Over budget: Evict the least recently needed and biggest mesh resources first
+		if (0 != mMeshMemoryBudget && mNumberOfResidentBytes > mMeshMemoryBudget)
+		{
+			std::sort(mScratchMeshResources.begin(), mScratchMeshResources.end(), [](const MeshResource* left, const MeshResource* right)
+			{
+				return (left->mLastReferencedUpdateNumber != right->mLastReferencedUpdateNumber) ? (left->mLastReferencedUpdateNumber < right->mLastReferencedUpdateNumber) : (left->mNumberOfResidentBytes > right->mNumberOfResidentBytes);
+			});
+			uint64_t numberOfResidentBytes = mNumberOfResidentBytes;
+			for (MeshResource* meshResource : mScratchMeshResources)
+			{
+				if (numberOfResidentBytes <= mMeshMemoryBudget)
+				{
+					break;
+				}
+				numberOfResidentBytes -= meshResource->mNumberOfResidentBytes;
+				evictMeshResource(*meshResource);
+			}
+		}
 	}
 
 
@@ -148,7 +200,10 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	MeshResourceManager::MeshResourceManager(IRenderer& renderer) :
-		mNumberOfTopMeshLodsToRemove(0)
+		mNumberOfTopMeshLodsToRemove(0),
+		mMeshMemoryBudget(0),
+		mNumberOfResidentBytes(0),
+		mUpdateNumber(0)
 	{
 		mInternalResourceManager = new ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>(renderer, *this);
 
@@ -176,6 +231,16 @@ namespace Renderer
 		delete mInternalResourceManager;
 	}
 
+	void MeshResourceManager::evictMeshResource(MeshResource& meshResource)
+	{
+		// Release the vertex array objects, bounding and sub-mesh information stay valid
+		// -> The resource listeners (e.g. mesh scene items) get informed about the unloading and must release their vertex array object references, else no memory is freed
+		meshResource.mEvicted = true;
+		meshResource.mNumberOfResidentBytes = 0;
+		meshResource.setVertexArray(nullptr);
+		setResourceLoadingState(meshResource, IResource::LoadingState::UNLOADED);
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
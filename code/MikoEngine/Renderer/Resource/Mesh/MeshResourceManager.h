@@ -16,7 +16,7 @@ namespace Renderer
 	class MeshResource;
 	class IRenderer;
 	class IMeshResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 }
 
 
@@ -36,6 +36,16 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Mesh resource manager class
+	*
+	*  @remarks
+	*    The scene culling tells the mesh resource manager which mesh resources are needed via "Renderer::MeshResource::setReferenced()".
+	*    If the resident vertex and index data exceeds the mesh memory budget, mesh resources which haven't been needed for
+	*    "MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION" updates are evicted in least recently needed order. Evicted mesh resources
+	*    are reloaded as soon as they're needed again. Mesh resources which were never needed by the scene culling are never evicted.
+	*/
 	class MeshResourceManager final : public ResourceManager<MeshResource>
 	{
 
@@ -51,6 +61,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	public:
 		static const Rhi::VertexAttributes DRAW_ID_VERTEX_ATTRIBUTES;
+		static constexpr uint32_t MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION = 300;	// Number of updates a mesh resource must not have been needed before it can be evicted, avoids evicting mesh resources which are only briefly out of view
 
 
 	//[-------------------------------------------------------]
@@ -67,8 +78,23 @@ namespace Renderer
 			mNumberOfTopMeshLodsToRemove = numberOfTopMeshLodsToRemove;
 		}
 
+		[[nodiscard]] inline uint64_t getMeshMemoryBudget() const
+		{
+			return mMeshMemoryBudget;
+		}
+
+		inline void setMeshMemoryBudget(uint64_t meshMemoryBudget)	// Number of bytes the resident vertex and index data of all mesh resources is allowed to use, 0 for no budget
+		{
+			mMeshMemoryBudget = meshMemoryBudget;
+		}
+
+		[[nodiscard]] inline uint64_t getNumberOfResidentBytes() const	// Number of resident vertex and index data bytes of all mesh resources as of the last update
+		{
+			return mNumberOfResidentBytes;
+		}
+
 		[[nodiscard]] MeshResource* getMeshResourceByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
-		void loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>());	// Asynchronous
+		void loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>(), ResourceLoadPriority priority = ResourceLoadPriority::PREFETCH);	// Asynchronous
 		[[nodiscard]] MeshResourceId createEmptyMeshResourceByAssetId(AssetId assetId);	// Mesh resource is not allowed to exist, yet, prefer asynchronous mesh resource loading over this method
 		void setInvalidResourceId(MeshResourceId& textureResourceId, IResourceListener& resourceListener) const;
 
@@ -102,6 +128,13 @@ namespace Renderer
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<MeshResource*> MeshResources;
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -110,6 +143,7 @@ namespace Renderer
 		virtual ~MeshResourceManager() override;
 		explicit MeshResourceManager(const MeshResourceManager&) = delete;
 		MeshResourceManager& operator=(const MeshResourceManager&) = delete;
+		void evictMeshResource(MeshResource& meshResource);
 
 
 	//[-------------------------------------------------------]
@@ -117,6 +151,11 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		uint8_t				  mNumberOfTopMeshLodsToRemove;	// The number of top mesh LODs to remove, only has an impact while rendering and not on loading (amount of needed memory is not influenced)
+		// Residency
+		uint64_t	  mMeshMemoryBudget;		// Number of bytes the resident vertex and index data of all mesh resources is allowed to use, 0 for no budget
+		uint64_t	  mNumberOfResidentBytes;	// Number of resident vertex and index data bytes of all mesh resources as of the last update
+		uint32_t	  mUpdateNumber;			// Incremented by each update, used to find the least recently needed mesh resources
+		MeshResources mScratchMeshResources;	// Scratch buffer to reduce dynamic memory allocations
 		ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>* mInternalResourceManager;
 		Rhi::IVertexBufferPtr mDrawIdVertexBufferPtr;		// Draw ID vertex buffer, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
 		Rhi::IVertexArrayPtr  mDrawIdVertexArrayPtr;		// Draw ID vertex array, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
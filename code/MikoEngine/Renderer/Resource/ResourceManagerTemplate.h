@@ -42,7 +42,7 @@ namespace Renderer
 	*  @brief
 	*    Internal resource manager template; not public used to keep template instantiation overhead under control
 	*/
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS>
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK>
 	class ResourceManagerTemplate
 	{
 
@@ -51,7 +51,7 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
-		typedef PackedElementManager<TYPE, ID_TYPE, MAXIMUM_NUMBER_OF_ELEMENTS> Resources;
+		typedef PackedElementManager<TYPE, ID_TYPE, NUMBER_OF_ELEMENTS_PER_CHUNK> Resources;
 
 
 	//[-------------------------------------------------------]
@@ -118,7 +118,7 @@ namespace Renderer
 			return resource;
 		}
 
-		inline void loadResourceByAssetId(AssetId assetId, ID_TYPE& resourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)	// Asynchronous
+		inline void loadResourceByAssetId(AssetId assetId, ID_TYPE& resourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId, ResourceLoadPriority priority = ResourceLoadPriority::PREFETCH)	// Asynchronous
 		{
 			// Choose default resource loader type ID, if necessary
 			if (IsInvalid(resourceLoaderTypeId))
@@ -160,7 +160,7 @@ namespace Renderer
 			if (load)
 			{
 				// Commit resource streamer asset load request
-				mRenderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, mResourceManager, resourceId));
+				mRenderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, mResourceManager, resourceId, priority));
 			}
 		}
 
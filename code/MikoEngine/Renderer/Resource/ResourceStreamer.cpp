@@ -3,11 +3,39 @@
 #include "Renderer/Resource/IResourceLoader.h"
 #include "Renderer/Resource/IResourceManager.h"
 #include "Renderer/Core/Platform/PlatformManager.h"
+#include "Renderer/Core/Thread/JobSystem.h"
+#include "Renderer/Core/Time/Stopwatch.h"
+#include "Renderer/Asset/AssetManager.h"
 #include "Core/File/IFileManager.h"
 #include "Renderer/IRenderer.h"
 
-// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
-SE_PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_IDLE_ITERATIONS = 1024;	// Number of yielding idle iterations before a stage worker thread goes to sleep
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local uint32_t g_NumberOfEnforcedLoads = 0;	// Number of active "Renderer::ResourceStreamer::enforceFullyLoaded()" calls of the current thread, load requests committed meanwhile are dependencies and hence get the highest priority class
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -36,127 +64,230 @@ namespace Renderer
 		loadRequest.getResource().setLoadingState(IResource::LoadingState::LOADING);
 
 		// Push the load request into the queue of the first resource streamer pipeline stage
+		// -> Load requests committed while the current thread is blocked inside "Renderer::ResourceStreamer::enforceFullyLoaded()" are usually dependencies of the resource waited for
 		// -> Resource streamer stage: 1. Asynchronous deserialization
-		std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-		mDeserializationQueue.push_back(loadRequest);
-		deserializationMutexLock.unlock();
-		mDeserializationConditionVariable.notify_one();
+		LoadRequest stageLoadRequest = loadRequest;
+		if (::detail::g_NumberOfEnforcedLoads > 0)
+		{
+			stageLoadRequest.priority = Priority::VISIBLE_NOW;
+		}
+		pushToStage(mDeserializationStage, stageLoadRequest);
 	}
 
-	void ResourceStreamer::flushAllQueues()
+	void ResourceStreamer::enforceFullyLoaded(const IResource& resource)
 	{
-		bool everythingFlushed = false;
-		do
+		// Nothing to do if the resource is already finished
+		if (IResource::LoadingState::LOADED == resource.getLoadingState() || IResource::LoadingState::FAILED == resource.getLoadingState())
 		{
-			{ // Process
-				{ // Resource streamer stage: 1. Asynchronous deserialization
-					std::lock_guard<std::mutex> deserializationMutexLock(mDeserializationMutex);
-					everythingFlushed = (mDeserializationQueue.empty() && 0 == mDeserializationWaitingQueueRequests);
-				}
+			return;
+		}
 
-				// Resource streamer stage: 2. Asynchronous processing
-				if (everythingFlushed)
-				{
-					std::lock_guard<std::mutex> processingMutexLock(mProcessingMutex);
-					everythingFlushed = mProcessingQueue.empty();
-				}
+		// Promote the load request of the resource to the highest priority class, pushing it into a stage from now on uses the urgent queue
+		const PromotedResource promotedResource(&resource.getResourceManager(), resource.getId());
+		{
+			std::lock_guard<std::mutex> promotionMutexLock(mPromotionMutex);
+			mPromotedResources.push_back(promotedResource);
+			++mNumberOfPromotedResources;
+		}
 
-				// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-				if (everythingFlushed)
+		{ // The load request might already wait for the synchronous dispatch: Move it to the front of the highest priority dispatch queue
+			std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+			for (uint8_t priority = 1; priority < NUMBER_OF_PRIORITIES; ++priority)
+			{
+				LoadRequests& dispatchQueue = mDispatchQueues[priority];
+				LoadRequests::iterator iterator = std::find_if(dispatchQueue.begin(), dispatchQueue.end(), [&promotedResource](const LoadRequest& loadRequest) { return (loadRequest.resourceManager == promotedResource.first && loadRequest.resourceId == promotedResource.second); });
+				if (dispatchQueue.end() != iterator)
 				{
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					everythingFlushed = (mDispatchQueue.empty() && mFullyLoadedWaitingQueue.empty());
+					LoadRequest loadRequest = *iterator;
+					dispatchQueue.erase(iterator);
+					loadRequest.priority = Priority::VISIBLE_NOW;
+					mDispatchQueues[static_cast<uint8_t>(Priority::VISIBLE_NOW)].push_front(loadRequest);
+					break;
 				}
 			}
-			dispatch();
+		}
 
-			// Wait for a moment to not totally pollute the CPU
-			if (!everythingFlushed)
+		{ // The load request might wait for a free resource loader instance: Move it to the front of the waiting load requests
+			std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
+			ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resource.getResourceLoaderTypeId());
+			if (mResourceLoaderTypeManager.end() != iterator)
 			{
-				using namespace std::chrono_literals;
-				std::this_thread::sleep_for(1ms);
+				LoadRequests& waitingLoadRequests = iterator->second.waitingLoadRequests;
+				LoadRequests::iterator waitingIterator = std::find_if(waitingLoadRequests.begin(), waitingLoadRequests.end(), [&promotedResource](const LoadRequest& loadRequest) { return (loadRequest.resourceManager == promotedResource.first && loadRequest.resourceId == promotedResource.second); });
+				if (waitingLoadRequests.end() != waitingIterator)
+				{
+					LoadRequest loadRequest = *waitingIterator;
+					waitingLoadRequests.erase(waitingIterator);
+					loadRequest.priority = Priority::VISIBLE_NOW;
+					waitingLoadRequests.push_front(loadRequest);
+				}
 			}
-		} while (!everythingFlushed);
-
-		// Sanity check
-		SE_ASSERT(0 == mNumberOfInFlightLoadRequests, "Invalid number of in flight load requests")
-	}
-
-	void ResourceStreamer::dispatch()
-	{
-		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+		}
 
-		// Continue as long as there's a load request left inside the queue
-		bool stillInTimeBudget = true;	// TODO(co) Add a maximum time budget so we're not blocking too long (the show must go on)
-		while (stillInTimeBudget)
+		// Instead of spinning until the stage worker threads are done, the calling thread lends a hand and works on the resource streamer stages itself
+		// -> The most advanced stage comes first, that's where the load request of the resource most likely is by now
+		// -> If there's nothing urgent to do, the remaining load requests are dispatched as well since the resource might wait for one of them
+		++::detail::g_NumberOfEnforcedLoads;
+		while (IResource::LoadingState::LOADED != resource.getLoadingState() && IResource::LoadingState::FAILED != resource.getLoadingState())
 		{
-			// Get the load request
-			std::unique_lock<std::mutex> dispatchMutexLock(mDispatchMutex);
-			if (mDispatchQueue.empty())
+			LoadRequest loadRequest;
+			if (dispatchLoadRequests(0, Priority::VISIBLE_NOW))
 			{
-				break;
+				// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation, the work was already done by the dispatch call
 			}
-			LoadRequest loadRequest = mDispatchQueue.front();
-			mDispatchQueue.pop_front();
-			dispatchMutexLock.unlock();
-
-			// Do the work
-			if (loadRequest.loadingFailed || loadRequest.resourceLoader->onDispatch())
+			else if (tryPopFromStage(mProcessingStage, loadRequest))
 			{
-				// Load request is finished now
-				finalizeLoadRequest(loadRequest);
+				// Resource streamer stage: 2. Asynchronous processing
+				processLoadRequest(loadRequest);
 			}
-			else
+			else if (tryPopFromStage(mDeserializationStage, loadRequest))
 			{
-				mFullyLoadedWaitingQueue.push_back(loadRequest);
+				// Resource streamer stage: 1. Asynchronous deserialization
+				deserializeLoadRequest(loadRequest);
+			}
+			else if (!dispatchLoadRequests(0))
+			{
+				// The stage worker threads are busy with the load request, wait for them
+				std::this_thread::yield();
 			}
 		}
+		--::detail::g_NumberOfEnforcedLoads;
+
+		{ // Revoke the promotion
+			std::lock_guard<std::mutex> promotionMutexLock(mPromotionMutex);
+			PromotedResources::iterator iterator = std::find(mPromotedResources.begin(), mPromotedResources.end(), promotedResource);
+			SE_ASSERT(mPromotedResources.end() != iterator, "Invalid promoted resource")
+			*iterator = mPromotedResources.back();
+			mPromotedResources.pop_back();
+			--mNumberOfPromotedResources;
+		}
+	}
 
-		// Check fully loaded waiting queue
-		for (LoadRequests::iterator iterator = mFullyLoadedWaitingQueue.begin(); iterator != mFullyLoadedWaitingQueue.end();)
+	void ResourceStreamer::flushAllQueues()
+	{
+		// Load requests which are currently worked on by a stage worker thread aren't inside any queue, so wait for the in-flight load requests instead of checking the queues
+		while (mNumberOfInFlightLoadRequests > 0)
 		{
-			const LoadRequest& loadRequest = *iterator;
-			if (loadRequest.resourceLoader->isFullyLoaded())
-			{
-				// Load request is finished now
-				finalizeLoadRequest(loadRequest);
+			dispatchLoadRequests(0);
 
-				// Remove from queue
-				iterator = mFullyLoadedWaitingQueue.erase(iterator);
+			// Wait for a moment to not totally pollute the CPU
+			if (mNumberOfInFlightLoadRequests > 0)
+			{
+				using namespace std::chrono_literals;
+				std::this_thread::sleep_for(1ms);
 			}
-			else
+		}
+	}
+
+	void ResourceStreamer::dispatch()
+	{
+		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+		const uint32_t dispatchFrameNumber = ++mDispatchFrameNumber;
+
+		{ // Priority aging: Promote load requests which waited too long to the next higher priority class so nothing starves
+			// -> Each dispatch queue is ordered by the dispatch frame number, so only the front load requests need to be checked
+			std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+			for (uint8_t priority = 1; priority < NUMBER_OF_PRIORITIES; ++priority)
 			{
-				// Next, please
-				++iterator;
+				LoadRequests& dispatchQueue = mDispatchQueues[priority];
+				while (!dispatchQueue.empty() && dispatchFrameNumber - dispatchQueue.front().dispatchFrameNumber >= NUMBER_OF_FRAMES_UNTIL_PRIORITY_AGING)
+				{
+					LoadRequest& loadRequest = dispatchQueue.front();
+					loadRequest.priority = static_cast<Priority>(priority - 1);
+					loadRequest.dispatchFrameNumber = dispatchFrameNumber;
+					mDispatchQueues[priority - 1].push_back(loadRequest);
+					dispatchQueue.pop_front();
+				}
 			}
 		}
+
+		// Dispatch as many load requests as the time budget allows
+		dispatchLoadRequests(mDispatchTimeBudget);
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void ResourceStreamer::onFileReadCompleted(AsyncFileReader::ReadRequest& readRequest)
+	{
+		// Called by an asynchronous file reader thread: Let the load request continue inside the deserialization stage, a failed read is done the usual way
+		// -> Resource streamer stage: 1. Asynchronous deserialization
+		FileReadRequest& fileReadRequest = static_cast<FileReadRequest&>(readRequest);
+		LoadRequest loadRequest = fileReadRequest.loadRequest;
+		loadRequest.readRequest = &readRequest;
+		fileReadRequest.resourceStreamer.pushToStage(fileReadRequest.resourceStreamer.mDeserializationStage, loadRequest);
 	}
 
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	ResourceStreamer::ResourceStreamer(IRenderer& renderer) :
+	ResourceStreamer::ResourceStreamer(IRenderer& renderer, uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads) :
 		mRenderer(renderer),
 		mNumberOfInFlightLoadRequests(0),
-		mShutdownDeserializationThread(false),
-		mDeserializationWaitingQueueRequests(0),
-		mDeserializationThread(&ResourceStreamer::deserializationThreadWorker, this),
-		mShutdownProcessingThread(false),
-		mProcessingThread(&ResourceStreamer::processingThreadWorker, this)
+		mShutdownThreads(false),
+		mAsyncFileReader(new AsyncFileReader()),
+		mMaximumNumberOfResourceLoaderInstances(0),
+		mDispatchFrameNumber(0),
+		mDispatchTimeBudget(DEFAULT_DISPATCH_TIME_BUDGET),
+		mNumberOfPromotedResources(0)
 	{
-		// Nothing here
+		// Choose the default number of stage worker threads, if necessary
+		// -> The job system already occupies hardware threads, the CPU bound processing stage only gets what's left so we don't oversubscribe the cores
+		if (IsInvalid(numberOfDeserializationThreads))
+		{
+			numberOfDeserializationThreads = 1;
+		}
+		if (IsInvalid(numberOfProcessingThreads))
+		{
+			const uint32_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+			const uint32_t numberOfJobSystemThreads = renderer.getJobSystem().getNumberOfThreads();
+			numberOfProcessingThreads = (numberOfHardwareThreads > numberOfJobSystemThreads) ? (numberOfHardwareThreads - numberOfJobSystemThreads) : 1;
+		}
+		SE_ASSERT(numberOfDeserializationThreads > 0 && numberOfProcessingThreads > 0, "Each asynchronous resource streamer stage needs at least one worker thread")
+
+		// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
+		// -> Every stage worker thread must be able to work on a resource loader instance of the same type, plus a few instances waiting for the synchronous dispatch
+		mMaximumNumberOfResourceLoaderInstances = std::max(numberOfDeserializationThreads + numberOfProcessingThreads + 3, 5u);
+
+		// Start the stage worker threads
+		mDeserializationStage.threads.reserve(numberOfDeserializationThreads);
+		for (uint32_t i = 0; i < numberOfDeserializationThreads; ++i)
+		{
+			mDeserializationStage.threads.emplace_back(&ResourceStreamer::deserializationThreadWorker, this);
+		}
+		mProcessingStage.threads.reserve(numberOfProcessingThreads);
+		for (uint32_t i = 0; i < numberOfProcessingThreads; ++i)
+		{
+			mProcessingStage.threads.emplace_back(&ResourceStreamer::processingThreadWorker, this);
+		}
 	}
 
 	ResourceStreamer::~ResourceStreamer()
 	{
-		// Deserialization thread and processing thread shutdown
-		mShutdownDeserializationThread = true;
-		mShutdownProcessingThread = true;
-		mDeserializationConditionVariable.notify_one();
-		mProcessingConditionVariable.notify_one();
-		mDeserializationThread.join();
-		mProcessingThread.join();
+		// Stage worker threads shutdown (the sleep mutex lock ensures the wake up isn't lost while a worker thread is about to go to sleep)
+		mShutdownThreads = true;
+		for (Stage* stage : { &mDeserializationStage, &mProcessingStage })
+		{
+			{
+				std::unique_lock<std::mutex> sleepMutexLock(stage->sleepMutex);
+				stage->sleepConditionVariable.notify_all();
+			}
+			for (std::thread& thread : stage->threads)
+			{
+				thread.join();
+			}
+		}
+
+		// Complete the asynchronous file reads (no stage worker thread is left to submit new ones), the load requests are pushed back into the deserialization stage
+		// -> Destroy the asynchronously read asset files which didn't make it through the deserialization stage
+		delete mAsyncFileReader;
+		LoadRequest loadRequest;
+		while (tryPopFromStage(mDeserializationStage, loadRequest))
+		{
+			delete loadRequest.readRequest;
+		}
 
 		// Destroy resource loader instances
 		for (auto& resourceLoaderType : mResourceLoaderTypeManager)
@@ -173,153 +304,331 @@ namespace Renderer
 		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 1", "Renderer: Resource streamer stage: 1. Asynchronous deserialization")
 
 		// Resource streamer stage: 1. Asynchronous deserialization
-		while (!mShutdownDeserializationThread)
+		LoadRequest loadRequest;
+		while (popFromStage(mDeserializationStage, loadRequest))
+		{
+			deserializeLoadRequest(loadRequest);
+		}
+	}
+
+	void ResourceStreamer::processingThreadWorker()
+	{
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 2", "Renderer: Resource streamer stage: 2. Asynchronous processing")
+
+		// Resource streamer stage: 2. Asynchronous processing
+		LoadRequest loadRequest;
+		while (popFromStage(mProcessingStage, loadRequest))
 		{
-			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-			mDeserializationConditionVariable.wait(deserializationMutexLock);
-			while (!mDeserializationQueue.empty() && !mShutdownDeserializationThread)
+			processLoadRequest(loadRequest);
+		}
+	}
+
+	void ResourceStreamer::pushToStage(Stage& stage, LoadRequest& loadRequest)
+	{
+		// Load requests of the highest priority class go into the urgent queue which is always popped first, in the unlikely case it's full the regular queue has to do
+		// -> The stage queue is bounded, if it's full the producer has to wait until a stage worker thread made some room
+		promoteLoadRequest(loadRequest);
+		if (Priority::VISIBLE_NOW != loadRequest.priority || !stage.urgentQueue.tryPush(loadRequest))
+		{
+			while (!stage.queue.tryPush(loadRequest))
 			{
-				// Get the load request
-				LoadRequest loadRequest = mDeserializationQueue.front();
-				mDeserializationQueue.pop_front();
-
-				{ // Get resource loader instance
-					std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
-					const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
-					ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
-					if (mResourceLoaderTypeManager.cend() == iterator)
-					{
-						// The resource loader type ID is unknown, yet
-						ResourceLoaderType resourceLoaderType;
-						resourceLoaderType.numberOfInstances = 1;
-						mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
-						loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-					}
-					else
+				std::this_thread::yield();
+			}
+		}
+
+		// Wake up a sleeping stage worker thread, if there's one (the sleep mutex lock ensures the wake up isn't lost while the worker thread is about to go to sleep)
+		++stage.numberOfQueuedLoadRequests;
+		if (stage.numberOfSleepingThreads > 0)
+		{
+			std::unique_lock<std::mutex> sleepMutexLock(stage.sleepMutex);
+			stage.sleepConditionVariable.notify_one();
+		}
+	}
+
+	bool ResourceStreamer::tryPopFromStage(Stage& stage, LoadRequest& loadRequest)
+	{
+		if (stage.urgentQueue.tryPop(loadRequest) || stage.queue.tryPop(loadRequest))
+		{
+			--stage.numberOfQueuedLoadRequests;
+			return true;
+		}
+		return false;
+	}
+
+	bool ResourceStreamer::popFromStage(Stage& stage, LoadRequest& loadRequest)
+	{
+		// Blocks until there's a load request or the resource streamer gets shut down, in which case "false" is returned
+		uint32_t numberOfIdleIterations = 0;
+		while (!mShutdownThreads)
+		{
+			if (tryPopFromStage(stage, loadRequest))
+			{
+				return true;
+			}
+			else if (numberOfIdleIterations < ::detail::MAXIMUM_NUMBER_OF_IDLE_ITERATIONS)
+			{
+				// Stay responsive for a while, load requests usually come in bursts
+				std::this_thread::yield();
+				++numberOfIdleIterations;
+			}
+			else
+			{
+				// Go to sleep until there's new work to do
+				std::unique_lock<std::mutex> sleepMutexLock(stage.sleepMutex);
+				++stage.numberOfSleepingThreads;
+				stage.sleepConditionVariable.wait(sleepMutexLock, [this, &stage]{ return mShutdownThreads || stage.numberOfQueuedLoadRequests > 0; });
+				--stage.numberOfSleepingThreads;
+				numberOfIdleIterations = 0;
+			}
+		}
+		return false;
+	}
+
+	void ResourceStreamer::deserializeLoadRequest(LoadRequest& loadRequest)
+	{
+		// A load request coming back from the asynchronous file reader already went through the resource loader setup
+		if (nullptr == loadRequest.readRequest)
+		{
+			if (!acquireResourceLoader(loadRequest))
+			{
+				// We were unable to acquire a resource loader instance, we just have to try it later again
+				return;
+			}
+
+			// We've got a resource loader instance now, let's continue with the resource streaming pipeline
+			loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
+
+			// Read loose asset files asynchronously, the deserialization worker thread can continue with other load requests in the meantime
+			// -> Asset files inside asset archives are slices of an already opened or mapped file, there's nothing to gain
+			if (loadRequest.resourceLoader->hasDeserialization())
+			{
+				const std::string absoluteFilename = mRenderer.getAssetManager().mapAssetToAbsoluteFilename(loadRequest.resourceLoader->getAsset());
+				if (!absoluteFilename.empty())
+				{
+					FileReadRequest* fileReadRequest = new FileReadRequest(absoluteFilename, *this, loadRequest);
+					if (!loadRequest.resourceLoader->addAsynchronousReadRanges(*fileReadRequest))
 					{
-						// The resource loader type ID is already known
-
-						// First check whether or not we're able to reuse a free resource loader instance
-						ResourceLoaderType& resourceLoaderType = iterator->second;
-						ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
-						if (freeResourceLoaders.empty())
-						{
-							// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
-							if (resourceLoaderType.numberOfInstances < 5)
-							{
-								loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-								SE_ASSERT(nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
-								++resourceLoaderType.numberOfInstances;
-							}
-							else
-							{
-								// We were unable to acquire a resource loader instance, we just have to try it later again
-								resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
-								++mDeserializationWaitingQueueRequests;
-							}
-						}
-						else
-						{
-							loadRequest.resourceLoader = freeResourceLoaders.back();
-							freeResourceLoaders.pop_back();
-						}
+						// The resource loader must read something, fall back to the whole file
+						fileReadRequest->addReadRange(0);
 					}
+					mAsyncFileReader->submit(*fileReadRequest);
+					return;
 				}
+			}
+		}
+		else if (!loadRequest.readRequest->hasSucceeded())
+		{
+			// The asynchronous read failed (e.g. the asset file is inside a ZIP archive mounted by the file manager), read the asset file the usual way
+			delete loadRequest.readRequest;
+			loadRequest.readRequest = nullptr;
+		}
+		else if (loadRequest.resourceLoader->addAsynchronousReadRanges(*loadRequest.readRequest))
+		{
+			// The resource loader needs further asset file ranges, e.g. after it has seen the file header, the deserialization worker thread can continue with other load requests in the meantime
+			mAsyncFileReader->submit(*loadRequest.readRequest);
+			return;
+		}
 
-				// If we've got a resource loader instance now, let's continue with the resource streaming pipeline
-				if (nullptr != loadRequest.resourceLoader)
+		// Do the work
+		if (loadRequest.resourceLoader->hasDeserialization())
+		{
+			const AssetManager& assetManager = mRenderer.getAssetManager();
+			const Asset& asset = loadRequest.resourceLoader->getAsset();
+			AsyncFileReader::ReadRequest* readRequest = loadRequest.readRequest;
+			loadRequest.readRequest = nullptr;
+			IFile* file = (nullptr != readRequest) ? readRequest : assetManager.openAssetFile(asset);
+			if (nullptr != file)
+			{
+				if (loadRequest.resourceLoader->onDeserialization(*file))
 				{
-					deserializationMutexLock.unlock();
-					loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
-
-					// Do the work
-					if (loadRequest.resourceLoader->hasDeserialization())
+					// Push the load request into the queue of the next resource streamer pipeline stage
+					if (loadRequest.resourceLoader->hasProcessing())
 					{
-						IFileManager& fileManager = mRenderer.getFileManager();
-						IFile* file = fileManager.openFile(IFileManager::FileMode::READ, loadRequest.resourceLoader->getAsset().virtualFilename);
-						if (nullptr != file)
-						{
-							if (loadRequest.resourceLoader->onDeserialization(*file))
-							{
-								// Push the load request into the queue of the next resource streamer pipeline stage
-								if (loadRequest.resourceLoader->hasProcessing())
-								{
-									// Resource streamer stage: 2. Asynchronous processing
-									std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-									mProcessingQueue.push_back(loadRequest);
-									processingMutexLock.unlock();
-									mProcessingConditionVariable.notify_one();
-								}
-								else
-								{
-									// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-									std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-									mDispatchQueue.push_back(loadRequest);
-								}
-							}
-							else
-							{
-								// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
-								loadRequest.loadingFailed = true;
-								std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-								mDispatchQueue.push_back(loadRequest);
-							}
-							fileManager.closeFile(*file);
-						}
-						else
-						{
-							// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
-							SE_ASSERT(false, "We should never end up in here")
-						}
+						// Resource streamer stage: 2. Asynchronous processing
+						pushToStage(mProcessingStage, loadRequest);
 					}
 					else
 					{
-						// Push the load request into the queue of the next resource streamer pipeline stage
-						// -> Resource streamer stage: 2. Asynchronous processing
-						std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-						mProcessingQueue.push_back(loadRequest);
-						processingMutexLock.unlock();
-						mProcessingConditionVariable.notify_one();
+						// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+						pushToDispatchQueue(loadRequest);
 					}
+				}
+				else
+				{
+					// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
+					loadRequest.loadingFailed = true;
+					pushToDispatchQueue(loadRequest);
+				}
+				if (nullptr != readRequest)
+				{
+					delete readRequest;
+				}
+				else
+				{
+					assetManager.closeAssetFile(asset, *file);
+				}
+			}
+			else
+			{
+				// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
+				SE_ASSERT(false, "We should never end up in here")
+			}
+		}
+		else
+		{
+			// Push the load request into the queue of the next resource streamer pipeline stage
+			// -> Resource streamer stage: 2. Asynchronous processing
+			pushToStage(mProcessingStage, loadRequest);
+		}
+	}
+
+	bool ResourceStreamer::acquireResourceLoader(LoadRequest& loadRequest)
+	{
+		std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
+		const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
+		ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
+		if (mResourceLoaderTypeManager.cend() == iterator)
+		{
+			// The resource loader type ID is unknown, yet
+			ResourceLoaderType resourceLoaderType;
+			resourceLoaderType.numberOfInstances = 1;
+			mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
+			loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+		}
+		else
+		{
+			// The resource loader type ID is already known
 
-					// We're ready for the next round
-					deserializationMutexLock.lock();
+			// First check whether or not we're able to reuse a free resource loader instance
+			ResourceLoaderType& resourceLoaderType = iterator->second;
+			ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
+			if (freeResourceLoaders.empty())
+			{
+				// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
+				if (resourceLoaderType.numberOfInstances < mMaximumNumberOfResourceLoaderInstances)
+				{
+					loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+					SE_ASSERT(nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
+					++resourceLoaderType.numberOfInstances;
+				}
+				else
+				{
+					// The load request waits for a free resource loader instance
+					resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
+					return false;
 				}
 			}
+			else
+			{
+				loadRequest.resourceLoader = freeResourceLoaders.back();
+				freeResourceLoaders.pop_back();
+			}
 		}
+
+		// Done
+		return true;
 	}
 
-	void ResourceStreamer::processingThreadWorker()
+	void ResourceStreamer::processLoadRequest(LoadRequest& loadRequest)
 	{
-		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 2", "Renderer: Resource streamer stage: 2. Asynchronous processing")
+		// Do the work
+		loadRequest.resourceLoader->onProcessing();
 
-		// Resource streamer stage: 2. Asynchronous processing
-		while (!mShutdownProcessingThread)
+		// Push the load request into the queue of the next resource streamer pipeline stage
+		// -> Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+		pushToDispatchQueue(loadRequest);
+	}
+
+	void ResourceStreamer::pushToDispatchQueue(LoadRequest& loadRequest)
+	{
+		SE_ASSERT(static_cast<uint8_t>(loadRequest.priority) < NUMBER_OF_PRIORITIES, "Invalid load request priority")
+		promoteLoadRequest(loadRequest);
+		std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
+		loadRequest.dispatchFrameNumber = mDispatchFrameNumber;
+		mDispatchQueues[static_cast<uint8_t>(loadRequest.priority)].push_back(loadRequest);
+	}
+
+	void ResourceStreamer::promoteLoadRequest(LoadRequest& loadRequest)
+	{
+		// Load requests of resources someone is blocked on inside "Renderer::ResourceStreamer::enforceFullyLoaded()" get the highest priority class
+		if (Priority::VISIBLE_NOW != loadRequest.priority && mNumberOfPromotedResources > 0)
 		{
-			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-			mProcessingConditionVariable.wait(processingMutexLock);
-			while (!mProcessingQueue.empty() && !mShutdownProcessingThread)
+			std::lock_guard<std::mutex> promotionMutexLock(mPromotionMutex);
+			if (std::find(mPromotedResources.cbegin(), mPromotedResources.cend(), PromotedResource(loadRequest.resourceManager, loadRequest.resourceId)) != mPromotedResources.cend())
 			{
-				// Get the load request
-				LoadRequest loadRequest = mProcessingQueue.front();
-				mProcessingQueue.pop_front();
-				processingMutexLock.unlock();
-
-				// Do the work
-				loadRequest.resourceLoader->onProcessing();
-
-				{ // Push the load request into the queue of the next resource streamer pipeline stage
-				  // -> Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					mDispatchQueue.push_back(loadRequest);
+				loadRequest.priority = Priority::VISIBLE_NOW;
+			}
+		}
+	}
+
+	bool ResourceStreamer::dispatchLoadRequests(uint32_t dispatchTimeBudget, Priority lowestPriority)
+	{
+		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+		bool progress = false;
+
+		// Continue as long as there's a load request left inside the queues and we're still in the time budget (the show must go on)
+		const Stopwatch stopwatch(true);
+		bool stillInTimeBudget = true;
+		while (stillInTimeBudget)
+		{
+			// Get the load request with the highest priority class
+			std::unique_lock<std::mutex> dispatchMutexLock(mDispatchMutex);
+			LoadRequests* dispatchQueue = nullptr;
+			for (uint8_t priority = 0; priority <= static_cast<uint8_t>(lowestPriority); ++priority)
+			{
+				if (!mDispatchQueues[priority].empty())
+				{
+					dispatchQueue = &mDispatchQueues[priority];
+					break;
 				}
+			}
+			if (nullptr == dispatchQueue)
+			{
+				break;
+			}
+			LoadRequest loadRequest = dispatchQueue->front();
+			dispatchQueue->pop_front();
+			dispatchMutexLock.unlock();
+
+			// Do the work
+			if (loadRequest.loadingFailed || loadRequest.resourceLoader->onDispatch())
+			{
+				// Load request is finished now
+				finalizeLoadRequest(loadRequest);
+			}
+			else
+			{
+				mFullyLoadedWaitingQueue.push_back(loadRequest);
+			}
+			progress = true;
+
+			// At least one load request is dispatched per call, so the streaming always makes progress
+			stillInTimeBudget = (0 == dispatchTimeBudget || stopwatch.getMicroseconds() < static_cast<std::time_t>(dispatchTimeBudget));
+		}
 
-				// We're ready for the next round
-				processingMutexLock.lock();
+		// Check fully loaded waiting queue
+		for (size_t i = 0; i < mFullyLoadedWaitingQueue.size();)
+		{
+			const LoadRequest& loadRequest = mFullyLoadedWaitingQueue[i];
+			if (loadRequest.resourceLoader->isFullyLoaded())
+			{
+				// Load request is finished now
+				finalizeLoadRequest(loadRequest);
+				progress = true;
+
+				// Remove from queue by moving the last load request into the freed slot, the order doesn't matter in here
+				mFullyLoadedWaitingQueue[i] = mFullyLoadedWaitingQueue.back();
+				mFullyLoadedWaitingQueue.pop_back();
+			}
+			else
+			{
+				// Next, please
+				++i;
 			}
 		}
+
+		// Done
+		return progress;
 	}
 
 	void ResourceStreamer::finalizeLoadRequest(const LoadRequest& loadRequest)
@@ -343,15 +652,10 @@ namespace Renderer
 					// Get the waiting resource streamer load request and immediately release our resource manager mutex
 					LoadRequest waitingLoadRequest = waitingLoadRequests.front();
 					waitingLoadRequests.pop_front();
-					SE_ASSERT(0 != mDeserializationWaitingQueueRequests, "Invalid deserialization waiting queue requests")
-					--mDeserializationWaitingQueueRequests;
 					resourceManagerMutexLock.unlock();
 
 					// Throw the fish back into the ocean
-					std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-					mDeserializationQueue.push_back(waitingLoadRequest);
-					deserializationMutexLock.unlock();
-					mDeserializationConditionVariable.notify_one();
+					pushToStage(mDeserializationStage, waitingLoadRequest);
 				}
 			}
 			else
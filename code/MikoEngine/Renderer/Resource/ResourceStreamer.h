@@ -4,6 +4,9 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Asset/Asset.h"
+#include "Renderer/Resource/IResourceManager.h"
+#include "Renderer/Core/Thread/BoundedMpmcQueue.h"
+#include "Core/File/AsyncFileReader.h"
 
 // Disable warnings in external headers, we can't fix them
 SE_PRAGMA_WARNING_PUSH
@@ -29,7 +32,6 @@ namespace Renderer
 {
 	class IResource;
 	class IResourceLoader;
-	class IResourceManager;
 	class IRenderer;
 }
 
@@ -67,8 +69,16 @@ namespace Renderer
 	*    2. Asynchronous processing
 	*    3. Synchronous dispatch, e.g. to the RHI implementation
 	*
-	*  @todo
-	*    - TODO(co) It might make sense to use lock-free-queues in here
+	*    The asynchronous stages are backed by lock-free bounded queues and each of them has a configurable number of worker threads, so
+	*    e.g. decompression and texture transcoding scale across the available CPU cores. Idle worker threads go to sleep. Load requests of
+	*    the highest priority class pass the asynchronous stages through separate urgent queues which are always served first.
+	*
+	*    Loose asset files are read by an asynchronous file reader (io_uring on Linux) instead of blocking a deserialization worker thread
+	*    per file. After the resource loader instance was acquired the load request leaves the deserialization stage until its asset file
+	*    is inside memory and comes back for the actual deserialization. This way many reads are in flight at once.
+	*
+	*    The synchronous dispatch is limited by a per-frame time budget and is done in the order of the load request priority classes. Load
+	*    requests waiting too long inside the dispatch queue are promoted to the next higher priority class so nothing starves.
 	*/
 	class ResourceStreamer final
 	{
@@ -84,6 +94,13 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
+		typedef ResourceLoadPriority Priority;	// Load request priority class, lower values are dispatched first
+		static constexpr uint8_t  NUMBER_OF_PRIORITIES					= 3;
+		static constexpr uint32_t DEFAULT_DISPATCH_TIME_BUDGET			= 2000;	// Default per-frame synchronous dispatch time budget in microseconds
+		static constexpr uint32_t NUMBER_OF_FRAMES_UNTIL_PRIORITY_AGING = 30;	// Number of frames a load request waits inside the dispatch queue before it's promoted to the next higher priority class
+		static constexpr uint32_t STAGE_QUEUE_CAPACITY					= 16384;	// Capacity of the lock-free queue of an asynchronous stage, must be a power of two, producers wait if a queue is full
+		static constexpr uint32_t URGENT_STAGE_QUEUE_CAPACITY			= 1024;		// Capacity of the lock-free urgent queue of an asynchronous stage, must be a power of two, if it's full the regular queue is used
+
 		struct LoadRequest final
 		{
 			// Data provided from the outside
@@ -92,19 +109,39 @@ namespace Renderer
 			bool				 reload;				// "true" if the resource is new in memory, else "false" for reload an already loaded resource (and e.g. update cache entries)
 			IResourceManager*	 resourceManager;		// Must be valid, do not destroy the instance
 			ResourceId			 resourceId;			// Must be valid
+			Priority			 priority;				// Priority class of the synchronous dispatch, might get promoted while waiting inside the dispatch queue
 			// In-flight data
-			mutable IResourceLoader* resourceLoader;	// Null pointer at first, must be valid as soon as the load request is in-flight, do not destroy the instance
-			bool					 loadingFailed;		// "true" if loading failed, else "false"
+			mutable IResourceLoader* resourceLoader;		// Null pointer at first, must be valid as soon as the load request is in-flight, do not destroy the instance
+			bool					 loadingFailed;			// "true" if loading failed, else "false"
+			uint32_t				 dispatchFrameNumber;	// Dispatch frame number the load request entered its current dispatch queue, used for priority aging
+			AsyncFileReader::ReadRequest* readRequest;		// Asynchronously read asset file, null pointer as long as the asset file hasn't been read, destroyed by the deserialization
 
 			// Methods
-			inline LoadRequest(const Asset& _asset, ResourceLoaderTypeId _resourceLoaderTypeId, bool _reload, IResourceManager& _resourceManager, ResourceId _resourceId) :
+			inline LoadRequest() :
+				asset(nullptr),
+				resourceLoaderTypeId(GetInvalid<ResourceLoaderTypeId>()),
+				reload(false),
+				resourceManager(nullptr),
+				resourceId(GetInvalid<ResourceId>()),
+				priority(Priority::PREFETCH),
+				resourceLoader(nullptr),
+				loadingFailed(false),
+				dispatchFrameNumber(0),
+				readRequest(nullptr)
+			{
+				// Nothing here, required by the lock-free stage queues
+			}
+			inline LoadRequest(const Asset& _asset, ResourceLoaderTypeId _resourceLoaderTypeId, bool _reload, IResourceManager& _resourceManager, ResourceId _resourceId, Priority _priority = Priority::PREFETCH) :
 				asset(&_asset),
 				resourceLoaderTypeId(_resourceLoaderTypeId),
 				reload(_reload),
 				resourceManager(&_resourceManager),
 				resourceId(_resourceId),
+				priority(_priority),
 				resourceLoader(nullptr),
-				loadingFailed(false)
+				loadingFailed(false),
+				dispatchFrameNumber(0),
+				readRequest(nullptr)
 			{
 				// Nothing here
 			}
@@ -121,38 +158,83 @@ namespace Renderer
 			return mNumberOfInFlightLoadRequests;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfDeserializationThreads() const
+		{
+			return static_cast<uint32_t>(mDeserializationStage.threads.size());
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfProcessingThreads() const
+		{
+			return static_cast<uint32_t>(mProcessingStage.threads.size());
+		}
+
+		/**
+		*  @brief
+		*    Return the per-frame synchronous dispatch time budget
+		*
+		*  @return
+		*    The per-frame synchronous dispatch time budget in microseconds, 0 if there's no time budget
+		*/
+		[[nodiscard]] inline uint32_t getDispatchTimeBudget() const
+		{
+			return mDispatchTimeBudget;
+		}
+
+		/**
+		*  @brief
+		*    Set the per-frame synchronous dispatch time budget
+		*
+		*  @param[in] dispatchTimeBudget
+		*    The per-frame synchronous dispatch time budget in microseconds, 0 for no time budget (default: "Renderer::ResourceStreamer::DEFAULT_DISPATCH_TIME_BUDGET")
+		*
+		*  @note
+		*    - At least one load request is dispatched per frame, regardless of the time budget
+		*/
+		inline void setDispatchTimeBudget(uint32_t dispatchTimeBudget)
+		{
+			mDispatchTimeBudget = dispatchTimeBudget;
+		}
+
 		void commitLoadRequest(const LoadRequest& loadRequest);
 		void flushAllQueues();
 
+		/**
+		*  @brief
+		*    Emergency immediate processing: Block until the given resource has been loaded
+		*
+		*  @param[in] resource
+		*    Resource to wait for, its load request must have been committed
+		*
+		*  @remarks
+		*    The load request of the given resource is promoted to the highest priority class, wherever it currently is. Load requests
+		*    committed by the calling thread while waiting (e.g. dependencies committed by a resource loader during the dispatch) are
+		*    promoted as well, so the whole dependency chain jumps the queues. Instead of sleeping, the calling thread runs the resource
+		*    streamer stages inline. Unrelated load requests are only dispatched if there's nothing else to do, so the waiting can't stall.
+		*
+		*  @note
+		*    - Only call this from the thread which calls "Renderer::ResourceStreamer::dispatch()", nested calls are allowed
+		*    - Returns as soon as the resource is either loaded or its loading failed
+		*/
+		void enforceFullyLoaded(const IResource& resource);
+
 		/**
 		*  @brief
 		*    Resource streamer update performing dispatch to e.g. the RHI implementation
 		*
 		*  @note
 		*    - Call this once per frame
+		*    - Respects the dispatch time budget and the load request priority classes
 		*/
 		void dispatch();
 
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit ResourceStreamer(IRenderer& renderer);
-		~ResourceStreamer();
-		explicit ResourceStreamer(const ResourceStreamer&) = delete;
-		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
-		void deserializationThreadWorker();
-		void processingThreadWorker();
-		void finalizeLoadRequest(const LoadRequest& loadRequest);
-
-
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
 		typedef std::vector<IResourceLoader*> ResourceLoaders;
 		typedef std::deque<LoadRequest> LoadRequests;
+		typedef std::vector<LoadRequest> FullyLoadedWaitingLoadRequests;
 		struct ResourceLoaderType final
 		{
 			uint32_t		numberOfInstances;
@@ -160,6 +242,91 @@ namespace Renderer
 			LoadRequests	waitingLoadRequests;
 		};
 		typedef std::unordered_map<uint32_t, ResourceLoaderType> ResourceLoaderTypeManager;	// Key = "Renderer::ResourceLoaderTypeId"
+		typedef std::vector<std::thread> Threads;
+		typedef std::pair<const IResourceManager*, ResourceId> PromotedResource;
+		typedef std::vector<PromotedResource> PromotedResources;
+
+		/**
+		*  @brief
+		*    Asynchronous resource streamer stage with a lock-free load request queue and worker threads which go to sleep if there's nothing to do
+		*/
+		struct Stage final
+		{
+			BoundedMpmcQueue<LoadRequest> urgentQueue;					// Load requests of the highest priority class, always served first
+			BoundedMpmcQueue<LoadRequest> queue;
+			std::atomic<uint32_t>		  numberOfQueuedLoadRequests;	// Only a hint used to decide whether or not sleeping worker threads need to be woken up
+			std::atomic<uint32_t>		  numberOfSleepingThreads;
+			std::mutex					  sleepMutex;
+			std::condition_variable		  sleepConditionVariable;
+			Threads						  threads;
+
+			inline Stage() :
+				urgentQueue(URGENT_STAGE_QUEUE_CAPACITY),
+				queue(STAGE_QUEUE_CAPACITY),
+				numberOfQueuedLoadRequests(0),
+				numberOfSleepingThreads(0)
+			{
+				// Nothing here
+			}
+		};
+
+		/**
+		*  @brief
+		*    Asynchronous read of an asset file, the load request continues inside the deserialization stage as soon as the asset file is inside memory
+		*/
+		struct FileReadRequest final : public AsyncFileReader::ReadRequest
+		{
+			ResourceStreamer& resourceStreamer;
+			LoadRequest		  loadRequest;
+
+			inline FileReadRequest(const std::string& absoluteFilename, ResourceStreamer& _resourceStreamer, const LoadRequest& _loadRequest) :
+				AsyncFileReader::ReadRequest(absoluteFilename, &ResourceStreamer::onFileReadCompleted),
+				resourceStreamer(_resourceStreamer),
+				loadRequest(_loadRequest)
+			{
+				// Nothing here
+			}
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		static void onFileReadCompleted(AsyncFileReader::ReadRequest& readRequest);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] renderer
+		*    Renderer instance to use
+		*  @param[in] numberOfDeserializationThreads
+		*    Number of worker threads of the asynchronous deserialization stage, invalid number of threads means one thread (deserialization is mostly I/O bound)
+		*  @param[in] numberOfProcessingThreads
+		*    Number of worker threads of the asynchronous processing stage, invalid number of threads means the hardware threads the job system leaves free, at least one (processing is CPU bound)
+		*/
+		explicit ResourceStreamer(IRenderer& renderer, uint32_t numberOfDeserializationThreads = GetInvalid<uint32_t>(), uint32_t numberOfProcessingThreads = GetInvalid<uint32_t>());
+		~ResourceStreamer();
+		explicit ResourceStreamer(const ResourceStreamer&) = delete;
+		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
+		void deserializationThreadWorker();
+		void processingThreadWorker();
+		void pushToStage(Stage& stage, LoadRequest& loadRequest);
+		[[nodiscard]] bool tryPopFromStage(Stage& stage, LoadRequest& loadRequest);
+		[[nodiscard]] bool popFromStage(Stage& stage, LoadRequest& loadRequest);
+		[[nodiscard]] bool acquireResourceLoader(LoadRequest& loadRequest);
+		void deserializeLoadRequest(LoadRequest& loadRequest);
+		void processLoadRequest(LoadRequest& loadRequest);
+		void pushToDispatchQueue(LoadRequest& loadRequest);
+		bool dispatchLoadRequests(uint32_t dispatchTimeBudget, Priority lowestPriority = Priority::BACKGROUND);
+		void promoteLoadRequest(LoadRequest& loadRequest);
+		void finalizeLoadRequest(const LoadRequest& loadRequest);
 
 
 	//[-------------------------------------------------------]
@@ -169,24 +336,24 @@ namespace Renderer
 		IRenderer&			  mRenderer;	// Renderer instance, do not destroy the instance
 		std::mutex			  mResourceManagerMutex;
 		std::atomic<uint32_t> mNumberOfInFlightLoadRequests;
+		std::atomic<bool>	  mShutdownThreads;
 		// Resource streamer stage: 1. Asynchronous deserialization
-		std::atomic<bool>		    mShutdownDeserializationThread;
-		std::mutex					mDeserializationMutex;
-		std::condition_variable		mDeserializationConditionVariable;
-		LoadRequests				mDeserializationQueue;
-		ResourceLoaderTypeManager	mResourceLoaderTypeManager;	// Do only touch if "mResourceManagerMutex" is locked
-		std::atomic<uint32_t>		mDeserializationWaitingQueueRequests;
-		std::thread					mDeserializationThread;
+		Stage						mDeserializationStage;
+		AsyncFileReader*			mAsyncFileReader;							// Reads the loose asset files while the deserialization worker threads are busy with other load requests, always valid, destroy the instance if you no longer need it
+		ResourceLoaderTypeManager	mResourceLoaderTypeManager;					// Do only touch if "mResourceManagerMutex" is locked
+		uint32_t					mMaximumNumberOfResourceLoaderInstances;	// Maximum number of simultaneous instances per resource loader type, keeps the memory consumption under control
 		// Resource streamer stage: 2. Asynchronous processing
-		std::atomic<bool>		mShutdownProcessingThread;
-		std::mutex				mProcessingMutex;
-		std::condition_variable mProcessingConditionVariable;
-		LoadRequests			mProcessingQueue;
-		std::thread				mProcessingThread;
+		Stage mProcessingStage;
 		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-		std::mutex	 mDispatchMutex;
-		LoadRequests mDispatchQueue;
-		LoadRequests mFullyLoadedWaitingQueue;
+		std::mutex					   mDispatchMutex;
+		LoadRequests				   mDispatchQueues[NUMBER_OF_PRIORITIES];	// Index = "Renderer::ResourceStreamer::Priority"
+		FullyLoadedWaitingLoadRequests mFullyLoadedWaitingQueue;				// Only touched by the thread calling the dispatch, the order doesn't matter
+		std::atomic<uint32_t>		   mDispatchFrameNumber;
+		uint32_t					   mDispatchTimeBudget;						// Per-frame synchronous dispatch time budget in microseconds, 0 if there's no time budget
+		// Emergency immediate processing
+		std::mutex			  mPromotionMutex;
+		PromotedResources	  mPromotedResources;			// Resources waited for by "Renderer::ResourceStreamer::enforceFullyLoaded()", do only touch if "mPromotionMutex" is locked
+		std::atomic<uint32_t> mNumberOfPromotedResources;	// Allows to skip the promotion check without locking "mPromotionMutex"
 
 
 	};
@@ -0,0 +1,269 @@
+#include "stdafx.h"
+#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86)
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <cpuid.h>
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		struct CpuFeatures final
+		{
+			bool avx2;
+			bool avx512;	// AVX-512 foundation
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+			{
+				#if defined(_M_X64) || defined(_M_IX86)
+					int cpuInfo[4] = {};
+					__cpuidex(cpuInfo, static_cast<int>(leaf), static_cast<int>(subleaf));
+					for (int i = 0; i < 4; ++i)
+					{
+						registers[i] = static_cast<uint32_t>(cpuInfo[i]);
+					}
+				#else
+					__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+				#endif
+			}
+
+			[[nodiscard]] uint64_t xgetbv()
+			{
+				#if defined(_M_X64) || defined(_M_IX86)
+					return _xgetbv(0);
+				#else
+					uint32_t eax = 0;
+					uint32_t edx = 0;
+					__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+					return (static_cast<uint64_t>(edx) << 32) | eax;
+				#endif
+			}
+		#endif
+
+		[[nodiscard]] CpuFeatures getCpuFeatures()
+		{
+			CpuFeatures cpuFeatures = {};
+			#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+				uint32_t registers[4] = {};	// EAX, EBX, ECX, EDX
+				cpuid(0, 0, registers);
+				const uint32_t maximumLeaf = registers[0];
+				if (maximumLeaf >= 7)
+				{
+					// The operating system must support saving the extended registers on context switches, else the instructions fault
+					cpuid(1, 0, registers);
+					const bool osxsave = (0 != (registers[2] & (1u << 27)));
+					const bool avx = (0 != (registers[2] & (1u << 28)));
+					if (osxsave && avx)
+					{
+						const uint64_t xcr0 = xgetbv();
+						cpuid(7, 0, registers);
+						cpuFeatures.avx2 = (0x06 == (xcr0 & 0x06) && 0 != (registers[1] & (1u << 5)));							// XMM and YMM state, AVX2
+						cpuFeatures.avx512 = (cpuFeatures.avx2 && 0xe6 == (xcr0 & 0xe6) && 0 != (registers[1] & (1u << 16)));	// Additionally opmask and ZMM state, AVX-512F
+					}
+				}
+			#endif
+			return cpuFeatures;
+		}
+
+		#if SE_DEBUG
+			/**
+			*  @brief
+			*    Check that the given scene culling kernels deliver bit-exact identical results as the reference scene culling kernels
+			*/
+			void validateSceneCullingKernels(const Renderer::SceneCullingKernels& sceneCullingKernels, const Renderer::SceneCullingKernels& referenceSceneCullingKernels)
+			{
+				// Random test data, including the data array padding
+				static constexpr uint32_t NUMBER_OF_SCENE_ITEMS = 64;
+				static constexpr uint32_t PADDED_NUMBER_OF_SCENE_ITEMS = NUMBER_OF_SCENE_ITEMS + Renderer::SceneCullingKernels::MAXIMUM_SIMD_LANE_COUNT;
+				static constexpr uint32_t NUMBER_OF_FLOAT_ARRAYS = 4 + 6 + 16;	// Sphere, bounding box, matrix
+				struct alignas(Renderer::SceneCullingKernels::SIMD_ALIGNMENT) TestData final
+				{
+					float	 floatArrays[NUMBER_OF_FLOAT_ARRAYS][PADDED_NUMBER_OF_SCENE_ITEMS];
+					uint32_t indirection[PADDED_NUMBER_OF_SCENE_ITEMS];
+					uint32_t visibilityFlag[2][PADDED_NUMBER_OF_SCENE_ITEMS];
+					float	 projectedRadius[2][PADDED_NUMBER_OF_SCENE_ITEMS];
+				};
+				std::unique_ptr<TestData> testData = std::make_unique<TestData>();
+				uint32_t randomState = 0x9e3779b9u;
+				const auto getRandomFloat = [&randomState](float minimum, float maximum)
+				{
+					randomState ^= randomState << 13;
+					randomState ^= randomState >> 17;
+					randomState ^= randomState << 5;
+					return minimum + (maximum - minimum) * static_cast<float>(randomState & 0xffffu) / 65535.0f;
+				};
+				for (uint32_t i = 0; i < PADDED_NUMBER_OF_SCENE_ITEMS; ++i)
+				{
+					for (uint32_t arrayIndex = 0; arrayIndex < NUMBER_OF_FLOAT_ARRAYS; ++arrayIndex)
+					{
+						testData->floatArrays[arrayIndex][i] = getRandomFloat(-10.0f, 10.0f);
+					}
+					testData->floatArrays[3][i] = getRandomFloat(-4.0f, -0.1f);	// Negative radius
+					testData->indirection[i] = (i * 7) % NUMBER_OF_SCENE_ITEMS;
+				}
+
+				// Kernel data
+				Renderer::SceneCullingSphereData sphereData = {};
+				sphereData.spherePositionX = testData->floatArrays[0];
+				sphereData.spherePositionY = testData->floatArrays[1];
+				sphereData.spherePositionZ = testData->floatArrays[2];
+				sphereData.negativeRadius = testData->floatArrays[3];
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					sphereData.worldSpaceCameraPosition[i] = getRandomFloat(-1.0f, 1.0f);
+				}
+				for (uint32_t p = 0; p < 6; ++p)
+				{
+					for (uint32_t i = 0; i < 4; ++i)
+					{
+						sphereData.planes[p][i] = getRandomFloat(-1.0f, 1.0f);
+					}
+				}
+				Renderer::SceneCullingOobbData oobbData = {};
+				oobbData.minimumX = testData->floatArrays[4];
+				oobbData.minimumY = testData->floatArrays[5];
+				oobbData.minimumZ = testData->floatArrays[6];
+				oobbData.maximumX = testData->floatArrays[7];
+				oobbData.maximumY = testData->floatArrays[8];
+				oobbData.maximumZ = testData->floatArrays[9];
+				for (uint32_t row = 0; row < 4; ++row)
+				{
+					for (uint32_t column = 0; column < 4; ++column)
+					{
+						oobbData.world[row][column] = testData->floatArrays[10 + row * 4 + column];
+						oobbData.viewSpaceToClipSpaceMatrix[row][column] = getRandomFloat(-1.0f, 1.0f);
+					}
+				}
+				oobbData.indirection = testData->indirection;
+				Renderer::SceneCullingContributionData contributionData = {};
+				contributionData.spherePositionX = sphereData.spherePositionX;
+				contributionData.spherePositionY = sphereData.spherePositionY;
+				contributionData.spherePositionZ = sphereData.spherePositionZ;
+				contributionData.negativeRadius = sphereData.negativeRadius;
+				for (uint32_t i = 0; i < 3; ++i)
+				{
+					contributionData.worldSpaceCameraPosition[i] = sphereData.worldSpaceCameraPosition[i];
+				}
+				for (uint32_t i = 0; i < 4; ++i)
+				{
+					contributionData.clipSpaceW[i] = getRandomFloat(-1.0f, 1.0f);
+				}
+				contributionData.projectionScale = getRandomFloat(100.0f, 1000.0f);
+				contributionData.minimumProjectedRadius = getRandomFloat(0.0f, 100.0f);
+				contributionData.indirection = testData->indirection;
+
+				// Compare the frustum-sphere culling, the frustum-OOBB culling and the contribution culling results
+				const Renderer::SceneCullingKernels* sceneCullingKernelsToCompare[2] = { &sceneCullingKernels, &referenceSceneCullingKernels };
+				for (uint32_t kernelIndex = 0; kernelIndex < 3; ++kernelIndex)
+				{
+					for (uint32_t i = 0; i < 2; ++i)
+					{
+						sphereData.visibilityFlag = testData->visibilityFlag[i];
+						oobbData.visibilityFlag = testData->visibilityFlag[i];
+						contributionData.visibilityFlag = testData->visibilityFlag[i];
+						contributionData.projectedRadius = testData->projectedRadius[i];
+						if (0 == kernelIndex)
+						{
+							sceneCullingKernelsToCompare[i]->sphereCulling(sphereData, 0, NUMBER_OF_SCENE_ITEMS);
+						}
+						else if (1 == kernelIndex)
+						{
+							sceneCullingKernelsToCompare[i]->oobbCulling(oobbData, 0, NUMBER_OF_SCENE_ITEMS);
+						}
+						else
+						{
+							sceneCullingKernelsToCompare[i]->contributionCulling(contributionData, 0, NUMBER_OF_SCENE_ITEMS);
+						}
+					}
+					SE_ASSERT(0 == memcmp(testData->visibilityFlag[0], testData->visibilityFlag[1], sizeof(uint32_t) * NUMBER_OF_SCENE_ITEMS), "Scene culling kernels don't deliver bit-exact identical results as the reference scene culling kernels")
+				}
+				SE_ASSERT(0 == memcmp(testData->projectedRadius[0], testData->projectedRadius[1], sizeof(float) * NUMBER_OF_SCENE_ITEMS), "Scene culling kernels don't deliver bit-exact identical results as the reference scene culling kernels")
+			}
+		#endif
+
+		[[nodiscard]] const Renderer::SceneCullingKernels& selectBestSceneCullingKernels()
+		{
+			// Pick the widest instruction set supported by the CPU as well as by the target architecture
+			const CpuFeatures cpuFeatures = getCpuFeatures();
+			const Renderer::SceneCullingKernels* sceneCullingKernels = nullptr;
+			if (cpuFeatures.avx512)
+			{
+				sceneCullingKernels = Renderer::SceneCullingKernels::getAvx512();
+			}
+			if (nullptr == sceneCullingKernels && cpuFeatures.avx2)
+			{
+				sceneCullingKernels = Renderer::SceneCullingKernels::getAvx2();
+			}
+			if (nullptr == sceneCullingKernels)
+			{
+				sceneCullingKernels = Renderer::SceneCullingKernels::getNeon();
+			}
+			if (nullptr == sceneCullingKernels)
+			{
+				sceneCullingKernels = Renderer::SceneCullingKernels::getSse42();
+			}
+			SE_ASSERT(nullptr != sceneCullingKernels, "There are no scene culling kernels for the target architecture")
+
+			// In debug builds, ensure the selected scene culling kernels agree with the SSE4.2 reference implementation
+			#if SE_DEBUG
+			{
+				const Renderer::SceneCullingKernels* referenceSceneCullingKernels = Renderer::SceneCullingKernels::getSse42();
+				if (nullptr != referenceSceneCullingKernels && referenceSceneCullingKernels != sceneCullingKernels)
+				{
+					validateSceneCullingKernels(*sceneCullingKernels, *referenceSceneCullingKernels);
+				}
+			}
+			#endif
+
+			// Done
+			return *sceneCullingKernels;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	const SceneCullingKernels& SceneCullingKernels::getBest()
+	{
+		// Thread-safe one-time selection
+		static const SceneCullingKernels& sceneCullingKernels = ::detail::selectBestSceneCullingKernels();
+		return sceneCullingKernels;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,176 @@
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <cstdint>
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Input and output data of the frustum-sphere culling kernel
+	*
+	*  @note
+	*    - All data arrays must be aligned to "Renderer::SceneCullingKernels::SIMD_ALIGNMENT" and padded to "Renderer::SceneCullingKernels::MAXIMUM_SIMD_LANE_COUNT" plus one additional SIMD batch for prefetching
+	*/
+	struct SceneCullingSphereData final
+	{
+		// World space center position of bounding sphere
+		const float* spherePositionX;
+		const float* spherePositionY;
+		const float* spherePositionZ;
+		// Negative world space radius of bounding sphere
+		const float* negativeRadius;
+		// World space camera position
+		float worldSpaceCameraPosition[3];
+		// Camera relative world space frustum planes, per plane the normal x, y, z and the distance d
+		float planes[6][4];
+		// Output: 0 for culled scene items, 0xffffffff for visible scene items
+		uint32_t* visibilityFlag;
+	};
+
+	/**
+	*  @brief
+	*    Input and output data of the frustum-object-oriented-bounding-box (OOBB) culling kernel
+	*
+	*  @note
+	*    - Same data array requirements as for "Renderer::SceneCullingSphereData", the indirection array is padded as well
+	*/
+	struct SceneCullingOobbData final
+	{
+		// Minimum object space bounding box corner position
+		const float* minimumX;
+		const float* minimumY;
+		const float* minimumZ;
+		// Maximum object space bounding box corner position
+		const float* maximumX;
+		const float* maximumY;
+		const float* maximumZ;
+		// Object space to world space matrix, "world[0][0]" is "worldXX", "world[0][1]" is "worldXY" etc.
+		const float* world[4][4];
+		// View space to clip space matrix, same layout as "glm::mat4"
+		float viewSpaceToClipSpaceMatrix[4][4];
+		// Indices of the scene items to test
+		const uint32_t* indirection;
+		// Output: 0 for culled scene items, 0xffffffff for visible scene items, compacted meaning indexed by indirection index and not by scene item index
+		uint32_t* visibilityFlag;
+	};
+
+	/**
+	*  @brief
+	*    Input and output data of the contribution culling kernel
+	*
+	*  @remarks
+	*    The contribution culling kernel calculates the projected radius of the bounding sphere in pixels and culls scene items which are
+	*    too small to contribute to the rendered image, see "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html - "Conclusion"
+	*
+	*  @note
+	*    - Same data array requirements as for "Renderer::SceneCullingSphereData", the indirection array and the output arrays are padded as well
+	*/
+	struct SceneCullingContributionData final
+	{
+		// World space center position of bounding sphere
+		const float* spherePositionX;
+		const float* spherePositionY;
+		const float* spherePositionZ;
+		// Negative world space radius of bounding sphere
+		const float* negativeRadius;
+		// World space camera position
+		float worldSpaceCameraPosition[3];
+		// Fourth row of the camera relative world space to clip space matrix, delivers the clip space w which is the view space depth for perspective projections and one for orthographic projections
+		float clipSpaceW[4];
+		// Scale from world space radius divided by clip space w to pixels: 0.5 * render target height * view space to clip space matrix [1][1]
+		float projectionScale;
+		// Scene items with a smaller projected bounding sphere radius in pixels are culled
+		float minimumProjectedRadius;
+		// Indices of the scene items to test
+		const uint32_t* indirection;
+		// Output: Projected bounding sphere radius in pixels, "std::numeric_limits<float>::max()" if the camera is inside or behind the bounding sphere center, compacted meaning indexed by indirection index
+		float* projectedRadius;
+		// Output: 0 for culled scene items, 0xffffffff for visible scene items, compacted meaning indexed by indirection index
+		uint32_t* visibilityFlag;
+	};
+
+	/**
+	*  @brief
+	*    Table of scene culling kernels for one instruction set
+	*
+	*  @remarks
+	*    Each instruction set lives inside its own translation unit which is compiled with the matching instruction set compiler option.
+	*    The best instruction set supported by the CPU is selected at runtime. All kernels deliver bit-exact identical results since
+	*    they only differ in the SIMD lane count, the order of floating point operations is identical and there's no fused multiply-add.
+	*
+	*  @note
+	*    - The kernels are thread-safe as long as the processed index ranges don't overlap
+	*    - Start and end indices passed to the kernels must be multiples of the kernel SIMD lane count
+	*/
+	struct SceneCullingKernels final
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Public definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_SIMD_LANE_COUNT = 16;	// AVX-512
+		static constexpr uint32_t SIMD_ALIGNMENT		  = 64;	// AVX-512, in bytes
+		typedef void (*SphereCullingFunction)(const SceneCullingSphereData& sphereData, uint32_t startIndex, uint32_t endIndex);
+		typedef void (*OobbCullingFunction)(const SceneCullingOobbData& oobbData, uint32_t startIndex, uint32_t endIndex);
+		typedef void (*ContributionCullingFunction)(const SceneCullingContributionData& contributionData, uint32_t startIndex, uint32_t endIndex);
+
+
+		//[-------------------------------------------------------]
+		//[ Public static methods                                 ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the scene culling kernels of the best instruction set supported by the CPU
+		*
+		*  @return
+		*    The scene culling kernels of the best instruction set supported by the CPU, selected once on the first call
+		*/
+		[[nodiscard]] static const SceneCullingKernels& getBest();
+
+		/**
+		*  @brief
+		*    Return the scene culling kernels of a specific instruction set
+		*
+		*  @return
+		*    The scene culling kernels, null pointer if the instruction set isn't available for the target architecture, don't destroy the instance
+		*
+		*  @note
+		*    - Doesn't check whether or not the CPU supports the instruction set
+		*/
+		[[nodiscard]] static const SceneCullingKernels* getSse42();
+		[[nodiscard]] static const SceneCullingKernels* getAvx2();
+		[[nodiscard]] static const SceneCullingKernels* getAvx512();
+		[[nodiscard]] static const SceneCullingKernels* getNeon();
+
+
+		//[-------------------------------------------------------]
+		//[ Public data                                           ]
+		//[-------------------------------------------------------]
+		const char*					name;			// ASCII name of the instruction set, for debugging and logging
+		uint32_t					simdLaneCount;	// Number of scene items processed at once
+		SphereCullingFunction		sphereCulling;
+		OobbCullingFunction			oobbCulling;
+		ContributionCullingFunction	contributionCulling;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
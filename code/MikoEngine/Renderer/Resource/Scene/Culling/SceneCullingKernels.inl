@@ -0,0 +1,567 @@
+// Scene culling kernels shared by the instruction set specific translation units
+// -> Define "XSIMD_FORCE_X86_INSTR_SET" respectively "XSIMD_FORCE_ARM_INSTR_SET" before including this file, the translation unit must be compiled with the matching instruction set compiler option
+// -> A translation unit must only instantiate the kernels using its own SIMD batch type, else the linker might pick inline xsimd functions compiled for another instruction set
+// -> No fused multiply-add: All kernels must deliver bit-exact identical results
+// -> Only macro-only engine headers and C headers are allowed in here, the AVX translation units don't use the precompiled header so that no inline engine, GLM or STL function gets compiled with a wider instruction set than the rest of the engine
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Base/DetectCompiler.h"
+#include "Base/DetectOS.h"
+#include "Base/BaseMacros.h"
+#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+
+#include <cfloat>
+#include <cstring>
+
+#if SE_COMPILER_CLANG
+	#pragma clang fp contract(off)
+#elif SE_COMPILER_GNUC
+	#pragma GCC optimize("fp-contract=off")
+#endif
+
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4100)	// warning C4100: 'address': unreferenced formal parameter
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4242)	// warning C4242: '=': conversion from 'int' to 'T', possible loss of data
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4244)	// warning C4244: '=': conversion from 'int' to 'T', possible loss of data
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4530)	// warning C4530: C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	SE_PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <xsimd/xsimd.hpp>
+SE_PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Scene culling kernels for a SIMD batch type
+		*
+		*  @note
+		*    - The implementation is basing on "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
+		*/
+		template <typename FLOAT_BATCH>
+		struct SceneCullingKernelsImpl final
+		{
+
+
+			//[-------------------------------------------------------]
+			//[ Public definitions                                    ]
+			//[-------------------------------------------------------]
+			typedef FLOAT_BATCH FloatBatch;
+			typedef typename xsimd::simd_batch_traits<FLOAT_BATCH>::batch_bool_type BoolBatch;
+			static constexpr uint32_t SIMD_LANE_COUNT = static_cast<uint32_t>(FLOAT_BATCH::size);
+			static_assert(SIMD_LANE_COUNT <= Renderer::SceneCullingKernels::MAXIMUM_SIMD_LANE_COUNT, "The scene item set padding is too small for the SIMD lane count");
+			struct SimdPlane final
+			{
+				FloatBatch normalX;	// The normal's x value replicated "SIMD_LANE_COUNT" times
+				FloatBatch normalY;	// The normal's y value replicated "SIMD_LANE_COUNT" times
+				FloatBatch normalZ;	// etc.
+				FloatBatch d;
+			};
+			struct SimdVector final
+			{
+				FloatBatch x;	// Stores x0, x1, x2, x3, ...
+				FloatBatch y;	// Stores y0, y1, y2, y3, ...
+				FloatBatch z;	// etc.
+				FloatBatch w;
+			};
+			struct SimdMatrix final
+			{
+				SimdVector x;
+				SimdVector y;
+				SimdVector z;
+				SimdVector w;
+			};
+
+
+			//[-------------------------------------------------------]
+			//[ Public static methods                                 ]
+			//[-------------------------------------------------------]
+			[[nodiscard]] static FloatBatch load(const float* data)
+			{
+				return FloatBatch(data, xsimd::aligned_mode());
+			}
+
+			[[nodiscard]] static FloatBatch gather(const float* data, const uint32_t* indirection)
+			{
+				alignas(Renderer::SceneCullingKernels::SIMD_ALIGNMENT) float values[SIMD_LANE_COUNT];
+				for (uint32_t i = 0; i < SIMD_LANE_COUNT; ++i)
+				{
+					values[i] = data[indirection[i]];
+				}
+				return load(values);
+			}
+
+			static void storeVisibilityFlag(const BoolBatch& inside, uint32_t* visibilityFlag)
+			{
+				// Store 0 for culled scene items and 0xffffffff for visible scene items, a bitwise select keeps the all bits set pattern
+				const uint32_t allBitsSet = ~0u;
+				float allBitsSetFloat = 0.0f;
+				memcpy(&allBitsSetFloat, &allBitsSet, sizeof(float));
+				xsimd::select(inside, FloatBatch(allBitsSetFloat), FloatBatch(0.0f)).store_aligned(reinterpret_cast<float*>(visibilityFlag));
+			}
+
+			[[nodiscard]] static SimdVector simdMultiply(const SimdVector& v, const SimdMatrix& m)
+			{
+				FloatBatch x = v.x * m.x.x;     x = v.y * m.y.x + x;    x = v.z * m.z.x + x;    x = v.w * m.w.x + x;
+				FloatBatch y = v.x * m.x.y;     y = v.y * m.y.y + y;    y = v.z * m.z.y + y;    y = v.w * m.w.y + y;
+				FloatBatch z = v.x * m.x.z;     z = v.y * m.y.z + z;    z = v.z * m.z.z + z;    z = v.w * m.w.z + z;
+				FloatBatch w = v.x * m.x.w;     w = v.y * m.y.w + w;    w = v.z * m.z.w + w;    w = v.w * m.w.w + w;
+				return { x, y, z, w };
+			}
+
+			[[nodiscard]] static SimdMatrix simdMultiply(const SimdMatrix& lhs, const SimdMatrix& rhs)
+			{
+				const SimdVector x = simdMultiply(lhs.x, rhs);
+				const SimdVector y = simdMultiply(lhs.y, rhs);
+				const SimdVector z = simdMultiply(lhs.z, rhs);
+				const SimdVector w = simdMultiply(lhs.w, rhs);
+				return { x, y, z, w };
+			}
+
+			static void simdMinimumMaximumTransform(const SimdMatrix& m, const SimdVector& minimum, const SimdVector& maximum, SimdVector result[])
+			{
+				FloatBatch m_xx_x = m.x.x * minimum.x;    m_xx_x = m_xx_x + m.w.x;
+				FloatBatch m_xy_x = m.x.y * minimum.x;    m_xy_x = m_xy_x + m.w.y;
+				FloatBatch m_xz_x = m.x.z * minimum.x;    m_xz_x = m_xz_x + m.w.z;
+				FloatBatch m_xw_x = m.x.w * minimum.x;    m_xw_x = m_xw_x + m.w.w;
+
+				FloatBatch m_xx_X = m.x.x * maximum.x;    m_xx_X = m_xx_X + m.w.x;
+				FloatBatch m_xy_X = m.x.y * maximum.x;    m_xy_X = m_xy_X + m.w.y;
+				FloatBatch m_xz_X = m.x.z * maximum.x;    m_xz_X = m_xz_X + m.w.z;
+				FloatBatch m_xw_X = m.x.w * maximum.x;    m_xw_X = m_xw_X + m.w.w;
+
+				FloatBatch m_yx_y = m.y.x * minimum.y;
+				FloatBatch m_yy_y = m.y.y * minimum.y;
+				FloatBatch m_yz_y = m.y.z * minimum.y;
+				FloatBatch m_yw_y = m.y.w * minimum.y;
+
+				FloatBatch m_yx_Y = m.y.x * maximum.y;
+				FloatBatch m_yy_Y = m.y.y * maximum.y;
+				FloatBatch m_yz_Y = m.y.z * maximum.y;
+				FloatBatch m_yw_Y = m.y.w * maximum.y;
+
+				FloatBatch m_zx_z = m.z.x * minimum.z;
+				FloatBatch m_zy_z = m.z.y * minimum.z;
+				FloatBatch m_zz_z = m.z.z * minimum.z;
+				FloatBatch m_zw_z = m.z.w * minimum.z;
+
+				FloatBatch m_zx_Z = m.z.x * maximum.z;
+				FloatBatch m_zy_Z = m.z.y * maximum.z;
+				FloatBatch m_zz_Z = m.z.z * maximum.z;
+				FloatBatch m_zw_Z = m.z.w * maximum.z;
+
+				{
+					FloatBatch xyz_x = m_xx_x + m_yx_y;   xyz_x = xyz_x + m_zx_z;
+					FloatBatch xyz_y = m_xy_x + m_yy_y;   xyz_y = xyz_y + m_zy_z;
+					FloatBatch xyz_z = m_xz_x + m_yz_y;   xyz_z = xyz_z + m_zz_z;
+					FloatBatch xyz_w = m_xw_x + m_yw_y;   xyz_w = xyz_w + m_zw_z;
+					result[0].x = xyz_x;
+					result[0].y = xyz_y;
+					result[0].z = xyz_z;
+					result[0].w = xyz_w;
+				}
+
+				{
+					FloatBatch Xyz_x = m_xx_X + m_yx_y;   Xyz_x = Xyz_x + m_zx_z;
+					FloatBatch Xyz_y = m_xy_X + m_yy_y;   Xyz_y = Xyz_y + m_zy_z;
+					FloatBatch Xyz_z = m_xz_X + m_yz_y;   Xyz_z = Xyz_z + m_zz_z;
+					FloatBatch Xyz_w = m_xw_X + m_yw_y;   Xyz_w = Xyz_w + m_zw_z;
+					result[1].x = Xyz_x;
+					result[1].y = Xyz_y;
+					result[1].z = Xyz_z;
+					result[1].w = Xyz_w;
+				}
+
+				{
+					FloatBatch xYz_x = m_xx_x + m_yx_Y;   xYz_x = xYz_x + m_zx_z;
+					FloatBatch xYz_y = m_xy_x + m_yy_Y;   xYz_y = xYz_y + m_zy_z;
+					FloatBatch xYz_z = m_xz_x + m_yz_Y;   xYz_z = xYz_z + m_zz_z;
+					FloatBatch xYz_w = m_xw_x + m_yw_Y;   xYz_w = xYz_w + m_zw_z;
+					result[2].x = xYz_x;
+					result[2].y = xYz_y;
+					result[2].z = xYz_z;
+					result[2].w = xYz_w;
+				}
+
+				{
+					FloatBatch XYz_x = m_xx_X + m_yx_Y;   XYz_x = XYz_x + m_zx_z;
+					FloatBatch XYz_y = m_xy_X + m_yy_Y;   XYz_y = XYz_y + m_zy_z;
+					FloatBatch XYz_z = m_xz_X + m_yz_Y;   XYz_z = XYz_z + m_zz_z;
+					FloatBatch XYz_w = m_xw_X + m_yw_Y;   XYz_w = XYz_w + m_zw_z;
+					result[3].x = XYz_x;
+					result[3].y = XYz_y;
+					result[3].z = XYz_z;
+					result[3].w = XYz_w;
+				}
+
+				{
+					FloatBatch xyZ_x = m_xx_x + m_yx_y;   xyZ_x = xyZ_x + m_zx_Z;
+					FloatBatch xyZ_y = m_xy_x + m_yy_y;   xyZ_y = xyZ_y + m_zy_Z;
+					FloatBatch xyZ_z = m_xz_x + m_yz_y;   xyZ_z = xyZ_z + m_zz_Z;
+					FloatBatch xyZ_w = m_xw_x + m_yw_y;   xyZ_w = xyZ_w + m_zw_Z;
+					result[4].x = xyZ_x;
+					result[4].y = xyZ_y;
+					result[4].z = xyZ_z;
+					result[4].w = xyZ_w;
+				}
+
+				{
+					FloatBatch XyZ_x = m_xx_X + m_yx_y;   XyZ_x = XyZ_x + m_zx_Z;
+					FloatBatch XyZ_y = m_xy_X + m_yy_y;   XyZ_y = XyZ_y + m_zy_Z;
+					FloatBatch XyZ_z = m_xz_X + m_yz_y;   XyZ_z = XyZ_z + m_zz_Z;
+					FloatBatch XyZ_w = m_xw_X + m_yw_y;   XyZ_w = XyZ_w + m_zw_Z;
+					result[5].x = XyZ_x;
+					result[5].y = XyZ_y;
+					result[5].z = XyZ_z;
+					result[5].w = XyZ_w;
+				}
+
+				{
+					FloatBatch xYZ_x = m_xx_x + m_yx_Y;   xYZ_x = xYZ_x + m_zx_Z;
+					FloatBatch xYZ_y = m_xy_x + m_yy_Y;   xYZ_y = xYZ_y + m_zy_Z;
+					FloatBatch xYZ_z = m_xz_x + m_yz_Y;   xYZ_z = xYZ_z + m_zz_Z;
+					FloatBatch xYZ_w = m_xw_x + m_yw_Y;   xYZ_w = xYZ_w + m_zw_Z;
+					result[6].x = xYZ_x;
+					result[6].y = xYZ_y;
+					result[6].z = xYZ_z;
+					result[6].w = xYZ_w;
+				}
+
+				{
+					FloatBatch XYZ_x = m_xx_X + m_yx_Y;   XYZ_x = XYZ_x + m_zx_Z;
+					FloatBatch XYZ_y = m_xy_X + m_yy_Y;   XYZ_y = XYZ_y + m_zy_Z;
+					FloatBatch XYZ_z = m_xz_X + m_yz_Y;   XYZ_z = XYZ_z + m_zz_Z;
+					FloatBatch XYZ_w = m_xw_X + m_yw_Y;   XYZ_w = XYZ_w + m_zw_Z;
+					result[7].x = XYZ_x;
+					result[7].y = XYZ_y;
+					result[7].z = XYZ_z;
+					result[7].w = XYZ_w;
+				}
+			}
+
+
+			//[-------------------------------------------------------]
+			//[ Public static kernel methods                          ]
+			//[-------------------------------------------------------]
+			static void sphereCulling(const Renderer::SceneCullingSphereData& sphereData, uint32_t startIndex, uint32_t endIndex)
+			{
+				// Get pointers to the necessary members of the object set
+				const float* RESTRICT spherePositionXData = sphereData.spherePositionX;
+				const float* RESTRICT spherePositionYData = sphereData.spherePositionY;
+				const float* RESTRICT spherePositionZData = sphereData.spherePositionZ;
+				const float* RESTRICT negativeRadiusData = sphereData.negativeRadius;
+				uint32_t* RESTRICT visibilityFlag = sphereData.visibilityFlag;
+
+				// Splat out the camera position and the planes to be able to do plane-sphere test with SIMD
+				const FloatBatch worldSpaceCameraPosition[3] = { FloatBatch(sphereData.worldSpaceCameraPosition[0]), FloatBatch(sphereData.worldSpaceCameraPosition[1]), FloatBatch(sphereData.worldSpaceCameraPosition[2]) };
+				SimdPlane planes[6];
+				for (uint32_t p = 0; p < 6; ++p)
+				{
+					planes[p] = { FloatBatch(sphereData.planes[p][0]), FloatBatch(sphereData.planes[p][1]), FloatBatch(sphereData.planes[p][2]), FloatBatch(sphereData.planes[p][3]) };
+				}
+
+				// Test each plane of the frustum against each sphere
+				for (uint32_t sceneItemIndex = startIndex; sceneItemIndex < endIndex; sceneItemIndex += SIMD_LANE_COUNT)
+				{
+					#if defined(XSIMD_X86_INSTR_SET_AVAILABLE)
+					{ // Prefetch data for the next loop iteration in order to try to hide memory latency
+						// TODO(co) Optimization: This has been added without profiling. As soon as there's enough data do profiling here.
+						const uint32_t nextIndex = sceneItemIndex + SIMD_LANE_COUNT;
+						xsimd::prefetch(&spherePositionXData[nextIndex]);
+						xsimd::prefetch(&spherePositionYData[nextIndex]);
+						xsimd::prefetch(&spherePositionZData[nextIndex]);
+						xsimd::prefetch(&negativeRadiusData[nextIndex]);
+						xsimd::prefetch(&visibilityFlag[nextIndex]);
+					}
+					#endif
+
+					// Get camera relative world space center position of bounding sphere
+					// -> After this step we no longer need a 64 bit world space position and a 32 bit world space position is sufficient for the rest of the calculations
+					const FloatBatch spherePositionX = load(&spherePositionXData[sceneItemIndex]) - worldSpaceCameraPosition[0];
+					const FloatBatch spherePositionY = load(&spherePositionYData[sceneItemIndex]) - worldSpaceCameraPosition[1];
+					const FloatBatch spherePositionZ = load(&spherePositionZData[sceneItemIndex]) - worldSpaceCameraPosition[2];
+
+					// Get negative world space radius of bounding sphere
+					const FloatBatch negativeRadius = load(&negativeRadiusData[sceneItemIndex]);
+
+					BoolBatch inside(true);
+					for (uint32_t p = 0; p < 6; ++p)
+					{
+						const FloatBatch& RESTRICT n_x = planes[p].normalX;
+						const FloatBatch& RESTRICT n_y = planes[p].normalY;
+						const FloatBatch& RESTRICT n_z = planes[p].normalZ;
+						const FloatBatch n_dot_pos = (spherePositionX * n_x) + (spherePositionY * n_y) + (spherePositionZ * n_z);
+
+						// "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html is using the following
+						// FloatBatch planeTestPoint = n_dot_pos + radius;
+						// BoolBatch planeTest = (planeTestPoint >= planes[p].d);
+
+						// "Frustum Culling" by Dion Picco - http://www.flipcode.com/archives/Frustum_Culling.shtml worked TODO(co) Figure out the difference
+						const FloatBatch planeTestPoint = n_dot_pos + planes[p].d;
+						const BoolBatch planeTest = (planeTestPoint > negativeRadius);
+
+						inside = (planeTest & inside);
+					}
+
+					// Store 0 for spheres that didn't intersect or ended up on the positive side of the frustum planes
+					// -> Store 0xffffffff for spheres that are visible
+					storeVisibilityFlag(inside, &visibilityFlag[sceneItemIndex]);
+				}
+			}
+
+			static void oobbCulling(const Renderer::SceneCullingOobbData& oobbData, uint32_t startIndex, uint32_t endIndex)
+			{
+				// Get pointers to the necessary members of the object set
+
+				// Get minimum object space bounding box corner position
+				const float* RESTRICT minimumX = oobbData.minimumX;
+				const float* RESTRICT minimumY = oobbData.minimumY;
+				const float* RESTRICT minimumZ = oobbData.minimumZ;
+
+				// Get maximum object space bounding box corner position
+				const float* RESTRICT maximumX = oobbData.maximumX;
+				const float* RESTRICT maximumY = oobbData.maximumY;
+				const float* RESTRICT maximumZ = oobbData.maximumZ;
+
+				// TODO(co) Add camera relative rendering and 64 bit world space position support
+				// Get object space to world space matrix
+				const float* RESTRICT worldXX = oobbData.world[0][0];
+				const float* RESTRICT worldXY = oobbData.world[0][1];
+				const float* RESTRICT worldXZ = oobbData.world[0][2];
+				const float* RESTRICT worldXW = oobbData.world[0][3];
+				const float* RESTRICT worldYX = oobbData.world[1][0];
+				const float* RESTRICT worldYY = oobbData.world[1][1];
+				const float* RESTRICT worldYZ = oobbData.world[1][2];
+				const float* RESTRICT worldYW = oobbData.world[1][3];
+				const float* RESTRICT worldZX = oobbData.world[2][0];
+				const float* RESTRICT worldZY = oobbData.world[2][1];
+				const float* RESTRICT worldZZ = oobbData.world[2][2];
+				const float* RESTRICT worldZW = oobbData.world[2][3];
+				const float* RESTRICT worldWX = oobbData.world[3][0];
+				const float* RESTRICT worldWY = oobbData.world[3][1];
+				const float* RESTRICT worldWZ = oobbData.world[3][2];
+				const float* RESTRICT worldWW = oobbData.world[3][3];
+
+				const uint32_t* RESTRICT indirection = oobbData.indirection;
+				uint32_t* RESTRICT visibilityFlag = oobbData.visibilityFlag;
+
+				// Splat out the view space to clip space matrix
+				SimdMatrix viewSpaceToClipSpaceMatrix;
+				{
+					SimdVector* viewSpaceToClipSpaceMatrixVectors[4] = { &viewSpaceToClipSpaceMatrix.x, &viewSpaceToClipSpaceMatrix.y, &viewSpaceToClipSpaceMatrix.z, &viewSpaceToClipSpaceMatrix.w };
+					for (uint32_t i = 0; i < 4; ++i)
+					{
+						const float* column = oobbData.viewSpaceToClipSpaceMatrix[i];
+						*viewSpaceToClipSpaceMatrixVectors[i] = { FloatBatch(column[0]), FloatBatch(column[1]), FloatBatch(column[2]), FloatBatch(column[3]) };
+					}
+				}
+				const FloatBatch zero(0.0f);
+				const FloatBatch one(1.0f);
+				const BoolBatch allTrue(true);
+				const BoolBatch allFalse(false);
+
+				for (uint32_t sceneItemIndex = startIndex; sceneItemIndex < endIndex; sceneItemIndex += SIMD_LANE_COUNT)
+				{
+					// Scene item indices of this SIMD batch
+					const uint32_t* RESTRICT batchIndirection = &indirection[sceneItemIndex];
+
+					#if defined(XSIMD_X86_INSTR_SET_AVAILABLE)
+					{ // Prefetch data for the next loop iteration in order to try to hide memory latency
+						// TODO(co) Optimization: This has been added without profiling. As soon as there's enough data do profiling here.
+						const uint32_t nextIndirectionIndex = sceneItemIndex + SIMD_LANE_COUNT;
+						for (uint32_t componentIndex = 0; componentIndex < SIMD_LANE_COUNT; ++componentIndex)
+						{
+							const uint32_t nextIndex = indirection[nextIndirectionIndex + componentIndex];
+
+							// Minimum object space bounding box corner position
+							xsimd::prefetch(&minimumX[nextIndex]);
+							xsimd::prefetch(&minimumY[nextIndex]);
+							xsimd::prefetch(&minimumZ[nextIndex]);
+
+							// Maximum object space bounding box corner position
+							xsimd::prefetch(&maximumX[nextIndex]);
+							xsimd::prefetch(&maximumY[nextIndex]);
+							xsimd::prefetch(&maximumZ[nextIndex]);
+
+							// Object space to world space matrix
+							xsimd::prefetch(&worldXX[nextIndex]);
+							xsimd::prefetch(&worldXY[nextIndex]);
+							xsimd::prefetch(&worldXZ[nextIndex]);
+							xsimd::prefetch(&worldXW[nextIndex]);
+							xsimd::prefetch(&worldYX[nextIndex]);
+							xsimd::prefetch(&worldYY[nextIndex]);
+							xsimd::prefetch(&worldYZ[nextIndex]);
+							xsimd::prefetch(&worldYW[nextIndex]);
+							xsimd::prefetch(&worldZX[nextIndex]);
+							xsimd::prefetch(&worldZY[nextIndex]);
+							xsimd::prefetch(&worldZZ[nextIndex]);
+							xsimd::prefetch(&worldZW[nextIndex]);
+							xsimd::prefetch(&worldWX[nextIndex]);
+							xsimd::prefetch(&worldWY[nextIndex]);
+							xsimd::prefetch(&worldWZ[nextIndex]);
+							xsimd::prefetch(&worldWW[nextIndex]);
+
+							// Visibility flag
+							xsimd::prefetch(&visibilityFlag[nextIndex]);
+						}
+					}
+					#endif
+
+					// Load the world transform matrix for "SIMD_LANE_COUNT" objects via the indirection table
+					SimdMatrix world;
+					world.x.x = gather(worldXX, batchIndirection);
+					world.x.y = gather(worldXY, batchIndirection);
+					world.x.z = gather(worldXZ, batchIndirection);
+					world.x.w = gather(worldXW, batchIndirection);
+
+					world.y.x = gather(worldYX, batchIndirection);
+					world.y.y = gather(worldYY, batchIndirection);
+					world.y.z = gather(worldYZ, batchIndirection);
+					world.y.w = gather(worldYW, batchIndirection);
+
+					world.z.x = gather(worldZX, batchIndirection);
+					world.z.y = gather(worldZY, batchIndirection);
+					world.z.z = gather(worldZZ, batchIndirection);
+					world.z.w = gather(worldZW, batchIndirection);
+
+					world.w.x = gather(worldWX, batchIndirection);
+					world.w.y = gather(worldWY, batchIndirection);
+					world.w.z = gather(worldWZ, batchIndirection);
+					world.w.w = gather(worldWW, batchIndirection);
+
+					// Create the matrix to go from object->world->view->clip space
+					const SimdMatrix clip = simdMultiply(viewSpaceToClipSpaceMatrix, world);
+
+					// Load the minimum and maximum corner positions of the bounding box in object space
+					SimdVector minimumPosition;
+					minimumPosition.x = gather(minimumX, batchIndirection);
+					minimumPosition.y = gather(minimumY, batchIndirection);
+					minimumPosition.z = gather(minimumZ, batchIndirection);
+					minimumPosition.w = one;
+
+					SimdVector maximumPosition;
+					maximumPosition.x = gather(maximumX, batchIndirection);
+					maximumPosition.y = gather(maximumY, batchIndirection);
+					maximumPosition.z = gather(maximumZ, batchIndirection);
+					maximumPosition.w = one;
+
+					// Transform each bounding box corner from object to clip space by sharing calculations
+					SimdVector clipPosition[8];
+					simdMinimumMaximumTransform(clip, minimumPosition, maximumPosition, clipPosition);
+
+					// Initialize test conditions
+					BoolBatch allXLess = allTrue;
+					BoolBatch allXGreater = allTrue;
+					BoolBatch allYLess = allTrue;
+					BoolBatch allYGreater = allTrue;
+					BoolBatch allZLess = allTrue;
+					BoolBatch anyZLess = allFalse;
+					BoolBatch allZGreater = allTrue;
+
+					// Test each corner of the OOBB and if any corner intersects the frustum that object is visible
+					for (uint32_t cs = 0; cs < 8; ++cs)
+					{
+						const FloatBatch neg_cs_w = -clipPosition[cs].w;
+
+						const BoolBatch x_le = (clipPosition[cs].x <= neg_cs_w);
+						const BoolBatch x_ge = (clipPosition[cs].x >= clipPosition[cs].w);
+						allXLess = (x_le & allXLess);
+						allXGreater = (x_ge & allXGreater);
+
+						const BoolBatch y_le = (clipPosition[cs].y <= neg_cs_w);
+						const BoolBatch y_ge = (clipPosition[cs].y >= clipPosition[cs].w);
+						allYLess = (y_le & allYLess);
+						allYGreater = (y_ge & allYGreater);
+
+						const BoolBatch z_le = (clipPosition[cs].z <= zero);
+						const BoolBatch z_ge = (clipPosition[cs].z >= clipPosition[cs].w);
+						allZLess = (z_le & allZLess);
+						allZGreater = (z_ge & allZGreater);
+						anyZLess = (z_le | anyZLess);
+					}
+
+					const BoolBatch anyXOutside = (allXLess | allXGreater);
+					const BoolBatch anyYOutside = (allYLess | allYGreater);
+					const BoolBatch anyZOutside = (allZLess | allZGreater);
+					BoolBatch outside = (anyXOutside | anyYOutside);
+					outside = (outside | anyZOutside);
+					const BoolBatch inside = (outside ^ allTrue);
+
+					// Store the result in the "visibilityFlag"-array in a compacted way
+					storeVisibilityFlag(inside, &visibilityFlag[sceneItemIndex]);
+				}
+			}
+
+			static void contributionCulling(const Renderer::SceneCullingContributionData& contributionData, uint32_t startIndex, uint32_t endIndex)
+			{
+				// Get pointers to the necessary members of the object set
+				const float* RESTRICT spherePositionXData = contributionData.spherePositionX;
+				const float* RESTRICT spherePositionYData = contributionData.spherePositionY;
+				const float* RESTRICT spherePositionZData = contributionData.spherePositionZ;
+				const float* RESTRICT negativeRadiusData = contributionData.negativeRadius;
+				const uint32_t* RESTRICT indirection = contributionData.indirection;
+				float* RESTRICT projectedRadiusData = contributionData.projectedRadius;
+				uint32_t* RESTRICT visibilityFlag = contributionData.visibilityFlag;
+
+				// Splat out the camera position, the clip space w row and the projection parameters
+				const FloatBatch worldSpaceCameraPosition[3] = { FloatBatch(contributionData.worldSpaceCameraPosition[0]), FloatBatch(contributionData.worldSpaceCameraPosition[1]), FloatBatch(contributionData.worldSpaceCameraPosition[2]) };
+				const FloatBatch clipSpaceW[4] = { FloatBatch(contributionData.clipSpaceW[0]), FloatBatch(contributionData.clipSpaceW[1]), FloatBatch(contributionData.clipSpaceW[2]), FloatBatch(contributionData.clipSpaceW[3]) };
+				const FloatBatch projectionScale(contributionData.projectionScale);
+				const FloatBatch minimumProjectedRadius(contributionData.minimumProjectedRadius);
+				const FloatBatch maximumProjectedRadius(FLT_MAX);
+				const FloatBatch zero(0.0f);
+
+				for (uint32_t sceneItemIndex = startIndex; sceneItemIndex < endIndex; sceneItemIndex += SIMD_LANE_COUNT)
+				{
+					// Scene item indices of this SIMD batch
+					const uint32_t* RESTRICT batchIndirection = &indirection[sceneItemIndex];
+
+					// Get camera relative world space center position of bounding sphere
+					const FloatBatch spherePositionX = gather(spherePositionXData, batchIndirection) - worldSpaceCameraPosition[0];
+					const FloatBatch spherePositionY = gather(spherePositionYData, batchIndirection) - worldSpaceCameraPosition[1];
+					const FloatBatch spherePositionZ = gather(spherePositionZData, batchIndirection) - worldSpaceCameraPosition[2];
+					const FloatBatch radius = zero - gather(negativeRadiusData, batchIndirection);
+
+					// Project the radius using the clip space w, bounding spheres with a center at or behind the camera plane are considered to cover the whole screen
+					const FloatBatch w = (spherePositionX * clipSpaceW[0]) + (spherePositionY * clipSpaceW[1]) + (spherePositionZ * clipSpaceW[2]) + clipSpaceW[3];
+					const BoolBatch inFront = (w > zero);
+					const FloatBatch projectedRadius = xsimd::select(inFront, (radius * projectionScale) / xsimd::select(inFront, w, projectionScale), maximumProjectedRadius);
+					projectedRadius.store_aligned(&projectedRadiusData[sceneItemIndex]);
+
+					// Store 0 for scene items which are too small to contribute and 0xffffffff for scene items that are visible, in a compacted way
+					storeVisibilityFlag(projectedRadius >= minimumProjectedRadius, &visibilityFlag[sceneItemIndex]);
+				}
+			}
+
+
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
@@ -0,0 +1,44 @@
+// No precompiled header by intent, see "SceneCullingKernels.inl"
+
+// AVX2 scene culling kernels, this translation unit is compiled with "/arch:AVX2" and only called if the CPU supports AVX2
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_AVX2_VERSION
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.inl"
+#else
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	const SceneCullingKernels* SceneCullingKernels::getAvx2()
+	{
+		#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			typedef ::detail::SceneCullingKernelsImpl<xsimd::batch<float, 8>> SceneCullingKernelsImpl;
+			static constexpr SceneCullingKernels SCENE_CULLING_KERNELS =
+			{
+				"AVX2",
+				SceneCullingKernelsImpl::SIMD_LANE_COUNT,
+				&SceneCullingKernelsImpl::sphereCulling,
+				&SceneCullingKernelsImpl::oobbCulling,
+				&SceneCullingKernelsImpl::contributionCulling
+			};
+			return &SCENE_CULLING_KERNELS;
+		#else
+			return nullptr;
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,44 @@
+// No precompiled header by intent, see "SceneCullingKernels.inl"
+
+// AVX-512 scene culling kernels, this translation unit is compiled with "/arch:AVX512" and only called if the CPU supports AVX-512F
+#if defined(_M_X64) || defined(__x86_64__)
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_AVX512_VERSION
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.inl"
+#else
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	const SceneCullingKernels* SceneCullingKernels::getAvx512()
+	{
+		#if defined(_M_X64) || defined(__x86_64__)
+			typedef ::detail::SceneCullingKernelsImpl<xsimd::batch<float, 16>> SceneCullingKernelsImpl;
+			static constexpr SceneCullingKernels SCENE_CULLING_KERNELS =
+			{
+				"AVX-512",
+				SceneCullingKernelsImpl::SIMD_LANE_COUNT,
+				&SceneCullingKernelsImpl::sphereCulling,
+				&SceneCullingKernelsImpl::oobbCulling,
+				&SceneCullingKernelsImpl::contributionCulling
+			};
+			return &SCENE_CULLING_KERNELS;
+		#else
+			return nullptr;
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
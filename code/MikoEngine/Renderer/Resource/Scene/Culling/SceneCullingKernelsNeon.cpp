@@ -0,0 +1,44 @@
+#include "stdafx.h"
+
+// NEON scene culling kernels, NEON is part of the 64 bit ARM baseline
+#if defined(_M_ARM64) || defined(__aarch64__)
+	#define XSIMD_FORCE_ARM_INSTR_SET XSIMD_ARM8_64_NEON_VERSION
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.inl"
+#else
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	const SceneCullingKernels* SceneCullingKernels::getNeon()
+	{
+		#if defined(_M_ARM64) || defined(__aarch64__)
+			typedef ::detail::SceneCullingKernelsImpl<xsimd::batch<float, 4>> SceneCullingKernelsImpl;
+			static constexpr SceneCullingKernels SCENE_CULLING_KERNELS =
+			{
+				"NEON",
+				SceneCullingKernelsImpl::SIMD_LANE_COUNT,
+				&SceneCullingKernelsImpl::sphereCulling,
+				&SceneCullingKernelsImpl::oobbCulling,
+				&SceneCullingKernelsImpl::contributionCulling
+			};
+			return &SCENE_CULLING_KERNELS;
+		#else
+			return nullptr;
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,44 @@
+#include "stdafx.h"
+
+// SSE4.2 scene culling kernels, reference implementation and fallback for x86 CPUs without AVX2 support
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.inl"
+#else
+	#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#endif
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	const SceneCullingKernels* SceneCullingKernels::getSse42()
+	{
+		#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+			typedef ::detail::SceneCullingKernelsImpl<xsimd::batch<float, 4>> SceneCullingKernelsImpl;
+			static constexpr SceneCullingKernels SCENE_CULLING_KERNELS =
+			{
+				"SSE4.2",
+				SceneCullingKernelsImpl::SIMD_LANE_COUNT,
+				&SceneCullingKernelsImpl::sphereCulling,
+				&SceneCullingKernelsImpl::oobbCulling,
+				&SceneCullingKernelsImpl::contributionCulling
+			};
+			return &SCENE_CULLING_KERNELS;
+		#else
+			return nullptr;
+		#endif
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -1,17 +1,28 @@
 #include "stdafx.h"
 #include "Renderer/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#include "Renderer/Resource/Scene/Culling/SceneItemBvh.h"
 #include "Renderer/Resource/Scene/Item/Camera/CameraSceneItem.h"
+#include "Renderer/Resource/Scene/Item/Mesh/MeshSceneItem.h"
+#include "Renderer/Resource/Scene/Item/Mesh/SkeletonMeshSceneItem.h"
 #include "Renderer/Resource/Scene/SceneNode.h"
+#include "Renderer/Resource/Mesh/MeshResourceManager.h"
+#include "Renderer/Resource/Mesh/MeshResource.h"
 #include "Renderer/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "Renderer/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/RenderQueue/RenderableManager.h"
-#include "Renderer/Core/Thread/ThreadPool.h"
+#include "Renderer/Core/Thread/JobSystem.h"
 #include "Math/Math.h"
 #include "Math/Frustum.h"
 #include "Renderer/IRenderer.h"
 #include "Renderer/Context.h"
-#include <xsimd/xsimd.hpp>
+
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtx/component_wise.hpp>
+SE_PRAGMA_WARNING_POP
 
 
 //[-------------------------------------------------------]
@@ -26,55 +37,50 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static constexpr size_t SCENE_ITEMS_SPLIT_COUNT = 256;	// Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
-		typedef xsimd::batch_bool<float, 4> bool4;
-		typedef xsimd::simd_type<float> float4;
-		static const float4 FLOAT4_ALL_ZERO(0.0f);
-		static const bool4 BOOL4_ALL_FALSE(false);
-		static const bool4 BOOL4_ALL_TRUE(true);
-		struct SimdPlane final
-		{
-			float4 normalX;	// The normal's x value replicated 4 times
-			float4 normalY;	// The normal's y value replicated 4 times
-			float4 normalZ;	// etc.
-			float4 d;
-		};
-		struct SimdVector final
-		{
-			float4 x;	// Stores x0, x1, x2, x3
-			float4 y;	// Stores y0, y1, y2, y3
-			float4 z;	// etc.
-			float4 w;
-		};
-		struct SimdMatrix final
-		{
-			SimdVector x;
-			SimdVector y;
-			SimdVector z;
-			SimdVector w;
-		};
+		static constexpr uint32_t MINIMUM_SCENE_ITEMS_SPLIT_COUNT = 256;	// Minimum package size for each job to work on, the job system adapts the package size to the number of items and threads
 
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		[[nodiscard]] uint32_t alignToSimdLaneCount(uint32_t value)
+		void setSphereData(const glm::vec3& worldSpaceCameraPosition, const Frustum& frustum, Renderer::SceneCullingSphereData& sphereData)
+		{
+			sphereData.worldSpaceCameraPosition[0] = worldSpaceCameraPosition.x;
+			sphereData.worldSpaceCameraPosition[1] = worldSpaceCameraPosition.y;
+			sphereData.worldSpaceCameraPosition[2] = worldSpaceCameraPosition.z;
+			for (uint32_t p = 0; p < Frustum::NUMBER_OF_PLANES; ++p)
+			{
+				const Plane& plane = frustum.planes[p];
+				sphereData.planes[p][0] = plane.normal.x;
+				sphereData.planes[p][1] = plane.normal.y;
+				sphereData.planes[p][2] = plane.normal.z;
+				sphereData.planes[p][3] = plane.d;
+			}
+		}
+
+		void padIndirection(uint32_t* outputIndirection, uint32_t numberOfVisibleItems, uint32_t simdLaneCount)
 		{
-			return Math::makeMultipleOf(value, xsimd::simd_type<float>::size);
+			// Pad out to the SIMD alignment
+			const uint32_t numberOfVisibleItemsAligned = Math::makeMultipleOf(numberOfVisibleItems, simdLaneCount);
+			const uint32_t lastVisibleItem = numberOfVisibleItems ? outputIndirection[numberOfVisibleItems - 1] : 0;
+			for (uint32_t i = numberOfVisibleItems; i < numberOfVisibleItemsAligned; ++i)
+			{
+				outputIndirection[i] = lastVisibleItem;
+			}
 		}
 
-		[[nodiscard]] uint32_t removeNotVisible(const Renderer::SceneItemSet& sceneItemSet, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection)
+		[[nodiscard]] uint32_t removeNotVisible(const Renderer::SceneItemSet& sceneItemSet, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection, uint32_t simdLaneCount)
 		{
 			const uint32_t* RESTRICT visibilityFlag = sceneItemSet.visibilityFlag.data();
 			uint32_t numberOfVisibleItems = 0u;
 			if (nullptr != inputIndirection)
 			{
+				// The visibility flags are compacted, meaning indexed by indirection index
 				for (uint32_t i = 0; i < count; ++i)
 				{
-					const uint32_t index = inputIndirection[i];
-					if (visibilityFlag[index])
+					if (visibilityFlag[i])
 					{
-						outputIndirection[numberOfVisibleItems] = index;
+						outputIndirection[numberOfVisibleItems] = inputIndirection[i];
 						++numberOfVisibleItems;
 					}
 				}
@@ -91,158 +97,103 @@ namespace
 				}
 			}
 
-			// Pad out to the SIMD alignment
-			const uint32_t numberOfVisibleItemsAligned = alignToSimdLaneCount(numberOfVisibleItems);
-			const uint32_t lastVisibleItem = numberOfVisibleItems ? outputIndirection[numberOfVisibleItems - 1] : 0;
-			for (uint32_t i = numberOfVisibleItems; i < numberOfVisibleItemsAligned; ++i)
-			{
-				outputIndirection[i] = lastVisibleItem;
-			}
+			padIndirection(outputIndirection, numberOfVisibleItems, simdLaneCount);
 
 			return numberOfVisibleItems;
 		}
 
-		[[nodiscard]] SimdVector simdMultiply(const SimdVector& v, const SimdMatrix& m)
-		{
-			float4 x = v.x * m.x.x;     x = v.y * m.y.x + x;    x = v.z * m.z.x + x;    x = v.w * m.w.x + x;
-			float4 y = v.x * m.x.y;     y = v.y * m.y.y + y;    y = v.z * m.z.y + y;    y = v.w * m.w.y + y;
-			float4 z = v.x * m.x.z;     z = v.y * m.y.z + z;    z = v.z * m.z.z + z;    z = v.w * m.w.z + z;
-			float4 w = v.x * m.x.w;     w = v.y * m.y.w + w;    w = v.z * m.z.w + w;    w = v.w * m.w.w + w;
-			return { x, y, z, w };
-		}
-
-		[[nodiscard]] SimdMatrix simdMultiply(const SimdMatrix& lhs, const SimdMatrix& rhs)
-		{
-			const SimdVector x = simdMultiply(lhs.x, rhs);
-			const SimdVector y = simdMultiply(lhs.y, rhs);
-			const SimdVector z = simdMultiply(lhs.z, rhs);
-			const SimdVector w = simdMultiply(lhs.w, rhs);
-			return { x, y, z, w };
-		}
-
-		void simdMinimumMaximumTransform(const SimdMatrix& m, const SimdVector& minimum, const SimdVector& maximum, SimdVector result[])
+		void updateSceneItemWorldSpaceData(const Renderer::MeshResourceManager& meshResourceManager, const Renderer::ISceneItem& sceneItem, Renderer::SceneItemSet& sceneItemSet, uint32_t sceneItemSetIndex)
 		{
-			float4 m_xx_x = m.x.x * minimum.x;    m_xx_x = m_xx_x + m.w.x;
-			float4 m_xy_x = m.x.y * minimum.x;    m_xy_x = m_xy_x + m.w.y;
-			float4 m_xz_x = m.x.z * minimum.x;    m_xz_x = m_xz_x + m.w.z;
-			float4 m_xw_x = m.x.w * minimum.x;    m_xw_x = m_xw_x + m.w.w;
-
-			float4 m_xx_X = m.x.x * maximum.x;    m_xx_X = m_xx_X + m.w.x;
-			float4 m_xy_X = m.x.y * maximum.x;    m_xy_X = m_xy_X + m.w.y;
-			float4 m_xz_X = m.x.z * maximum.x;    m_xz_X = m_xz_X + m.w.z;
-			float4 m_xw_X = m.x.w * maximum.x;    m_xw_X = m_xw_X + m.w.w;
-
-			float4 m_yx_y = m.y.x * minimum.y;
-			float4 m_yy_y = m.y.y * minimum.y;
-			float4 m_yz_y = m.y.z * minimum.y;
-			float4 m_yw_y = m.y.w * minimum.y;
-
-			float4 m_yx_Y = m.y.x * maximum.y;
-			float4 m_yy_Y = m.y.y * maximum.y;
-			float4 m_yz_Y = m.y.z * maximum.y;
-			float4 m_yw_Y = m.y.w * maximum.y;
-
-			float4 m_zx_z = m.z.x * minimum.z;
-			float4 m_zy_z = m.z.y * minimum.z;
-			float4 m_zz_z = m.z.z * minimum.z;
-			float4 m_zw_z = m.z.w * minimum.z;
-
-			float4 m_zx_Z = m.z.x * maximum.z;
-			float4 m_zy_Z = m.z.y * maximum.z;
-			float4 m_zz_Z = m.z.z * maximum.z;
-			float4 m_zw_Z = m.z.w * maximum.z;
-
-			{
-				float4 xyz_x = m_xx_x + m_yx_y;   xyz_x = xyz_x + m_zx_z;
-				float4 xyz_y = m_xy_x + m_yy_y;   xyz_y = xyz_y + m_zy_z;
-				float4 xyz_z = m_xz_x + m_yz_y;   xyz_z = xyz_z + m_zz_z;
-				float4 xyz_w = m_xw_x + m_yw_y;   xyz_w = xyz_w + m_zw_z;
-				result[0].x = xyz_x;
-				result[0].y = xyz_y;
-				result[0].z = xyz_z;
-				result[0].w = xyz_w;
-			}
-
-			{
-				float4 Xyz_x = m_xx_X + m_yx_y;   Xyz_x = Xyz_x + m_zx_z;
-				float4 Xyz_y = m_xy_X + m_yy_y;   Xyz_y = Xyz_y + m_zy_z;
-				float4 Xyz_z = m_xz_X + m_yz_y;   Xyz_z = Xyz_z + m_zz_z;
-				float4 Xyz_w = m_xw_X + m_yw_y;   Xyz_w = Xyz_w + m_zw_z;
-				result[1].x = Xyz_x;
-				result[1].y = Xyz_y;
-				result[1].z = Xyz_z;
-				result[1].w = Xyz_w;
-			}
-
-			{
-				float4 xYz_x = m_xx_x + m_yx_Y;   xYz_x = xYz_x + m_zx_z;
-				float4 xYz_y = m_xy_x + m_yy_Y;   xYz_y = xYz_y + m_zy_z;
-				float4 xYz_z = m_xz_x + m_yz_Y;   xYz_z = xYz_z + m_zz_z;
-				float4 xYz_w = m_xw_x + m_yw_Y;   xYz_w = xYz_w + m_zw_z;
-				result[2].x = xYz_x;
-				result[2].y = xYz_y;
-				result[2].z = xYz_z;
-				result[2].w = xYz_w;
+			// Scene items without a parent scene node are in world space already, their bounds are the object space bounds
+			const Renderer::SceneNode* parentSceneNode = sceneItem.getParentSceneNode();
+			const Transform& globalTransform = (nullptr != parentSceneNode) ? parentSceneNode->getGlobalTransform() : Transform::IDENTITY;
+
+			{ // Set object space to world space matrix
+				glm::mat4 objectSpaceToWorldSpace;
+				globalTransform.getAsMatrix(objectSpaceToWorldSpace);
+				sceneItemSet.worldXX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][0];
+				sceneItemSet.worldXY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][0];
+				sceneItemSet.worldXZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][0];
+				sceneItemSet.worldXW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][0];
+				sceneItemSet.worldYX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][1];
+				sceneItemSet.worldYY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][1];
+				sceneItemSet.worldYZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][1];
+				sceneItemSet.worldYW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][1];
+				sceneItemSet.worldZX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][2];
+				sceneItemSet.worldZY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][2];
+				sceneItemSet.worldZZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][2];
+				sceneItemSet.worldZW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][2];
+				sceneItemSet.worldWX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][3];
+				sceneItemSet.worldWY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][3];
+				sceneItemSet.worldWZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][3];
+				sceneItemSet.worldWW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][3];
 			}
 
+			// Set world space center position and negative world space radius of bounding sphere
+			const Renderer::MeshResource* meshResource = (sceneItem.getSceneItemTypeId() == Renderer::MeshSceneItem::TYPE_ID) ? meshResourceManager.tryGetById(static_cast<const Renderer::MeshSceneItem&>(sceneItem).getMeshResourceId()) : nullptr;
+			if (nullptr != meshResource)
 			{
-				float4 XYz_x = m_xx_X + m_yx_Y;   XYz_x = XYz_x + m_zx_z;
-				float4 XYz_y = m_xy_X + m_yy_Y;   XYz_y = XYz_y + m_zy_z;
-				float4 XYz_z = m_xz_X + m_yz_Y;   XYz_z = XYz_z + m_zz_z;
-				float4 XYz_w = m_xw_X + m_yw_Y;   XYz_w = XYz_w + m_zw_z;
-				result[3].x = XYz_x;
-				result[3].y = XYz_y;
-				result[3].z = XYz_z;
-				result[3].w = XYz_w;
+				const glm::vec3& boundingSpherePosition = meshResource->getBoundingSpherePosition();
+				const glm::dvec3& position = globalTransform.position;
+				const glm::vec3& scale = globalTransform.scale;
+				sceneItemSet.spherePositionX[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.x * scale.x + position.x);
+				sceneItemSet.spherePositionY[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.y * scale.y + position.y);
+				sceneItemSet.spherePositionZ[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.z * scale.z + position.z);
+				sceneItemSet.negativeRadius[sceneItemSetIndex] = -meshResource->getBoundingSphereRadius() * glm::compMax(scale);
 			}
-
-			{
-				float4 xyZ_x = m_xx_x + m_yx_y;   xyZ_x = xyZ_x + m_zx_Z;
-				float4 xyZ_y = m_xy_x + m_yy_y;   xyZ_y = xyZ_y + m_zy_Z;
-				float4 xyZ_z = m_xz_x + m_yz_y;   xyZ_z = xyZ_z + m_zz_Z;
-				float4 xyZ_w = m_xw_x + m_yw_y;   xyZ_w = xyZ_w + m_zw_Z;
-				result[4].x = xyZ_x;
-				result[4].y = xyZ_y;
-				result[4].z = xyZ_z;
-				result[4].w = xyZ_w;
-			}
-
+			else
 			{
-				float4 XyZ_x = m_xx_X + m_yx_y;   XyZ_x = XyZ_x + m_zx_Z;
-				float4 XyZ_y = m_xy_X + m_yy_y;   XyZ_y = XyZ_y + m_zy_Z;
-				float4 XyZ_z = m_xz_X + m_yz_y;   XyZ_z = XyZ_z + m_zz_Z;
-				float4 XyZ_w = m_xw_X + m_yw_y;   XyZ_w = XyZ_w + m_zw_Z;
-				result[5].x = XyZ_x;
-				result[5].y = XyZ_y;
-				result[5].z = XyZ_z;
-				result[5].w = XyZ_w;
+				// No mesh resource, derive the bounding sphere from the object space bounding box of the scene item
+				const glm::vec3 minimumBoundingBoxPosition(sceneItemSet.minimumX[sceneItemSetIndex], sceneItemSet.minimumY[sceneItemSetIndex], sceneItemSet.minimumZ[sceneItemSetIndex]);
+				const glm::vec3 maximumBoundingBoxPosition(sceneItemSet.maximumX[sceneItemSetIndex], sceneItemSet.maximumY[sceneItemSetIndex], sceneItemSet.maximumZ[sceneItemSetIndex]);
+				const glm::vec3 boundingSpherePosition = (minimumBoundingBoxPosition + maximumBoundingBoxPosition) * 0.5f;
+				const glm::dvec3& position = globalTransform.position;
+				const glm::vec3& scale = globalTransform.scale;
+				sceneItemSet.spherePositionX[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.x * scale.x + position.x);
+				sceneItemSet.spherePositionY[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.y * scale.y + position.y);
+				sceneItemSet.spherePositionZ[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.z * scale.z + position.z);
+				sceneItemSet.negativeRadius[sceneItemSetIndex] = -glm::length(maximumBoundingBoxPosition - minimumBoundingBoxPosition) * 0.5f * glm::compMax(scale);
 			}
+		}
 
+		void updateDirtySceneItems(const Renderer::IRenderer& renderer, Renderer::SceneItemSet& sceneItemSet, Renderer::SceneItemBvh* sceneItemBvh)
+		{
+			// Only scene items which have been added or moved since the last update are touched
+			const Renderer::MeshResourceManager& meshResourceManager = renderer.getMeshResourceManager();
+			for (uint32_t handle : sceneItemSet.getDirtyHandles())
 			{
-				float4 xYZ_x = m_xx_x + m_yx_Y;   xYZ_x = xYZ_x + m_zx_Z;
-				float4 xYZ_y = m_xy_x + m_yy_Y;   xYZ_y = xYZ_y + m_zy_Z;
-				float4 xYZ_z = m_xz_x + m_yz_Y;   xYZ_z = xYZ_z + m_zz_Z;
-				float4 xYZ_w = m_xw_x + m_yw_Y;   xYZ_w = xYZ_w + m_zw_Z;
-				result[6].x = xYZ_x;
-				result[6].y = xYZ_y;
-				result[6].z = xYZ_z;
-				result[6].w = xYZ_w;
+				// Scene items might have been removed after they were marked as dirty
+				if (sceneItemSet.isValidHandle(handle))
+				{
+					const uint32_t sceneItemSetIndex = sceneItemSet.getIndexByHandle(handle);
+					updateSceneItemWorldSpaceData(meshResourceManager, *sceneItemSet.sceneItemVector[sceneItemSetIndex], sceneItemSet, sceneItemSetIndex);
+					if (nullptr != sceneItemBvh)
+					{
+						sceneItemBvh->onSceneItemChanged(sceneItemSet, handle);
+					}
+				}
 			}
+			sceneItemSet.clearDirtyHandles();
+		}
 
+		void setMeshResourceReferenced(const Renderer::MeshResourceManager& meshResourceManager, const Renderer::ISceneItem& sceneItem)
+		{
+			// Tell the mesh resource manager the mesh is needed, also in case it was evicted and hence there are no renderables
+			const Renderer::SceneItemTypeId sceneItemTypeId = sceneItem.getSceneItemTypeId();
+			if (Renderer::MeshSceneItem::TYPE_ID == sceneItemTypeId || Renderer::SkeletonMeshSceneItem::TYPE_ID == sceneItemTypeId)
 			{
-				float4 XYZ_x = m_xx_X + m_yx_Y;   XYZ_x = XYZ_x + m_zx_Z;
-				float4 XYZ_y = m_xy_X + m_yy_Y;   XYZ_y = XYZ_y + m_zy_Z;
-				float4 XYZ_z = m_xz_X + m_yz_Y;   XYZ_z = XYZ_z + m_zz_Z;
-				float4 XYZ_w = m_xw_X + m_yw_Y;   XYZ_w = XYZ_w + m_zw_Z;
-				result[7].x = XYZ_x;
-				result[7].y = XYZ_y;
-				result[7].z = XYZ_z;
-				result[7].w = XYZ_w;
+				Renderer::MeshResource* meshResource = meshResourceManager.tryGetById(static_cast<const Renderer::MeshSceneItem&>(sceneItem).getMeshResourceId());
+				if (nullptr != meshResource)
+				{
+					meshResource->setReferenced();
+				}
 			}
 		}
 
-		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
+		FORCEINLINE bool gatherRenderQueueIndexRangesRenderableManagersBySceneItem(const Renderer::MeshResourceManager& meshResourceManager, Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, float projectedRadius, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
 		{
+			setMeshResourceReferenced(meshResourceManager, sceneItem);
+
 			Renderer::RenderableManager* renderableManager = const_cast<Renderer::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
 			if (nullptr != renderableManager && renderableManager->isVisible() && !renderableManager->getRenderables().empty())
 			{
@@ -264,6 +215,7 @@ namespace
 					// Calculate the distance to the camera
 					// -> While using a 64 bit world space position, a 32 bit distance to camera is sufficient
 					renderableManager->setCachedDistanceToCamera(static_cast<float>(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position)));
+					renderableManager->setCachedProjectedRadius(projectedRadius);
 
 					// Execute scene item on rendering?
 					if (sceneItem.getCallExecuteOnRendering())
@@ -271,239 +223,29 @@ namespace
 						SE_ASSERT(std::find(executeOnRenderingSceneItems.cbegin(), executeOnRenderingSceneItems.cend(), &sceneItem) == executeOnRenderingSceneItems.cend(), "Execute on rendering scene items contains duplicates")
 						executeOnRenderingSceneItems.push_back(&sceneItem);
 					}
+					return true;
 				}
 			}
-		}
-
 
-		//[-------------------------------------------------------]
-		//[ Global thread functions                               ]
-		//[-------------------------------------------------------]
-		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSet& sceneItemSet, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
-		{
-			// Get pointers to the necessary members of the object set
-			const float* RESTRICT spherePositionXData = sceneItemSet.spherePositionX.data();
-			const float* RESTRICT spherePositionYData = sceneItemSet.spherePositionY.data();
-			const float* RESTRICT spherePositionZData = sceneItemSet.spherePositionZ.data();
-			const float* RESTRICT negativeRadiusData = sceneItemSet.negativeRadius.data();
-
-			// Test each plane of the frustum against each sphere
-			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
-			for (size_t sceneItemIndex = threadSceneItemIndexStart; sceneItemIndex < threadSceneItemIndexEnd; sceneItemIndex += simdSize)
-			{
-				#if defined(XSIMD_X86_INSTR_SET_AVAILABLE)
-				{ // Prefetch data for the next loop iteration in order to try to hide memory latency
-					// TODO(co) Optimization: This has been added without profiling. As soon as there's enough data do profiling here.
-					const size_t nextIndex = sceneItemIndex + simdSize;
-					xsimd::prefetch(&spherePositionXData[nextIndex]);
-					xsimd::prefetch(&spherePositionYData[nextIndex]);
-					xsimd::prefetch(&spherePositionZData[nextIndex]);
-					xsimd::prefetch(&negativeRadiusData[nextIndex]);
-					xsimd::prefetch(&visibilityFlag[nextIndex]);
-				}
-				#endif
-
-				// Get camera relative world space center position of bounding sphere
-				// -> After this step we no longer need a 64 bit world space position and a 32 bit world space position is sufficient for the rest of the calculations
-				const float4 spherePositionX = xsimd::load_aligned(&spherePositionXData[sceneItemIndex]) - worldSpaceCameraPosition[0];
-				const float4 spherePositionY = xsimd::load_aligned(&spherePositionYData[sceneItemIndex]) - worldSpaceCameraPosition[1];
-				const float4 spherePositionZ = xsimd::load_aligned(&spherePositionZData[sceneItemIndex]) - worldSpaceCameraPosition[2];
-
-				// Get negative world space radius of bounding sphere
-				const float4 negativeRadius = xsimd::load_aligned(&negativeRadiusData[sceneItemIndex]);
-
-				bool4 inside = BOOL4_ALL_TRUE;
-				for (uint32_t p = 0; p < 6; ++p)
-				{
-					const float4& RESTRICT n_x = planes[p].normalX;
-					const float4& RESTRICT n_y = planes[p].normalY;
-					const float4& RESTRICT n_z = planes[p].normalZ;
-					const float4 n_dot_pos = (spherePositionX * n_x) + (spherePositionY * n_y) + (spherePositionZ * n_z);
-
-					// "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html is using the following
-					// float4 planeTestPoint = n_dot_pos + radius;
-					// bool4 planeTest = (planeTestPoint >= planes[p].d);
-
-					// "Frustum Culling" by Dion Picco - http://www.flipcode.com/archives/Frustum_Culling.shtml worked TODO(co) Figure out the difference
-					const float4 planeTestPoint = n_dot_pos + planes[p].d;
-					const bool4 planeTest = (planeTestPoint > negativeRadius);
-
-					inside = (planeTest & inside);
-				}
-
-				// Store 0 for spheres that didn't intersect or ended up on the positive side of the frustum planes
-				// -> Store 0xffffffff for spheres that are visible
-				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), inside);
-			}
+			// The cached data of the renderable manager hasn't been written
+			return false;
 		}
 
-		void simdOobbCulling([[maybe_unused]] const float4 worldSpaceCameraPositionFloat4[3], const SimdMatrix& viewSpaceToClipSpaceMatrix, const Renderer::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void gatherShadowCaster(const Renderer::MeshResourceManager& meshResourceManager, const Renderer::ISceneItem& sceneItem, Renderer::CompositorWorkspaceInstance::RenderableManagers& renderableManagers)
 		{
-			// Get pointers to the necessary members of the object set
-
-			// Get minimum object space bounding box corner position
-			const float* RESTRICT minimumX = sceneItemSet.minimumX.data();
-			const float* RESTRICT minimumY = sceneItemSet.minimumY.data();
-			const float* RESTRICT minimumZ = sceneItemSet.minimumZ.data();
-
-			// Get maximum object space bounding box corner position
-			const float* RESTRICT maximumX = sceneItemSet.maximumX.data();
-			const float* RESTRICT maximumY = sceneItemSet.maximumY.data();
-			const float* RESTRICT maximumZ = sceneItemSet.maximumZ.data();
-
-			// TODO(co) Add camera relative rendering ("worldSpaceCameraPositionFloat4") and 64 bit world space position support
-			// Get object space to world space matrix
-			const float* RESTRICT worldXX = sceneItemSet.worldXX.data();
-			const float* RESTRICT worldXY = sceneItemSet.worldXY.data();
-			const float* RESTRICT worldXZ = sceneItemSet.worldXZ.data();
-			const float* RESTRICT worldXW = sceneItemSet.worldXW.data();
-			const float* RESTRICT worldYX = sceneItemSet.worldYX.data();
-			const float* RESTRICT worldYY = sceneItemSet.worldYY.data();
-			const float* RESTRICT worldYZ = sceneItemSet.worldYZ.data();
-			const float* RESTRICT worldYW = sceneItemSet.worldYW.data();
-			const float* RESTRICT worldZX = sceneItemSet.worldZX.data();
-			const float* RESTRICT worldZY = sceneItemSet.worldZY.data();
-			const float* RESTRICT worldZZ = sceneItemSet.worldZZ.data();
-			const float* RESTRICT worldZW = sceneItemSet.worldZW.data();
-			const float* RESTRICT worldWX = sceneItemSet.worldWX.data();
-			const float* RESTRICT worldWY = sceneItemSet.worldWY.data();
-			const float* RESTRICT worldWZ = sceneItemSet.worldWZ.data();
-			const float* RESTRICT worldWW = sceneItemSet.worldWW.data();
-
-			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
-			for (size_t sceneItemIndex = threadSceneItemIndexStart; sceneItemIndex < threadSceneItemIndexEnd; sceneItemIndex += simdSize)
+			Renderer::RenderableManager* renderableManager = const_cast<Renderer::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
+			if (nullptr != renderableManager && renderableManager->isVisible())
 			{
-				// Load the world transform matrix for four objects via the indirection table
-				const uint32_t i0 = indirection[sceneItemIndex];
-				const uint32_t i1 = indirection[sceneItemIndex + 1];
-				const uint32_t i2 = indirection[sceneItemIndex + 2];
-				const uint32_t i3 = indirection[sceneItemIndex + 3];
-
-				#if defined(XSIMD_X86_INSTR_SET_AVAILABLE)
-				{ // Prefetch data for the next loop iteration in order to try to hide memory latency
-					// TODO(co) Optimization: This has been added without profiling. As soon as there's enough data do profiling here.
-					const size_t nextIndirectionIndex = sceneItemIndex + simdSize;
-					for (size_t componentIndex = 0; componentIndex < 4; ++componentIndex)
-					{
-						const uint32_t nextIndex = indirection[nextIndirectionIndex + componentIndex];
-
-						// Minimum object space bounding box corner position
-						xsimd::prefetch(&minimumX[nextIndex]);
-						xsimd::prefetch(&minimumY[nextIndex]);
-						xsimd::prefetch(&minimumZ[nextIndex]);
-
-						// Maximum object space bounding box corner position
-						xsimd::prefetch(&maximumX[nextIndex]);
-						xsimd::prefetch(&maximumY[nextIndex]);
-						xsimd::prefetch(&maximumZ[nextIndex]);
-
-						// Object space to world space matrix
-						xsimd::prefetch(&worldXX[nextIndex]);
-						xsimd::prefetch(&worldXY[nextIndex]);
-						xsimd::prefetch(&worldXZ[nextIndex]);
-						xsimd::prefetch(&worldXW[nextIndex]);
-						xsimd::prefetch(&worldYX[nextIndex]);
-						xsimd::prefetch(&worldYY[nextIndex]);
-						xsimd::prefetch(&worldYZ[nextIndex]);
-						xsimd::prefetch(&worldYW[nextIndex]);
-						xsimd::prefetch(&worldZX[nextIndex]);
-						xsimd::prefetch(&worldZY[nextIndex]);
-						xsimd::prefetch(&worldZZ[nextIndex]);
-						xsimd::prefetch(&worldZW[nextIndex]);
-						xsimd::prefetch(&worldWX[nextIndex]);
-						xsimd::prefetch(&worldWY[nextIndex]);
-						xsimd::prefetch(&worldWZ[nextIndex]);
-						xsimd::prefetch(&worldWW[nextIndex]);
-
-						// Visibility flag
-						xsimd::prefetch(&visibilityFlag[nextIndex]);
-					}
+				if (renderableManager->getRenderables().empty())
+				{
+					// Evicted meshes have no renderables and hence no known shadow casting state, shadow casters which aren't visible to the camera need their mesh as well
+					setMeshResourceReferenced(meshResourceManager, sceneItem);
 				}
-				#endif
-
-				SimdMatrix world;
-				world.x.x = float4(worldXX[i0], worldXX[i1], worldXX[i2], worldXX[i3]);
-				world.x.y = float4(worldXY[i0], worldXY[i1], worldXY[i2], worldXY[i3]);
-				world.x.z = float4(worldXZ[i0], worldXZ[i1], worldXZ[i2], worldXZ[i3]);
-				world.x.w = float4(worldXW[i0], worldXW[i1], worldXW[i2], worldXW[i3]);
-
-				world.y.x = float4(worldYX[i0], worldYX[i1], worldYX[i2], worldYX[i3]);
-				world.y.y = float4(worldYY[i0], worldYY[i1], worldYY[i2], worldYY[i3]);
-				world.y.z = float4(worldYZ[i0], worldYZ[i1], worldYZ[i2], worldYZ[i3]);
-				world.y.w = float4(worldYW[i0], worldYW[i1], worldYW[i2], worldYW[i3]);
-
-				world.z.x = float4(worldZX[i0], worldZX[i1], worldZX[i2], worldZX[i3]);
-				world.z.y = float4(worldZY[i0], worldZY[i1], worldZY[i2], worldZY[i3]);
-				world.z.z = float4(worldZZ[i0], worldZZ[i1], worldZZ[i2], worldZZ[i3]);
-				world.z.w = float4(worldZW[i0], worldZW[i1], worldZW[i2], worldZW[i3]);
-
-				world.w.x = float4(worldWX[i0], worldWX[i1], worldWX[i2], worldWX[i3]);
-				world.w.y = float4(worldWY[i0], worldWY[i1], worldWY[i2], worldWY[i3]);
-				world.w.z = float4(worldWZ[i0], worldWZ[i1], worldWZ[i2], worldWZ[i3]);
-				world.w.w = float4(worldWW[i0], worldWW[i1], worldWW[i2], worldWW[i3]);
-
-				// Create the matrix to go from object->world->view->clip space
-				const SimdMatrix clip = simdMultiply(viewSpaceToClipSpaceMatrix, world);
-
-				// Load the minimum and maximum corner positions of the bounding box in object space
-				SimdVector minimumPosition;
-				minimumPosition.x = float4(minimumX[i0], minimumX[i1], minimumX[i2], minimumX[i3]);
-				minimumPosition.y = float4(minimumY[i0], minimumY[i1], minimumY[i2], minimumY[i3]);
-				minimumPosition.z = float4(minimumZ[i0], minimumZ[i1], minimumZ[i2], minimumZ[i3]);
-				minimumPosition.w = float4(1.0f);
-
-				SimdVector maximumPosition;
-				maximumPosition.x = float4(maximumX[i0], maximumX[i1], maximumX[i2], maximumX[i3]);
-				maximumPosition.y = float4(maximumY[i0], maximumY[i1], maximumY[i2], maximumY[i3]);
-				maximumPosition.z = float4(maximumZ[i0], maximumZ[i1], maximumZ[i2], maximumZ[i3]);
-				maximumPosition.w = float4(1.0f);
-
-				// Transform each bounding box corner from object to clip space by sharing calculations
-				SimdVector clipPosition[8];
-				simdMinimumMaximumTransform(clip, minimumPosition, maximumPosition, clipPosition);
-
-				// Initialize test conditions
-				bool4 allXLess = BOOL4_ALL_TRUE;
-				bool4 allXGreater = BOOL4_ALL_TRUE;
-				bool4 allYLess = BOOL4_ALL_TRUE;
-				bool4 allYGreater = BOOL4_ALL_TRUE;
-				bool4 allZLess = BOOL4_ALL_TRUE;
-				bool4 anyZLess = BOOL4_ALL_FALSE;
-				bool4 allZGreater = BOOL4_ALL_TRUE;
-
-				// Test each corner of the OOBB and if any corner intersects the frustum that object is visible
-				for (uint32_t cs = 0; cs < 8; ++cs)
+				else if (renderableManager->getCastShadows())
 				{
-					const float4 neg_cs_w = -clipPosition[cs].w;
-
-					const bool4 x_le = (clipPosition[cs].x <= neg_cs_w);
-					const bool4 x_ge = (clipPosition[cs].x >= clipPosition[cs].w);
-					allXLess = (x_le & allXLess);
-					allXGreater = (x_ge & allXGreater);
-
-					const bool4 y_le = (clipPosition[cs].y <= neg_cs_w);
-					const bool4 y_ge = (clipPosition[cs].y >= clipPosition[cs].w);
-					allYLess = (y_le & allYLess);
-					allYGreater = (y_ge & allYGreater);
-
-					const bool4 z_le = (clipPosition[cs].z <= FLOAT4_ALL_ZERO);
-					const bool4 z_ge = (clipPosition[cs].z >= clipPosition[cs].w);
-					allZLess = (z_le & allZLess);
-					allZGreater = (z_ge & allZGreater);
-					anyZLess = (z_le | anyZLess);
+					setMeshResourceReferenced(meshResourceManager, sceneItem);
+					renderableManagers.push_back(renderableManager);
 				}
-
-				const bool4 anyXOutside = (allXLess | allXGreater);
-				const bool4 anyYOutside = (allYLess | allYGreater);
-				const bool4 anyZOutside = (allZLess | allZGreater);
-				bool4 outside = (anyXOutside | anyYOutside);
-				outside = (outside | anyZOutside);
-				bool4 inside = (outside ^ BOOL4_ALL_TRUE);
-
-				// TODO(co) Add "contribution culling" as mentioned at http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html - "Conclusion"
-
-				// Store the result in the "visibilityFlag"-array in a compacted way
-				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), inside);
 			}
 		}
 
@@ -522,12 +264,40 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Shadow cascade culling data of the cullable scene items
+	*
+	*  @remarks
+	*    The shadow casters aren't copied into a set of their own each frame. Each shadow cascade is culled against the persistent scene item
+	*    set, which is already kept up-to-date on scene item add, remove and transform change, using the bounding volume hierarchy broad phase
+	*    if it's enabled. Whether or not a scene item casts shadows is a property of its renderable manager which can change at any time (e.g.
+	*    material loading), so this is only checked for the scene items inside a shadow cascade.
+	*/
+	struct SceneCullingManager::ShadowCasterSet final
+	{
+		SceneItemSet::IntegerVector visibilityFlag;				// Frustum-sphere culling result of the current shadow cascade, same order as the scene item set data arrays
+		std::vector<uint32_t>		indirection;				// Scene item set indices of the scene items inside the current shadow cascade
+		std::vector<bool>			cameraVisible;				// Scene items whose renderable manager cached data has been written by the camera culling of the current frame, same order as the scene item set data arrays
+		std::vector<uint32_t>		cameraVisibleIndices;		// Scene item set indices of the set "cameraVisible"-entries, used to reset them at the next camera culling
+		glm::vec3					worldSpaceCameraPosition;	// World space camera position of the camera culling of the current frame
+		float						projectionScale = 0.0f;		// World space radius divided by clip space w to pixels scale of the camera culling of the current frame
+	};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	SceneCullingManager::SceneCullingManager() :
 		mCullableSceneItemSet(new SceneItemSet()),
-		mCullableShadowCastersSceneItemSet(new SceneItemSet())
+		mCullableShadowCasterSet(new ShadowCasterSet()),
+		mCullableSceneItemBvh(new SceneItemBvh()),
+		mSceneCullingKernels(&SceneCullingKernels::getBest()),
+		mBroadPhaseEnabled(true),
+		mMinimumProjectedRadius(0.5f)	// Sub-pixel: Projected bounding sphere diameter below one pixel
 	{
 		// Nothing here
 	}
@@ -535,18 +305,36 @@ namespace Renderer
 	SceneCullingManager::~SceneCullingManager()
 	{
 		delete mCullableSceneItemSet;
-		delete mCullableShadowCastersSceneItemSet;
+		delete mCullableShadowCasterSet;
+		delete mCullableSceneItemBvh;
+	}
+
+	void SceneCullingManager::setBroadPhaseEnabled(bool broadPhaseEnabled)
+	{
+		if (mBroadPhaseEnabled != broadPhaseEnabled)
+		{
+			mBroadPhaseEnabled = broadPhaseEnabled;
+			if (!mBroadPhaseEnabled)
+			{
+				// The BVH doesn't track scene item changes while disabled, so it's rebuilt from scratch when enabled again
+				mCullableSceneItemBvh->clear();
+			}
+		}
 	}
 
 	void SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems)
 	{
 		// Overview over the basic workflow of "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
+		// - For huge scenes, gather the potentially visible objects using the bounding volume hierarchy (BVH) broad phase instead of the following two steps
 		// - Kick jobs to do frustum vs sphere culling
 		//   - For each frustum plane, test plane vs sphere
 		// - Wait for sphere culling to finish
 		// - For objects that pass sphere test, kick jobs to do frustum vs object-oriented bounding box (OOBB) culling
 		//   - For each frustum plane, test plane vs OOBB
 		// - Wait for OOBB culling to finish
+		// - For objects that pass OOBB test, kick jobs to do contribution culling
+		//   - Calculate the projected bounding sphere radius in pixels, used for dropping sub-pixel objects and by the render queues for LOD selection
+		// - Wait for contribution culling to finish
 		const IRenderer& renderer = compositorContextData.getCompositorWorkspaceInstance()->getRenderer();
 
 		// Get the camera scene item
@@ -556,6 +344,7 @@ namespace Renderer
 		// Get view space to clip space matrix
 		SE_ASSERT(nullptr != compositorContextData.getCompositorWorkspaceInstance(), "Invalid compositor workspace instance")
 		glm::mat4 viewSpaceToClipSpaceMatrix;
+		float projectionScale = 0.0f;
 		{
 			{
 				// Get the render target with and height
@@ -565,200 +354,251 @@ namespace Renderer
 
 				// Get view space to clip space matrix
 				viewSpaceToClipSpaceMatrix = cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / renderTargetHeight);
+
+				// Scale from world space radius divided by clip space w to pixels
+				projectionScale = 0.5f * static_cast<float>(renderTargetHeight) * viewSpaceToClipSpaceMatrix[1][1];
 			}
 		}
 
 		// Calculate frustum using a camera relative world space to clip space matrix
-		const Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+		const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrix = viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix();
+		const Frustum frustum(cameraRelativeWorldSpaceToClipSpaceMatrix);
 		const glm::vec3 worldSpaceCameraPositionFloat = cameraSceneItem->getWorldSpaceCameraPosition();
-		::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPositionFloat.x), ::detail::float4(worldSpaceCameraPositionFloat.y), ::detail::float4(worldSpaceCameraPositionFloat.z) };
 
-		// Splat out the planes to be able to do plane-sphere test with SIMD
-		const ::detail::SimdPlane planes[6] =
+		// Write the world space data of the scene items which have been added or moved since the last culling
+		::detail::updateDirtySceneItems(renderer, *mCullableSceneItemSet, mBroadPhaseEnabled ? mCullableSceneItemBvh : nullptr);
+		if (mBroadPhaseEnabled)
 		{
-			// Left clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].d),
-
-			// Right clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].d),
-
-			// Top clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].d),
-
-			// Bottom clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].d),
-
-			// Near clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].d),
-
-			// Far clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].d),
-		};
-
-		// Make sure to align the size to the SIMD lane count
-		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
-
-		// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at this place for the culling kickoff
-		if (mCullableSceneItemSet->minimumX.size() != n_aligned_objects)
+			mCullableSceneItemBvh->update(*mCullableSceneItemSet);
+		}
+
+		{ // Remember the camera data for the shadow casters which aren't visible to the camera, reset the camera visibility of the last frame
+			ShadowCasterSet& shadowCasterSet = *mCullableShadowCasterSet;
+			shadowCasterSet.worldSpaceCameraPosition = worldSpaceCameraPositionFloat;
+			shadowCasterSet.projectionScale = projectionScale;
+			for (uint32_t sceneItemSetIndex : shadowCasterSet.cameraVisibleIndices)
+			{
+				shadowCasterSet.cameraVisible[sceneItemSetIndex] = false;
+			}
+			shadowCasterSet.cameraVisibleIndices.clear();
+			if (shadowCasterSet.cameraVisible.size() < mCullableSceneItemSet->numberOfSceneItems)
+			{
+				shadowCasterSet.cameraVisible.resize(mCullableSceneItemSet->numberOfSceneItems, false);
+			}
+		}
+
+		// The scene item set data arrays are always padded to the maximum SIMD lane count
+		const SceneCullingKernels& sceneCullingKernels = *mSceneCullingKernels;
+		const uint32_t simdLaneCount = sceneCullingKernels.simdLaneCount;
+		const uint32_t n_aligned_objects = Math::makeMultipleOf(mCullableSceneItemSet->numberOfSceneItems, simdLaneCount);
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+
+		// Get the job system instance
+		JobSystem& jobSystem = renderer.getJobSystem();
+
+		mIndirection.resize(n_aligned_objects + SceneItemSet::SIMD_LANE_COUNT);	// Take prefetch of the next SIMD batch into account
+		uint32_t numberOfVisibleItems = 0;
+		if (mBroadPhaseEnabled && mCullableSceneItemBvh->hasTree())
+		{
+			// Let the BVH broad phase gather the indices of the objects whose bounding sphere intersects the frustum
+			numberOfVisibleItems = mCullableSceneItemBvh->gatherVisibleSceneItems(sceneItemSet, worldSpaceCameraPositionFloat, frustum, mIndirection.data());
+			::detail::padIndirection(mIndirection.data(), numberOfVisibleItems, simdLaneCount);
+		}
+		else
 		{
-			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
-			const uint32_t size = n_aligned_objects + xsimd::simd_type<float>::size;
-
-			// Minimum object space bounding box corner position
-			mCullableSceneItemSet->minimumX.resize(size);
-			mCullableSceneItemSet->minimumY.resize(size);
-			mCullableSceneItemSet->minimumZ.resize(size);
-
-			// Maximum object space bounding box corner position
-			mCullableSceneItemSet->maximumX.resize(size);
-			mCullableSceneItemSet->maximumY.resize(size);
-			mCullableSceneItemSet->maximumZ.resize(size);
-
-			// Object space to world space matrix
-			mCullableSceneItemSet->worldXX.resize(size);
-			mCullableSceneItemSet->worldXY.resize(size);
-			mCullableSceneItemSet->worldXZ.resize(size);
-			mCullableSceneItemSet->worldXW.resize(size);
-			mCullableSceneItemSet->worldYX.resize(size);
-			mCullableSceneItemSet->worldYY.resize(size);
-			mCullableSceneItemSet->worldYZ.resize(size);
-			mCullableSceneItemSet->worldYW.resize(size);
-			mCullableSceneItemSet->worldZX.resize(size);
-			mCullableSceneItemSet->worldZY.resize(size);
-			mCullableSceneItemSet->worldZZ.resize(size);
-			mCullableSceneItemSet->worldZW.resize(size);
-			mCullableSceneItemSet->worldWX.resize(size);
-			mCullableSceneItemSet->worldWY.resize(size);
-			mCullableSceneItemSet->worldWZ.resize(size);
-			mCullableSceneItemSet->worldWW.resize(size);
-
-			// World space center position of bounding sphere
-			mCullableSceneItemSet->spherePositionX.resize(size);
-			mCullableSceneItemSet->spherePositionY.resize(size);
-			mCullableSceneItemSet->spherePositionZ.resize(size);
-
-			// Negative world space radius of bounding sphere
-			mCullableSceneItemSet->negativeRadius.resize(size);
-
-			mCullableSceneItemSet->visibilityFlag.resize(size);
-			mCullableSceneItemSet->sceneItemVector.resize(size);
+			{ // Do SIMD multi-threaded frustum-sphere culling
+				SceneCullingSphereData sphereData;
+				sphereData.spherePositionX = sceneItemSet.spherePositionX.data();
+				sphereData.spherePositionY = sceneItemSet.spherePositionY.data();
+				sphereData.spherePositionZ = sceneItemSet.spherePositionZ.data();
+				sphereData.negativeRadius = sceneItemSet.negativeRadius.data();
+				::detail::setSphereData(worldSpaceCameraPositionFloat, frustum, sphereData);
+				sphereData.visibilityFlag = sceneItemSet.visibilityFlag.data();
+
+				// The job system works on SIMD batches so that each package starts at a SIMD lane count aligned scene item index
+				jobSystem.parallelFor(n_aligned_objects / simdLaneCount, ::detail::MINIMUM_SCENE_ITEMS_SPLIT_COUNT / simdLaneCount, [&sceneCullingKernels, &sphereData, simdLaneCount](uint32_t startBatchIndex, uint32_t endBatchIndex)
+				{
+					sceneCullingKernels.sphereCulling(sphereData, startBatchIndex * simdLaneCount, endBatchIndex * simdLaneCount);
+				});
+			}
+
+			// Store the indices of the objects that passed the frustum-sphere culling in the `indirection` array
+			numberOfVisibleItems = ::detail::removeNotVisible(sceneItemSet, sceneItemSet.numberOfSceneItems, nullptr, mIndirection.data(), simdLaneCount);
 		}
 
-		// Get the thread pool instance
-		DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
+		{ // Do SIMD multi-threaded frustum-OOBB culling
+			SceneCullingOobbData oobbData;
+			oobbData.minimumX = sceneItemSet.minimumX.data();
+			oobbData.minimumY = sceneItemSet.minimumY.data();
+			oobbData.minimumZ = sceneItemSet.minimumZ.data();
+			oobbData.maximumX = sceneItemSet.maximumX.data();
+			oobbData.maximumY = sceneItemSet.maximumY.data();
+			oobbData.maximumZ = sceneItemSet.maximumZ.data();
+			oobbData.world[0][0] = sceneItemSet.worldXX.data();
+			oobbData.world[0][1] = sceneItemSet.worldXY.data();
+			oobbData.world[0][2] = sceneItemSet.worldXZ.data();
+			oobbData.world[0][3] = sceneItemSet.worldXW.data();
+			oobbData.world[1][0] = sceneItemSet.worldYX.data();
+			oobbData.world[1][1] = sceneItemSet.worldYY.data();
+			oobbData.world[1][2] = sceneItemSet.worldYZ.data();
+			oobbData.world[1][3] = sceneItemSet.worldYW.data();
+			oobbData.world[2][0] = sceneItemSet.worldZX.data();
+			oobbData.world[2][1] = sceneItemSet.worldZY.data();
+			oobbData.world[2][2] = sceneItemSet.worldZZ.data();
+			oobbData.world[2][3] = sceneItemSet.worldZW.data();
+			oobbData.world[3][0] = sceneItemSet.worldWX.data();
+			oobbData.world[3][1] = sceneItemSet.worldWY.data();
+			oobbData.world[3][2] = sceneItemSet.worldWZ.data();
+			oobbData.world[3][3] = sceneItemSet.worldWW.data();
+			memcpy(oobbData.viewSpaceToClipSpaceMatrix, glm::value_ptr(viewSpaceToClipSpaceMatrix), sizeof(float) * 16);
+			oobbData.indirection = mIndirection.data();
+			oobbData.visibilityFlag = sceneItemSet.visibilityFlag.data();
+
+			jobSystem.parallelFor(Math::makeMultipleOf(numberOfVisibleItems, simdLaneCount) / simdLaneCount, ::detail::MINIMUM_SCENE_ITEMS_SPLIT_COUNT / simdLaneCount, [&sceneCullingKernels, &oobbData, simdLaneCount](uint32_t startBatchIndex, uint32_t endBatchIndex)
+			{
+				sceneCullingKernels.oobbCulling(oobbData, startBatchIndex * simdLaneCount, endBatchIndex * simdLaneCount);
+			});
+		}
 
-		{ // Do SIMD multi-threaded frustum-sphere culling
-			size_t itemCount = mCullableSceneItemSet->numberOfSceneItems;
-			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-			if (1 == threadCount)
+		// Build up the indirection array that represents the objects that survived the frustum-OOBB culling
+		const uint32_t numberOfOobbVisible = ::detail::removeNotVisible(sceneItemSet, numberOfVisibleItems, mIndirection.data(), mIndirection.data(), simdLaneCount);
+
+		{ // Do SIMD multi-threaded contribution culling
+			SceneCullingContributionData contributionData;
+			contributionData.spherePositionX = sceneItemSet.spherePositionX.data();
+			contributionData.spherePositionY = sceneItemSet.spherePositionY.data();
+			contributionData.spherePositionZ = sceneItemSet.spherePositionZ.data();
+			contributionData.negativeRadius = sceneItemSet.negativeRadius.data();
+			contributionData.worldSpaceCameraPosition[0] = worldSpaceCameraPositionFloat.x;
+			contributionData.worldSpaceCameraPosition[1] = worldSpaceCameraPositionFloat.y;
+			contributionData.worldSpaceCameraPosition[2] = worldSpaceCameraPositionFloat.z;
+			for (uint32_t i = 0; i < 4; ++i)
 			{
-				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
+				contributionData.clipSpaceW[i] = cameraRelativeWorldSpaceToClipSpaceMatrix[i][3];
 			}
-			else
+			contributionData.projectionScale = projectionScale;
+			contributionData.minimumProjectedRadius = mMinimumProjectedRadius;
+			contributionData.indirection = mIndirection.data();
+			contributionData.projectedRadius = sceneItemSet.projectedRadius.data();
+			contributionData.visibilityFlag = sceneItemSet.visibilityFlag.data();
+
+			jobSystem.parallelFor(Math::makeMultipleOf(numberOfOobbVisible, simdLaneCount) / simdLaneCount, ::detail::MINIMUM_SCENE_ITEMS_SPLIT_COUNT / simdLaneCount, [&sceneCullingKernels, &contributionData, simdLaneCount](uint32_t startBatchIndex, uint32_t endBatchIndex)
+			{
+				sceneCullingKernels.contributionCulling(contributionData, startBatchIndex * simdLaneCount, endBatchIndex * simdLaneCount);
+			});
+		}
+
+		// Fill render queue index ranges with the visible stuff which survived the contribution culling
+		const MeshResourceManager& meshResourceManager = renderer.getMeshResourceManager();
+		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
+		const uint32_t* visibilityFlag = sceneItemSet.visibilityFlag.data();
+		const float* projectedRadius = sceneItemSet.projectedRadius.data();
+		ShadowCasterSet& shadowCasterSet = *mCullableShadowCasterSet;
+		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+		{
+			if (visibilityFlag[indirectionIndex])
 			{
-				// Multi-threaded
-				size_t threadSceneItemIndexOffset = 0;
-				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				const uint32_t sceneItemSetIndex = mIndirection[indirectionIndex];
+				if (::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(meshResourceManager, *sceneItemSet.sceneItemVector[sceneItemSetIndex], cameraPosition, projectedRadius[indirectionIndex], renderQueueIndexRanges, executeOnRenderingSceneItems))
 				{
-					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
-					itemCount -= splitCount;
-					threadSceneItemIndexOffset += splitCount;
+					shadowCasterSet.cameraVisible[sceneItemSetIndex] = true;
+					shadowCasterSet.cameraVisibleIndices.push_back(sceneItemSetIndex);
 				}
-
-				// Wait that all worker threads have done their part of the calculation
-				defaultThreadPool.process();
 			}
 		}
 
-		// Store the indices of the objects that passed the frustum-sphere culling in the `indirection` array
-		mIndirection.resize(n_aligned_objects);
-		const uint32_t numberOfVisibleItems = ::detail::removeNotVisible(*mCullableSceneItemSet, mCullableSceneItemSet->numberOfSceneItems, nullptr, mIndirection.data());
+		// Fill render queue index ranges with the always-visible stuff, always considered to be rendered with full detail
+		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(meshResourceManager, *sceneItem, cameraPosition, std::numeric_limits<float>::max(), renderQueueIndexRanges, executeOnRenderingSceneItems);
+		}
+	}
 
-		// Construct the SimdMatrix "simd_view_proj"
-		const ::detail::SimdMatrix simd_view_proj =
+	void SceneCullingManager::gatherShadowCastersRenderableManagers(const CompositorContextData& compositorContextData, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, CompositorWorkspaceInstance::RenderableManagers& renderableManagers)
+	{
+		renderableManagers.clear();
+		ShadowCasterSet& shadowCasterSet = *mCullableShadowCasterSet;
+		const SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+		const MeshResourceManager& meshResourceManager = compositorContextData.getCompositorWorkspaceInstance()->getRenderer().getMeshResourceManager();
+		if (sceneItemSet.numberOfSceneItems > 0)
 		{
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][3]),
-		};
+			// Extrude the shadow casters toward the light by replacing the near plane with a plane everything is inside of
+			const glm::vec3 worldSpaceCameraPosition(compositorContextData.getWorldSpaceCameraPosition());
+			Frustum frustum(cameraRelativeWorldSpaceToClipSpaceMatrix);
+			{
+				Plane& nearPlane = frustum.planes[Frustum::PLANE_NEAR];
+				nearPlane.normal = glm::vec3(0.0f, 0.0f, 0.0f);
+				nearPlane.d = std::numeric_limits<float>::max();
+			}
 
-		{ // Do SIMD multi-threaded frustum-OOBB culling
-			size_t itemCount = numberOfVisibleItems;
-			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-			if (1 == threadCount)
+			// Gather the indices of the scene items inside the shadow cascade
+			const uint32_t paddedSize = Math::makeMultipleOf(sceneItemSet.numberOfSceneItems, SceneItemSet::SIMD_LANE_COUNT) + SceneItemSet::SIMD_LANE_COUNT;
+			if (shadowCasterSet.indirection.size() < paddedSize)
+			{
+				shadowCasterSet.indirection.resize(paddedSize);
+			}
+			uint32_t numberOfInsideItems = 0;
+			if (mBroadPhaseEnabled && mCullableSceneItemBvh->hasTree())
 			{
-				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdOobbCulling(worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
+				// Let the BVH broad phase gather the scene items, the BVH has been updated by the camera culling of the current frame
+				numberOfInsideItems = mCullableSceneItemBvh->gatherVisibleSceneItems(sceneItemSet, worldSpaceCameraPosition, frustum, shadowCasterSet.indirection.data());
 			}
 			else
 			{
-				// Multi-threaded
-				size_t threadSceneItemIndexOffset = 0;
-				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+				// Do SIMD multi-threaded frustum-sphere culling on the scene item set data arrays
+				if (shadowCasterSet.visibilityFlag.size() < paddedSize)
 				{
-					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdOobbCulling, worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
-					itemCount -= splitCount;
-					threadSceneItemIndexOffset += splitCount;
+					shadowCasterSet.visibilityFlag.resize(paddedSize);
 				}
+				const SceneCullingKernels& sceneCullingKernels = *mSceneCullingKernels;
+				const uint32_t simdLaneCount = sceneCullingKernels.simdLaneCount;
+				SceneCullingSphereData sphereData;
+				sphereData.spherePositionX = sceneItemSet.spherePositionX.data();
+				sphereData.spherePositionY = sceneItemSet.spherePositionY.data();
+				sphereData.spherePositionZ = sceneItemSet.spherePositionZ.data();
+				sphereData.negativeRadius = sceneItemSet.negativeRadius.data();
+				::detail::setSphereData(worldSpaceCameraPosition, frustum, sphereData);
+				sphereData.visibilityFlag = shadowCasterSet.visibilityFlag.data();
+				compositorContextData.getCompositorWorkspaceInstance()->getRenderer().getJobSystem().parallelFor(Math::makeMultipleOf(sceneItemSet.numberOfSceneItems, simdLaneCount) / simdLaneCount, ::detail::MINIMUM_SCENE_ITEMS_SPLIT_COUNT / simdLaneCount, [&sceneCullingKernels, &sphereData, simdLaneCount](uint32_t startBatchIndex, uint32_t endBatchIndex)
+				{
+					sceneCullingKernels.sphereCulling(sphereData, startBatchIndex * simdLaneCount, endBatchIndex * simdLaneCount);
+				});
 
-				// Wait that all worker threads have done their part of the calculation
-				defaultThreadPool.process();
+				// Store the indices of the scene items inside the shadow cascade
+				const uint32_t* visibilityFlag = shadowCasterSet.visibilityFlag.data();
+				uint32_t* indirection = shadowCasterSet.indirection.data();
+				for (uint32_t i = 0; i < sceneItemSet.numberOfSceneItems; ++i)
+				{
+					indirection[numberOfInsideItems] = i;
+					numberOfInsideItems += (visibilityFlag[i] & 1);
+				}
 			}
-		}
-
-		// Build up the indirection array that represents the objects that survived the frustum-OOBB culling
-		const uint32_t numberOfOobbVisible = ::detail::removeNotVisible(*mCullableSceneItemSet, numberOfVisibleItems, mIndirection.data(), mIndirection.data());
 
-		// Fill render queue index ranges with the visible stuff
-		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
-		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
-		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]], cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			// Gather the renderable managers of the shadow casters inside the shadow cascade
+			const uint32_t* indirection = shadowCasterSet.indirection.data();
+			for (uint32_t i = 0; i < numberOfInsideItems; ++i)
+			{
+				const uint32_t sceneItemSetIndex = indirection[i];
+				const size_t numberOfRenderableManagers = renderableManagers.size();
+				::detail::gatherShadowCaster(meshResourceManager, *sceneItemSet.sceneItemVector[sceneItemSetIndex], renderableManagers);
+				if (renderableManagers.size() != numberOfRenderableManagers && (sceneItemSetIndex >= shadowCasterSet.cameraVisible.size() || !shadowCasterSet.cameraVisible[sceneItemSetIndex]))
+				{
+					// Shadow casters which aren't visible to the camera still need a distance to camera for render queue sorting and a projected radius
+					// for LOD selection (the distance is a conservative approximation of the clip space w)
+					const glm::vec3 spherePosition(sceneItemSet.spherePositionX[sceneItemSetIndex], sceneItemSet.spherePositionY[sceneItemSetIndex], sceneItemSet.spherePositionZ[sceneItemSetIndex]);
+					const float distanceToCamera = glm::distance(shadowCasterSet.worldSpaceCameraPosition, spherePosition);
+					const float radius = -sceneItemSet.negativeRadius[sceneItemSetIndex];
+					RenderableManager* renderableManager = renderableManagers.back();
+					renderableManager->setCachedDistanceToCamera(distanceToCamera);
+					renderableManager->setCachedProjectedRadius((distanceToCamera > radius) ? (radius * shadowCasterSet.projectionScale / distanceToCamera) : std::numeric_limits<float>::max());
+				}
+			}
 		}
 
-		// Fill render queue index ranges with the always-visible stuff
-		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		// Uncullable shadow casters are always inside the shadow cascade
+		for (const ISceneItem* sceneItem : mUncullableSceneItems)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			::detail::gatherShadowCaster(meshResourceManager, *sceneItem, renderableManagers);
 		}
 	}
 
@@ -10,6 +10,8 @@ namespace Renderer
 {
 	class ISceneItem;
 	struct SceneItemSet;
+	struct SceneCullingKernels;
+	class SceneItemBvh;
 	class CompositorContextData;
 }
 
@@ -36,6 +38,25 @@ namespace Renderer
 		~SceneCullingManager();
 		void gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems);
 
+		/**
+		*  @brief
+		*    Gather the shadow casting renderable managers which can cast a shadow into the given light space orthographic volume
+		*
+		*  @param[in] compositorContextData
+		*    Compositor context data, must be the one which was passed into the last "Renderer::SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers()" call
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrix
+		*    Camera relative world space to clip space matrix of the orthographic shadow cascade camera, the near plane must face the light
+		*  @param[out] renderableManagers
+		*    Receives the shadow casting renderable managers, the list is cleared before gathering
+		*
+		*  @note
+		*    - The persistent cullable scene item set is culled directly, using the bounding volume hierarchy broad phase if it's enabled, there's
+		*      no per frame gathering of the shadow casters
+		*    - Shadow casters are extruded toward the light: Scene items in between the light and the cascade are kept since their shadow
+		*      falls into the cascade, technically the near plane of the orthographic volume isn't tested
+		*/
+		void gatherShadowCastersRenderableManagers(const CompositorContextData& compositorContextData, const glm::mat4& cameraRelativeWorldSpaceToClipSpaceMatrix, CompositorWorkspaceInstance::RenderableManagers& renderableManagers);
+
 		[[nodiscard]] inline SceneItemSet& getCullableSceneItemSet() const
 		{
 			// We know that this pointer is always valid
@@ -48,6 +69,47 @@ namespace Renderer
 			return mUncullableSceneItems;
 		}
 
+		[[nodiscard]] inline bool isBroadPhaseEnabled() const
+		{
+			return mBroadPhaseEnabled;
+		}
+
+		/**
+		*  @brief
+		*    Set whether or not the bounding volume hierarchy (BVH) broad phase is used for huge scenes
+		*
+		*  @param[in] broadPhaseEnabled
+		*    "true" to use the BVH broad phase in front of the frustum-OOBB culling, "false" to always use the linear frustum-sphere culling (e.g. for profiling)
+		*/
+		void setBroadPhaseEnabled(bool broadPhaseEnabled);
+
+		[[nodiscard]] inline float getMinimumProjectedRadius() const
+		{
+			return mMinimumProjectedRadius;
+		}
+
+		/**
+		*  @brief
+		*    Set the contribution culling threshold
+		*
+		*  @param[in] minimumProjectedRadius
+		*    Scene items with a smaller projected bounding sphere radius in pixels are culled, 0 to disable contribution culling
+		*
+		*  @note
+		*    - Compositor passes can use higher thresholds as well as LOD thresholds via "Renderer::RenderQueue::ContributionSettings"
+		*/
+		inline void setMinimumProjectedRadius(float minimumProjectedRadius)
+		{
+			mMinimumProjectedRadius = minimumProjectedRadius;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct ShadowCasterSet;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -61,10 +123,14 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		SceneItemSet*		  mCullableSceneItemSet;				// Cullable scene item set, always valid, destroy the instance if you no longer need it
-		SceneItemSet*		  mCullableShadowCastersSceneItemSet;	// Cullable shadow casters scene item set, always valid, destroy the instance if you no longer need it	TODO(co) Implement me
-		SceneItems			  mUncullableSceneItems;				// Scene items which can't be culled and hence are always considered to be visible
-		std::vector<uint32_t> mIndirection;
+		SceneItemSet*			   mCullableSceneItemSet;				// Cullable scene item set, always valid, destroy the instance if you no longer need it
+		ShadowCasterSet*		   mCullableShadowCasterSet;			// Shadow cascade culling data of the cullable scene items, always valid, destroy the instance if you no longer need it
+		SceneItems				   mUncullableSceneItems;				// Scene items which can't be culled and hence are always considered to be visible
+		std::vector<uint32_t>	   mIndirection;
+		SceneItemBvh*			   mCullableSceneItemBvh;				// Bounding volume hierarchy broad phase of the cullable scene item set, always valid, destroy the instance if you no longer need it
+		const SceneCullingKernels* mSceneCullingKernels;				// Scene culling kernels of the best instruction set supported by the CPU, always valid, don't destroy the instance
+		bool					   mBroadPhaseEnabled;					// Use the bounding volume hierarchy broad phase?
+		float					   mMinimumProjectedRadius;				// Contribution culling threshold, scene items with a smaller projected bounding sphere radius in pixels are culled
 
 
 	};
@@ -0,0 +1,434 @@
+#include "stdafx.h"
+#include "Renderer/Resource/Scene/Culling/SceneItemBvh.h"
+#include "Renderer/Resource/Scene/Culling/SceneItemSet.h"
+#include "Math/Frustum.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t REBUILD_CHANGES_DIVISOR = 8;	// Rebuild as soon as more than 1/8 of the scene items changed since the last build
+		static constexpr uint32_t ALL_PLANES_MASK		  = (1u << Frustum::NUMBER_OF_PLANES) - 1;
+		static constexpr uint32_t MAXIMUM_STACK_SIZE	  = 64;	// Median split, so the tree depth is logarithmic
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void getSceneItemBounds(const Renderer::SceneItemSet& sceneItemSet, uint32_t sceneItemSetIndex, glm::vec3& minimum, glm::vec3& maximum)
+		{
+			const glm::vec3 spherePosition(sceneItemSet.spherePositionX[sceneItemSetIndex], sceneItemSet.spherePositionY[sceneItemSetIndex], sceneItemSet.spherePositionZ[sceneItemSetIndex]);
+			const float radius = -sceneItemSet.negativeRadius[sceneItemSetIndex];
+			minimum = spherePosition - radius;
+			maximum = spherePosition + radius;
+		}
+
+		[[nodiscard]] bool isSphereInsideFrustum(const Renderer::SceneItemSet& sceneItemSet, uint32_t sceneItemSetIndex, const glm::vec3& worldSpaceCameraPosition, const Frustum& frustum, uint32_t planeMask)
+		{
+			// Same calculation as inside the SIMD frustum-sphere culling kernel
+			const float spherePositionX = sceneItemSet.spherePositionX[sceneItemSetIndex] - worldSpaceCameraPosition.x;
+			const float spherePositionY = sceneItemSet.spherePositionY[sceneItemSetIndex] - worldSpaceCameraPosition.y;
+			const float spherePositionZ = sceneItemSet.spherePositionZ[sceneItemSetIndex] - worldSpaceCameraPosition.z;
+			const float negativeRadius = sceneItemSet.negativeRadius[sceneItemSetIndex];
+			for (uint32_t p = 0; p < Frustum::NUMBER_OF_PLANES; ++p)
+			{
+				if (planeMask & (1u << p))
+				{
+					const Plane& plane = frustum.planes[p];
+					const float n_dot_pos = (spherePositionX * plane.normal.x) + (spherePositionY * plane.normal.y) + (spherePositionZ * plane.normal.z);
+					if (!(n_dot_pos + plane.d > negativeRadius))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool isBoxInsideFrustum(const glm::vec3& minimum, const glm::vec3& maximum, const glm::vec3& worldSpaceCameraPosition, const Frustum& frustum, uint32_t& planeMask)
+		{
+			// Test the camera relative axis aligned bounding box against each plane which isn't known to fully contain the box, yet
+			// -> Planes which fully contain the box are removed from the plane mask, children don't need to be tested against them
+			const glm::vec3 center = (minimum + maximum) * 0.5f - worldSpaceCameraPosition;
+			const glm::vec3 extent = (maximum - minimum) * 0.5f;
+			for (uint32_t p = 0; p < Frustum::NUMBER_OF_PLANES; ++p)
+			{
+				if (planeMask & (1u << p))
+				{
+					const Plane& plane = frustum.planes[p];
+					const float distance = glm::dot(plane.normal, center) + plane.d;
+					const float projectedExtent = glm::dot(glm::abs(plane.normal), extent);
+					if (distance < -projectedExtent)
+					{
+						// Completely on the outside of the plane
+						return false;
+					}
+					if (distance > projectedExtent)
+					{
+						// Completely on the inside of the plane
+						planeMask &= ~(1u << p);
+					}
+				}
+			}
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	SceneItemBvh::SceneItemBvh() :
+		mNumberOfChangesSinceBuild(0),
+		mNumberOfBuildItems(0),
+		mBuildFinished(false)
+	{
+		// Nothing here
+	}
+
+	SceneItemBvh::~SceneItemBvh()
+	{
+		clear();
+	}
+
+	void SceneItemBvh::clear()
+	{
+		if (mBuildThread.joinable())
+		{
+			mBuildThread.join();
+		}
+		mNodes.clear();
+		mParentNodeIndices.clear();
+		mItemHandles.clear();
+		mLeafNodeIndexByHandle.clear();
+		mPendingHandles.clear();
+		mNumberOfChangesSinceBuild = 0;
+		mNumberOfBuildItems = 0;
+		mBuildItems.clear();
+		mChangedHandlesSinceBuildStart.clear();
+	}
+
+	void SceneItemBvh::onSceneItemChanged(const SceneItemSet& sceneItemSet, uint32_t handle)
+	{
+		// Remember the change for the tree which is currently build in the background
+		if (mBuildThread.joinable())
+		{
+			mChangedHandlesSinceBuildStart.push_back(handle);
+		}
+		if (!hasTree())
+		{
+			return;
+		}
+
+		// Scene items inside the pending list are tested using their current bounding sphere anyway
+		const uint32_t leafNodeIndex = (handle < mLeafNodeIndexByHandle.size()) ? mLeafNodeIndexByHandle[handle] : GetInvalid<uint32_t>();
+		if (PENDING_LEAF_NODE_INDEX != leafNodeIndex)
+		{
+			if (IsValid(leafNodeIndex))
+			{
+				// Known scene item which moved, refit
+				glm::vec3 minimum;
+				glm::vec3 maximum;
+				::detail::getSceneItemBounds(sceneItemSet, sceneItemSet.getIndexByHandle(handle), minimum, maximum);
+				refitLeaf(leafNodeIndex, minimum, maximum);
+			}
+			else
+			{
+				// New scene item, tested linearly until the next build
+				if (handle >= mLeafNodeIndexByHandle.size())
+				{
+					mLeafNodeIndexByHandle.resize(handle + 1, GetInvalid<uint32_t>());
+				}
+				mLeafNodeIndexByHandle[handle] = PENDING_LEAF_NODE_INDEX;
+				mPendingHandles.push_back(handle);
+			}
+			++mNumberOfChangesSinceBuild;
+		}
+	}
+
+	void SceneItemBvh::update(const SceneItemSet& sceneItemSet)
+	{
+		// Take over a finished background build
+		if (mBuildThread.joinable() && mBuildFinished.load(std::memory_order_acquire))
+		{
+			finishBackgroundBuild(sceneItemSet);
+		}
+
+		// Kick off a new background build if required
+		if (!mBuildThread.joinable())
+		{
+			if (sceneItemSet.numberOfSceneItems >= MINIMUM_NUMBER_OF_SCENE_ITEMS)
+			{
+				if (!hasTree() || mNumberOfChangesSinceBuild > mNumberOfBuildItems / ::detail::REBUILD_CHANGES_DIVISOR)
+				{
+					startBackgroundBuild(sceneItemSet);
+				}
+			}
+			else if (hasTree())
+			{
+				// Not worth the effort
+				clear();
+			}
+		}
+	}
+
+	uint32_t SceneItemBvh::gatherVisibleSceneItems(const SceneItemSet& sceneItemSet, const glm::vec3& worldSpaceCameraPosition, const Frustum& frustum, uint32_t* outputIndirection) const
+	{
+		SE_ASSERT(hasTree(), "There's no scene item BVH")
+		uint32_t numberOfVisibleItems = 0;
+
+		// Traverse the tree, the plane mask tells which planes still need to be tested
+		struct StackEntry final
+		{
+			uint32_t nodeIndex;
+			uint32_t planeMask;
+		};
+		StackEntry stack[::detail::MAXIMUM_STACK_SIZE];
+		uint32_t stackSize = 0;
+		stack[stackSize++] = { 0, ::detail::ALL_PLANES_MASK };
+		while (stackSize > 0)
+		{
+			const StackEntry stackEntry = stack[--stackSize];
+			const Node& node = mNodes[stackEntry.nodeIndex];
+			uint32_t planeMask = stackEntry.planeMask;
+			if (0 != planeMask && !::detail::isBoxInsideFrustum(node.minimum, node.maximum, worldSpaceCameraPosition, frustum, planeMask))
+			{
+				continue;
+			}
+			if (0 == node.numberOfItems)
+			{
+				SE_ASSERT(stackSize + 2 <= ::detail::MAXIMUM_STACK_SIZE, "Scene item BVH traversal stack overflow")
+				stack[stackSize++] = { node.firstIndex + 1, planeMask };
+				stack[stackSize++] = { node.firstIndex, planeMask };
+			}
+			else
+			{
+				// Test the scene items of the leaf, scene items which have been removed in the meantime are skipped
+				const uint32_t* itemHandles = &mItemHandles[node.firstIndex];
+				for (uint32_t i = 0; i < node.numberOfItems; ++i)
+				{
+					const uint32_t handle = itemHandles[i];
+					if (sceneItemSet.isValidHandle(handle))
+					{
+						const uint32_t sceneItemSetIndex = sceneItemSet.getIndexByHandle(handle);
+						if (0 == planeMask || ::detail::isSphereInsideFrustum(sceneItemSet, sceneItemSetIndex, worldSpaceCameraPosition, frustum, planeMask))
+						{
+							outputIndirection[numberOfVisibleItems] = sceneItemSetIndex;
+							++numberOfVisibleItems;
+						}
+					}
+				}
+			}
+		}
+
+		// Test the scene items which have been added since the last build
+		for (uint32_t handle : mPendingHandles)
+		{
+			if (sceneItemSet.isValidHandle(handle))
+			{
+				const uint32_t sceneItemSetIndex = sceneItemSet.getIndexByHandle(handle);
+				if (::detail::isSphereInsideFrustum(sceneItemSet, sceneItemSetIndex, worldSpaceCameraPosition, frustum, ::detail::ALL_PLANES_MASK))
+				{
+					outputIndirection[numberOfVisibleItems] = sceneItemSetIndex;
+					++numberOfVisibleItems;
+				}
+			}
+		}
+
+		// Done
+		return numberOfVisibleItems;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	void SceneItemBvh::buildTree(BuildItems& buildItems, Tree& tree)
+	{
+		const uint32_t numberOfBuildItems = static_cast<uint32_t>(buildItems.size());
+		tree.nodes.clear();
+		tree.parentNodeIndices.clear();
+		tree.itemHandles.clear();
+		tree.leafNodeIndexByHandle.clear();
+		if (0 == numberOfBuildItems)
+		{
+			return;
+		}
+
+		// Top-down build, split at the median of the longest centroid axis
+		struct BuildEntry final
+		{
+			uint32_t nodeIndex;
+			uint32_t startIndex;
+			uint32_t endIndex;
+		};
+		std::vector<BuildEntry> buildStack;
+		tree.nodes.reserve(2 * (numberOfBuildItems / MAXIMUM_NUMBER_OF_LEAF_ITEMS + 1));
+		tree.nodes.push_back(Node());
+		tree.parentNodeIndices.push_back(GetInvalid<uint32_t>());
+		buildStack.push_back({ 0, 0, numberOfBuildItems });
+		while (!buildStack.empty())
+		{
+			const BuildEntry buildEntry = buildStack.back();
+			buildStack.pop_back();
+
+			// Calculate the node bounds as well as the centroid bounds
+			glm::vec3 minimum = buildItems[buildEntry.startIndex].minimum;
+			glm::vec3 maximum = buildItems[buildEntry.startIndex].maximum;
+			glm::vec3 minimumCentroid = (minimum + maximum) * 0.5f;
+			glm::vec3 maximumCentroid = minimumCentroid;
+			for (uint32_t i = buildEntry.startIndex + 1; i < buildEntry.endIndex; ++i)
+			{
+				const BuildItem& buildItem = buildItems[i];
+				minimum = glm::min(minimum, buildItem.minimum);
+				maximum = glm::max(maximum, buildItem.maximum);
+				const glm::vec3 centroid = (buildItem.minimum + buildItem.maximum) * 0.5f;
+				minimumCentroid = glm::min(minimumCentroid, centroid);
+				maximumCentroid = glm::max(maximumCentroid, centroid);
+			}
+			Node& node = tree.nodes[buildEntry.nodeIndex];
+			node.minimum = minimum;
+			node.maximum = maximum;
+
+			// Leaf or inner node?
+			const uint32_t numberOfItems = buildEntry.endIndex - buildEntry.startIndex;
+			if (numberOfItems <= MAXIMUM_NUMBER_OF_LEAF_ITEMS)
+			{
+				node.firstIndex = buildEntry.startIndex;
+				node.numberOfItems = numberOfItems;
+			}
+			else
+			{
+				const glm::vec3 centroidExtent = maximumCentroid - minimumCentroid;
+				const glm::length_t axis = (centroidExtent.x >= centroidExtent.y && centroidExtent.x >= centroidExtent.z) ? 0 : ((centroidExtent.y >= centroidExtent.z) ? 1 : 2);
+				const uint32_t middleIndex = buildEntry.startIndex + numberOfItems / 2;
+				std::nth_element(buildItems.begin() + buildEntry.startIndex, buildItems.begin() + middleIndex, buildItems.begin() + buildEntry.endIndex, [axis](const BuildItem& left, const BuildItem& right)
+				{
+					return (left.minimum[axis] + left.maximum[axis]) < (right.minimum[axis] + right.maximum[axis]);
+				});
+
+				// Child nodes are stored next to each other, don't use "node" after the node array has been resized
+				const uint32_t firstChildNodeIndex = static_cast<uint32_t>(tree.nodes.size());
+				node.firstIndex = firstChildNodeIndex;
+				node.numberOfItems = 0;
+				tree.nodes.resize(tree.nodes.size() + 2);
+				tree.parentNodeIndices.resize(tree.nodes.size(), buildEntry.nodeIndex);
+				buildStack.push_back({ firstChildNodeIndex, buildEntry.startIndex, middleIndex });
+				buildStack.push_back({ firstChildNodeIndex + 1, middleIndex, buildEntry.endIndex });
+			}
+		}
+
+		// Leaves reference the scene item handles in build item order
+		uint32_t maximumHandle = 0;
+		tree.itemHandles.resize(numberOfBuildItems);
+		for (uint32_t i = 0; i < numberOfBuildItems; ++i)
+		{
+			tree.itemHandles[i] = buildItems[i].handle;
+			maximumHandle = std::max(maximumHandle, buildItems[i].handle);
+		}
+		tree.leafNodeIndexByHandle.resize(maximumHandle + 1, GetInvalid<uint32_t>());
+		const uint32_t numberOfNodes = static_cast<uint32_t>(tree.nodes.size());
+		for (uint32_t nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex)
+		{
+			const Node& node = tree.nodes[nodeIndex];
+			for (uint32_t i = 0; i < node.numberOfItems; ++i)
+			{
+				tree.leafNodeIndexByHandle[tree.itemHandles[node.firstIndex + i]] = nodeIndex;
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void SceneItemBvh::startBackgroundBuild(const SceneItemSet& sceneItemSet)
+	{
+		SE_ASSERT(!mBuildThread.joinable(), "There's already a scene item BVH background build running")
+
+		// Snapshot of the current bounding spheres, scene item changes from now on are re-applied as soon as the build has been finished
+		const uint32_t numberOfSceneItems = sceneItemSet.numberOfSceneItems;
+		mBuildItems.resize(numberOfSceneItems);
+		for (uint32_t i = 0; i < numberOfSceneItems; ++i)
+		{
+			BuildItem& buildItem = mBuildItems[i];
+			::detail::getSceneItemBounds(sceneItemSet, i, buildItem.minimum, buildItem.maximum);
+			buildItem.handle = sceneItemSet.getHandleByIndex(i);
+		}
+		mChangedHandlesSinceBuildStart.clear();
+		mBuildFinished.store(false, std::memory_order_relaxed);
+		mBuildThread = std::thread([this]()
+		{
+			buildTree(mBuildItems, mBuildTree);
+			mBuildFinished.store(true, std::memory_order_release);
+		});
+	}
+
+	void SceneItemBvh::finishBackgroundBuild(const SceneItemSet& sceneItemSet)
+	{
+		mBuildThread.join();
+
+		// Use the new tree
+		mNodes.swap(mBuildTree.nodes);
+		mParentNodeIndices.swap(mBuildTree.parentNodeIndices);
+		mItemHandles.swap(mBuildTree.itemHandles);
+		mLeafNodeIndexByHandle.swap(mBuildTree.leafNodeIndexByHandle);
+		mPendingHandles.clear();
+		mNumberOfChangesSinceBuild = 0;
+		mNumberOfBuildItems = static_cast<uint32_t>(mBuildItems.size());
+		mBuildItems.clear();
+
+		// Re-apply the scene item changes which happened during the build
+		for (uint32_t handle : mChangedHandlesSinceBuildStart)
+		{
+			if (sceneItemSet.isValidHandle(handle))
+			{
+				onSceneItemChanged(sceneItemSet, handle);
+			}
+		}
+		mChangedHandlesSinceBuildStart.clear();
+	}
+
+	void SceneItemBvh::refitLeaf(uint32_t nodeIndex, const glm::vec3& minimum, const glm::vec3& maximum)
+	{
+		// Grow the node bounds until a node already encloses the given bounds
+		while (IsValid(nodeIndex))
+		{
+			Node& node = mNodes[nodeIndex];
+			if (glm::all(glm::lessThanEqual(node.minimum, minimum)) && glm::all(glm::greaterThanEqual(node.maximum, maximum)))
+			{
+				break;
+			}
+			node.minimum = glm::min(node.minimum, minimum);
+			node.maximum = glm::max(node.maximum, maximum);
+			nodeIndex = mParentNodeIndices[nodeIndex];
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Core/GetInvalid.h"
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+class Frustum;
+namespace Renderer
+{
+	struct SceneItemSet;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Bounding volume hierarchy (BVH) broad phase over the world space bounding spheres of a scene item set
+	*
+	*  @remarks
+	*    The BVH rejects whole subtrees before the SIMD culling kernels run, which pays off for huge scenes with only a small visible fraction.
+	*    Leaves reference scene items by their stable scene item set handle. The BVH is kept up-to-date as follows:
+	*    - Moved scene items: The leaf and its parents are refitted, meaning grown, to enclose the new bounding sphere
+	*    - Added scene items: Stored inside a pending list which is tested linearly until the next rebuild
+	*    - Removed scene items: Skipped during traversal since their handle became invalid
+	*    As soon as the number of changes since the last build exceeds a fraction of the number of scene items, the BVH is rebuilt from a
+	*    snapshot inside a background thread. The previous BVH stays in use until the background build has been finished.
+	*
+	*  @note
+	*    - Except for the background build, all methods must be called by the same thread
+	*/
+	class SceneItemBvh final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MINIMUM_NUMBER_OF_SCENE_ITEMS = 4096;	// Below this number of scene items the linear SIMD culling is fast enough and no BVH is built
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_LEAF_ITEMS	= 32;	// Maximum number of scene items per leaf
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		SceneItemBvh();
+		~SceneItemBvh();
+
+		/**
+		*  @brief
+		*    Return whether or not there's a BVH which can be used for culling
+		*
+		*  @return
+		*    "true" if there's a BVH, else "false" in which case linear culling must be used
+		*/
+		[[nodiscard]] inline bool hasTree() const
+		{
+			return !mNodes.empty();
+		}
+
+		/**
+		*  @brief
+		*    Destroy the BVH, blocks until a running background build has been finished
+		*/
+		void clear();
+
+		/**
+		*  @brief
+		*    Inform the BVH that the world space bounding sphere of a scene item has been added or changed
+		*
+		*  @param[in] sceneItemSet
+		*    Scene item set the BVH is build for, the world space bounding sphere of the scene item must be up-to-date
+		*  @param[in] handle
+		*    Valid scene item set handle of the added or changed scene item
+		*/
+		void onSceneItemChanged(const SceneItemSet& sceneItemSet, uint32_t handle);
+
+		/**
+		*  @brief
+		*    Per frame update: Take over a finished background build and kick off a new background build if required
+		*
+		*  @param[in] sceneItemSet
+		*    Scene item set the BVH is build for, the world space bounding spheres of all scene items must be up-to-date
+		*/
+		void update(const SceneItemSet& sceneItemSet);
+
+		/**
+		*  @brief
+		*    Gather the indices of the scene items whose world space bounding sphere intersects the frustum
+		*
+		*  @param[in] sceneItemSet
+		*    Scene item set the BVH is build for
+		*  @param[in] worldSpaceCameraPosition
+		*    World space camera position
+		*  @param[in] frustum
+		*    Camera relative world space frustum
+		*  @param[out] outputIndirection
+		*    Receives the dense scene item set indices of the potentially visible scene items, must have room for all scene items of the scene item set
+		*
+		*  @return
+		*    The number of written scene item set indices
+		*
+		*  @note
+		*    - Must only be called if "hasTree()" returns "true"
+		*    - Scene items are tested against their bounding sphere in the same way as the SIMD frustum-sphere culling kernel does
+		*/
+		[[nodiscard]] uint32_t gatherVisibleSceneItems(const SceneItemSet& sceneItemSet, const glm::vec3& worldSpaceCameraPosition, const Frustum& frustum, uint32_t* outputIndirection) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t PENDING_LEAF_NODE_INDEX = std::numeric_limits<uint32_t>::max() - 1;	// Scene item is inside the pending list
+		struct Node final
+		{
+			glm::vec3 minimum;
+			uint32_t  firstIndex;		// Inner node: Index of the first of the two child nodes, leaf: Index of the first scene item handle
+			glm::vec3 maximum;
+			uint32_t  numberOfItems;	// 0 for inner nodes
+		};
+		struct BuildItem final
+		{
+			glm::vec3 minimum;
+			glm::vec3 maximum;
+			uint32_t  handle;
+		};
+		typedef std::vector<Node>	   Nodes;
+		typedef std::vector<uint32_t>  Indices;
+		typedef std::vector<BuildItem> BuildItems;
+		struct Tree final
+		{
+			Nodes	nodes;
+			Indices	parentNodeIndices;
+			Indices	itemHandles;
+			Indices	leafNodeIndexByHandle;	// Invalid for handles which aren't inside the tree
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		static void buildTree(BuildItems& buildItems, Tree& tree);
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit SceneItemBvh(const SceneItemBvh&) = delete;
+		SceneItemBvh& operator=(const SceneItemBvh&) = delete;
+		void startBackgroundBuild(const SceneItemSet& sceneItemSet);
+		void finishBackgroundBuild(const SceneItemSet& sceneItemSet);
+		void refitLeaf(uint32_t nodeIndex, const glm::vec3& minimum, const glm::vec3& maximum);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Tree in use
+		Nodes	mNodes;
+		Indices	mParentNodeIndices;
+		Indices	mItemHandles;
+		Indices	mLeafNodeIndexByHandle;
+		Indices	mPendingHandles;				// Handles of scene items added after the last build was started, tested linearly
+		uint32_t mNumberOfChangesSinceBuild;	// Number of refitted and pending scene items since the tree in use was build
+		uint32_t mNumberOfBuildItems;			// Number of scene items the tree in use was build for
+		// Background build
+		std::thread		  mBuildThread;
+		std::atomic<bool> mBuildFinished;
+		BuildItems		  mBuildItems;
+		Tree			  mBuildTree;
+		Indices			  mChangedHandlesSinceBuildStart;	// Handles of scene items changed while the background build is running, re-applied to the new tree
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
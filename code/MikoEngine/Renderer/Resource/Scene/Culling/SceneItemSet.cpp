@@ -0,0 +1,211 @@
+#include "stdafx.h"
+#include "Renderer/Resource/Scene/Culling/SceneItemSet.h"
+#include "Math/Math.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef Renderer::SceneItemSet::FloatVector Renderer::SceneItemSet::* FloatVectorMember;
+		struct FloatVectorDefault final
+		{
+			FloatVectorMember floatVector;
+			float			  defaultValue;
+		};
+		static constexpr FloatVectorDefault FLOAT_VECTOR_DEFAULTS[] =
+		{
+			// Minimum object space bounding box corner position
+			{ &Renderer::SceneItemSet::minimumX, -0.5f },
+			{ &Renderer::SceneItemSet::minimumY, -0.5f },
+			{ &Renderer::SceneItemSet::minimumZ, -0.5f },
+
+			// Maximum object space bounding box corner position
+			{ &Renderer::SceneItemSet::maximumX, 0.5f },
+			{ &Renderer::SceneItemSet::maximumY, 0.5f },
+			{ &Renderer::SceneItemSet::maximumZ, 0.5f },
+
+			// Object space to world space matrix
+			{ &Renderer::SceneItemSet::worldXX, 1.0f },
+			{ &Renderer::SceneItemSet::worldXY, 0.0f },
+			{ &Renderer::SceneItemSet::worldXZ, 0.0f },
+			{ &Renderer::SceneItemSet::worldXW, 0.0f },
+			{ &Renderer::SceneItemSet::worldYX, 0.0f },
+			{ &Renderer::SceneItemSet::worldYY, 1.0f },
+			{ &Renderer::SceneItemSet::worldYZ, 0.0f },
+			{ &Renderer::SceneItemSet::worldYW, 0.0f },
+			{ &Renderer::SceneItemSet::worldZX, 0.0f },
+			{ &Renderer::SceneItemSet::worldZY, 0.0f },
+			{ &Renderer::SceneItemSet::worldZZ, 1.0f },
+			{ &Renderer::SceneItemSet::worldZW, 0.0f },
+			{ &Renderer::SceneItemSet::worldWX, 0.0f },
+			{ &Renderer::SceneItemSet::worldWY, 0.0f },
+			{ &Renderer::SceneItemSet::worldWZ, 0.0f },
+			{ &Renderer::SceneItemSet::worldWW, 1.0f },
+
+			// World space center position of bounding sphere
+			{ &Renderer::SceneItemSet::spherePositionX, 0.0f },
+			{ &Renderer::SceneItemSet::spherePositionY, 0.0f },
+			{ &Renderer::SceneItemSet::spherePositionZ, 0.0f },
+
+			// Negative world space radius of bounding sphere
+			{ &Renderer::SceneItemSet::negativeRadius, -1.0f }
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint32_t getPaddedSize(uint32_t numberOfSceneItems)
+		{
+			// Take alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") of the next SIMD batch into account
+			return Math::makeMultipleOf(numberOfSceneItems, Renderer::SceneItemSet::SIMD_LANE_COUNT) + Renderer::SceneItemSet::SIMD_LANE_COUNT;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	uint32_t SceneItemSet::addSceneItem(ISceneItem& sceneItem)
+	{
+		// Get a handle
+		uint32_t handle = GetInvalid<uint32_t>();
+		if (mFreeHandles.empty())
+		{
+			handle = static_cast<uint32_t>(mHandleToIndex.size());
+			mHandleToIndex.push_back(GetInvalid<uint32_t>());
+			mHandleDirty.push_back(false);
+		}
+		else
+		{
+			handle = mFreeHandles.back();
+			mFreeHandles.pop_back();
+		}
+
+		// Ensure the data arrays are padded to the SIMD lane count, they only grow when a SIMD batch boundary is crossed
+		const uint32_t index = numberOfSceneItems;
+		++numberOfSceneItems;
+		const uint32_t paddedSize = ::detail::getPaddedSize(numberOfSceneItems);
+		if (sceneItemVector.size() < paddedSize)
+		{
+			resizeDataArrays(paddedSize);
+		}
+
+		// Setup the scene item data
+		mHandleToIndex[handle] = index;
+		mIndexToHandle.push_back(handle);
+		setDefaultData(index);
+		sceneItemVector[index] = &sceneItem;
+		setDirty(handle);
+
+		// Done
+		return handle;
+	}
+
+	void SceneItemSet::removeSceneItem(uint32_t handle)
+	{
+		const uint32_t index = getIndexByHandle(handle);
+		const uint32_t lastIndex = numberOfSceneItems - 1;
+
+		// Swap-remove: Move the last scene item into the freed slot to keep the data arrays tightly packed
+		if (index != lastIndex)
+		{
+			copyData(lastIndex, index);
+			const uint32_t lastHandle = mIndexToHandle[lastIndex];
+			mIndexToHandle[index] = lastHandle;
+			mHandleToIndex[lastHandle] = index;
+		}
+
+		// Reset the now unused last slot to padding data
+		setDefaultData(lastIndex);
+		sceneItemVector[lastIndex] = nullptr;
+		mIndexToHandle.pop_back();
+		--numberOfSceneItems;
+
+		// Free the handle, a dirty handle stays inside the dirty handles list until the next "Renderer::SceneItemSet::clearDirtyHandles()" call
+		SetInvalid(mHandleToIndex[handle]);
+		mFreeHandles.push_back(handle);
+	}
+
+	void SceneItemSet::clear()
+	{
+		numberOfSceneItems = 0;
+		resizeDataArrays(0);
+		mHandleToIndex.clear();
+		mIndexToHandle.clear();
+		mFreeHandles.clear();
+		mDirtyHandles.clear();
+		mHandleDirty.clear();
+	}
+
+	void SceneItemSet::clearDirtyHandles()
+	{
+		for (uint32_t handle : mDirtyHandles)
+		{
+			mHandleDirty[handle] = false;
+		}
+		mDirtyHandles.clear();
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void SceneItemSet::resizeDataArrays(uint32_t size)
+	{
+		for (const ::detail::FloatVectorDefault& floatVectorDefault : ::detail::FLOAT_VECTOR_DEFAULTS)
+		{
+			(this->*floatVectorDefault.floatVector).resize(size, floatVectorDefault.defaultValue);
+		}
+		visibilityFlag.resize(size, 0);
+		projectedRadius.resize(size, 0.0f);
+		sceneItemVector.resize(size, nullptr);
+	}
+
+	void SceneItemSet::setDefaultData(uint32_t index)
+	{
+		for (const ::detail::FloatVectorDefault& floatVectorDefault : ::detail::FLOAT_VECTOR_DEFAULTS)
+		{
+			(this->*floatVectorDefault.floatVector)[index] = floatVectorDefault.defaultValue;
+		}
+		visibilityFlag[index] = 0;
+	}
+
+	void SceneItemSet::copyData(uint32_t sourceIndex, uint32_t destinationIndex)
+	{
+		for (const ::detail::FloatVectorDefault& floatVectorDefault : ::detail::FLOAT_VECTOR_DEFAULTS)
+		{
+			FloatVector& floatVector = this->*floatVectorDefault.floatVector;
+			floatVector[destinationIndex] = floatVector[sourceIndex];
+		}
+		visibilityFlag[destinationIndex] = visibilityFlag[sourceIndex];
+		sceneItemVector[destinationIndex] = sceneItemVector[sourceIndex];
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
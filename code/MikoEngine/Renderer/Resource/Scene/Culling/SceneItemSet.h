@@ -20,12 +20,14 @@ SE_PRAGMA_WARNING_PUSH
 	SE_PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	SE_PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
 	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
-	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// TODO(co) How to use xsimd correctly to get rid of errors like "error C2440: 'initializing': cannot convert from 'xsimd::simd_batch_traits<xsimd::batch<float,8>>::batch_bool_type' to 'xsimd::batch_bool<float,4>'" when using "Advanced Vector Extensions 2 (/arch:AVX2)"?
 	#include <xsimd/xsimd.hpp>
 SE_PRAGMA_WARNING_POP
 
 #include <vector>
 
+#include "Renderer/Resource/Scene/Culling/SceneCullingKernels.h"
+#include "Core/GetInvalid.h"
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -48,7 +50,14 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Scene item set
+	*    Persistent structure-of-arrays scene item set
+	*
+	*  @remarks
+	*    Scene items are referenced by stable handles, the dense index of a scene item inside the data arrays can change when another scene item
+	*    gets removed (swap-remove keeps the data arrays tightly packed). The data arrays are always padded to the SIMD lane count plus one
+	*    additional SIMD batch for prefetching, so the culling kernels can work on the data arrays as they are. Transform changes only mark a
+	*    scene item as dirty, the world space data of dirty scene items is written once before culling. Scenes with mostly static scene items
+	*    hence don't touch the data arrays at all.
 	*
 	*  @note
 	*    - Basing on "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html
@@ -60,10 +69,128 @@ namespace Renderer
 		//[-------------------------------------------------------]
 		//[ Public definitions                                    ]
 		//[-------------------------------------------------------]
-		typedef std::vector<float, xsimd::aligned_allocator<float, XSIMD_DEFAULT_ALIGNMENT>>			 FloatVector;
-		typedef std::vector<double, xsimd::aligned_allocator<double, XSIMD_DEFAULT_ALIGNMENT>>			 DoubleVector;
-		typedef std::vector<uint32_t, xsimd::aligned_allocator<uint32_t, XSIMD_DEFAULT_ALIGNMENT>>		 IntegerVector;
-		typedef std::vector<ISceneItem*, xsimd::aligned_allocator<ISceneItem*, XSIMD_DEFAULT_ALIGNMENT>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
+		typedef std::vector<float, xsimd::aligned_allocator<float, SceneCullingKernels::SIMD_ALIGNMENT>>			 FloatVector;
+		typedef std::vector<double, xsimd::aligned_allocator<double, SceneCullingKernels::SIMD_ALIGNMENT>>			 DoubleVector;
+		typedef std::vector<uint32_t, xsimd::aligned_allocator<uint32_t, SceneCullingKernels::SIMD_ALIGNMENT>>		 IntegerVector;
+		typedef std::vector<ISceneItem*, xsimd::aligned_allocator<ISceneItem*, SceneCullingKernels::SIMD_ALIGNMENT>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
+		typedef std::vector<uint32_t> Handles;
+		static constexpr uint32_t SIMD_LANE_COUNT = SceneCullingKernels::MAXIMUM_SIMD_LANE_COUNT;	// Data arrays are padded for the widest scene culling kernels
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Add a scene item
+		*
+		*  @param[in] sceneItem
+		*    Scene item to add, the scene item set keeps a reference to the scene item
+		*
+		*  @return
+		*    Stable handle of the added scene item, the scene item starts dirty
+		*/
+		[[nodiscard]] uint32_t addSceneItem(ISceneItem& sceneItem);
+
+		/**
+		*  @brief
+		*    Remove a scene item
+		*
+		*  @param[in] handle
+		*    Handle of the scene item to remove, must be valid, the handle is invalid after this call
+		*
+		*  @note
+		*    - Swap-remove: The last scene item is moved into the freed slot
+		*/
+		void removeSceneItem(uint32_t handle);
+
+		/**
+		*  @brief
+		*    Remove all scene items
+		*/
+		void clear();
+
+		/**
+		*  @brief
+		*    Return the current dense data array index of the scene item with the given handle
+		*
+		*  @param[in] handle
+		*    Scene item handle, must be valid
+		*
+		*  @return
+		*    The current dense data array index, only valid until a scene item gets removed
+		*/
+		[[nodiscard]] inline uint32_t getIndexByHandle(uint32_t handle) const
+		{
+			SE_ASSERT(handle < mHandleToIndex.size() && IsValid(mHandleToIndex[handle]), "Invalid scene item set handle")
+			return mHandleToIndex[handle];
+		}
+
+		/**
+		*  @brief
+		*    Return the handle of the scene item at the given dense data array index
+		*
+		*  @param[in] index
+		*    Dense data array index, must be below "numberOfSceneItems"
+		*
+		*  @return
+		*    The stable scene item handle
+		*/
+		[[nodiscard]] inline uint32_t getHandleByIndex(uint32_t index) const
+		{
+			SE_ASSERT(index < numberOfSceneItems, "Invalid scene item set index")
+			return mIndexToHandle[index];
+		}
+
+		/**
+		*  @brief
+		*    Mark the world space data of the scene item with the given handle as dirty
+		*
+		*  @param[in] handle
+		*    Scene item handle, must be valid
+		*/
+		inline void setDirty(uint32_t handle)
+		{
+			SE_ASSERT(handle < mHandleToIndex.size() && IsValid(mHandleToIndex[handle]), "Invalid scene item set handle")
+			if (!mHandleDirty[handle])
+			{
+				mHandleDirty[handle] = true;
+				mDirtyHandles.push_back(handle);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the handles of the scene items which are marked as dirty
+		*
+		*  @return
+		*    The handles of the scene items which are marked as dirty, might contain handles which became invalid in the meantime
+		*/
+		[[nodiscard]] inline const Handles& getDirtyHandles() const
+		{
+			return mDirtyHandles;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the given handle is valid
+		*
+		*  @param[in] handle
+		*    Scene item handle to check
+		*
+		*  @return
+		*    "true" if the handle is valid, else "false"
+		*/
+		[[nodiscard]] inline bool isValidHandle(uint32_t handle) const
+		{
+			return (handle < mHandleToIndex.size() && IsValid(mHandleToIndex[handle]));
+		}
+
+		/**
+		*  @brief
+		*    Clear the dirty state of all scene items, call this after the world space data of the dirty scene items has been written
+		*/
+		void clearDirtyHandles();
 
 
 		//[-------------------------------------------------------]
@@ -110,10 +237,33 @@ namespace Renderer
 		// Flag to indicate if an object is culled or not
 		IntegerVector visibilityFlag;
 
+		// Projected bounding sphere radius in pixels written by the contribution culling, compacted meaning indexed by indirection index
+		FloatVector projectedRadius;
+
 		// The type and ID of an object
 		SceneItemVector sceneItemVector;
 
-		uint32_t numberOfSceneItems = 0;
+		uint32_t numberOfSceneItems = 0;	// Number of scene items, the data arrays are padded beyond this number, don't modify it directly
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+	private:
+		void resizeDataArrays(uint32_t size);
+		void setDefaultData(uint32_t index);
+		void copyData(uint32_t sourceIndex, uint32_t destinationIndex);
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+	private:
+		Handles			  mHandleToIndex;	// Handle to dense data array index, invalid index for free handles
+		Handles			  mIndexToHandle;	// Dense data array index to handle
+		Handles			  mFreeHandles;		// Handles available for reuse
+		Handles			  mDirtyHandles;	// Handles of the scene items with dirty world space data
+		std::vector<bool> mHandleDirty;		// Per handle dirty state, avoids duplicates inside the dirty handles list
 
 
 	};
@@ -157,8 +157,8 @@ namespace Renderer
 	private:
 		SceneResource& mSceneResource;
 		SceneNode*	   mParentSceneNode;		// Parent scene node, can be a null pointer, don't destroy the instance
-		SceneItemSet*  mSceneItemSet;			// Scene item set, always valid, don't destroy the instance
-		uint32_t	   mSceneItemSetIndex;		// Index inside the scene item set
+		SceneItemSet*  mSceneItemSet;			// Scene item set, can be a null pointer for uncullable scene items, don't destroy the instance
+		uint32_t	   mSceneItemSetHandle;		// Handle inside the scene item set, invalid if there's no scene item set
 		bool		   mCallExecuteOnRendering;	// Call execute on rendering? ("Renderer::ISceneItem::onExecuteOnRendering()") Keep this disabled if not needed not waste performance.
 
 
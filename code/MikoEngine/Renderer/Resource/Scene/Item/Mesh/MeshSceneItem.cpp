@@ -9,12 +9,6 @@
 #include "Renderer/Resource/Material/MaterialResourceManager.h"
 #include "Renderer/IRenderer.h"
 
-// Disable warnings in external headers, we can't fix them
-SE_PRAGMA_WARNING_PUSH
-	SE_PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
-	#include <glm/gtx/component_wise.hpp>
-SE_PRAGMA_WARNING_POP
-
 #include <algorithm>
 
 
@@ -114,52 +108,27 @@ namespace Renderer
 				RenderableManager::Renderables& renderables = mRenderableManager.getRenderables();
 				renderables.clear();
 
-				// Set scene item set bounding data
-				// TODO(co) The following is just for culling kickoff and won't stay this way
+				// Set scene item set bounding data, the world space bounding sphere is written by the scene culling manager for dirty scene items
 				if (nullptr != mSceneItemSet)
 				{
-					const SceneNode* parentSceneNode = getParentSceneNode();
+					const uint32_t sceneItemSetIndex = mSceneItemSet->getIndexByHandle(mSceneItemSetHandle);
 
 					{ // Set minimum object space bounding box corner position
 						const glm::vec3& minimumBoundingBoxPosition = meshResource.getMinimumBoundingBoxPosition();
-						mSceneItemSet->minimumX[mSceneItemSetIndex] = minimumBoundingBoxPosition.x;
-						mSceneItemSet->minimumY[mSceneItemSetIndex] = minimumBoundingBoxPosition.y;
-						mSceneItemSet->minimumZ[mSceneItemSetIndex] = minimumBoundingBoxPosition.z;
+						mSceneItemSet->minimumX[sceneItemSetIndex] = minimumBoundingBoxPosition.x;
+						mSceneItemSet->minimumY[sceneItemSetIndex] = minimumBoundingBoxPosition.y;
+						mSceneItemSet->minimumZ[sceneItemSetIndex] = minimumBoundingBoxPosition.z;
 					}
 
 					{ // Set maximum object space bounding box corner position
 						const glm::vec3& maximumBoundingBoxPosition = meshResource.getMaximumBoundingBoxPosition();
-						mSceneItemSet->maximumX[mSceneItemSetIndex] = maximumBoundingBoxPosition.x;
-						mSceneItemSet->maximumY[mSceneItemSetIndex] = maximumBoundingBoxPosition.y;
-						mSceneItemSet->maximumZ[mSceneItemSetIndex] = maximumBoundingBoxPosition.z;
-					}
-
-					{ // Set world space center position of bounding sphere
-						const glm::vec3& boundingSpherePosition = meshResource.getBoundingSpherePosition();
-						if (nullptr != parentSceneNode)
-						{
-							const glm::vec3& position = parentSceneNode->getTransform().position;
-							const glm::vec3& scale = parentSceneNode->getTransform().scale;
-							mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x * scale.x + position.x;
-							mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y * scale.y + position.y;
-							mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z * scale.z + position.z;
-						}
-						else
-						{
-							mSceneItemSet->spherePositionX[mSceneItemSetIndex] = boundingSpherePosition.x;
-							mSceneItemSet->spherePositionY[mSceneItemSetIndex] = boundingSpherePosition.y;
-							mSceneItemSet->spherePositionZ[mSceneItemSetIndex] = boundingSpherePosition.z;
-						}
+						mSceneItemSet->maximumX[sceneItemSetIndex] = maximumBoundingBoxPosition.x;
+						mSceneItemSet->maximumY[sceneItemSetIndex] = maximumBoundingBoxPosition.y;
+						mSceneItemSet->maximumZ[sceneItemSetIndex] = maximumBoundingBoxPosition.z;
 					}
 
-					{ // Set negative world space radius of bounding sphere
-						float boundingSphereRadius = meshResource.getBoundingSphereRadius();
-						if (nullptr != parentSceneNode)
-						{
-							boundingSphereRadius *= glm::compMax(parentSceneNode->getTransform().scale);
-						}
-						mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -boundingSphereRadius;
-					}
+					// The bounding sphere depends on the mesh resource
+					mSceneItemSet->setDirty(mSceneItemSetHandle);
 				}
 
 				// Fill renderable manager
@@ -226,6 +195,13 @@ namespace Renderer
 				}
 			}
 		}
+		else if (resource.getLoadingState() == IResource::LoadingState::UNLOADED && resource.getId() == mMeshResourceId)
+		{
+			// The mesh resource was evicted by the mesh resource manager, release the vertex array object references so the memory gets freed
+			// -> The scene item set bounding data stays as it is, the scene culling keeps telling the mesh resource manager when the mesh is needed again
+			mRenderableManager.getRenderables().clear();
+			mRenderableManager.updateCachedRenderablesData();
+		}
 	}
 
 
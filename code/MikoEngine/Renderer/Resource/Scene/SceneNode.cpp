@@ -1,18 +1,7 @@
 #include "stdafx.h"
 #include "Renderer/Resource/Scene/SceneNode.h"
-#include "Renderer/Resource/Scene/SceneResource.h"
 #include "Renderer/Resource/Scene/Item/ISceneItem.h"
-#include "Renderer/Resource/Scene/Item/Mesh/MeshSceneItem.h"
 #include "Renderer/Resource/Scene/Culling/SceneItemSet.h"
-#include "Renderer/Resource/Mesh/MeshResourceManager.h"
-#include "Renderer/Resource/Mesh/MeshResource.h"
-#include "Renderer/IRenderer.h"
-
-// Disable warnings in external headers, we can't fix them
-SE_PRAGMA_WARNING_PUSH
-	SE_PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
-	#include <glm/gtx/component_wise.hpp>
-SE_PRAGMA_WARNING_POP
 
 
 //[-------------------------------------------------------]
@@ -67,6 +56,9 @@ namespace Renderer
 		for (ISceneItem* sceneItem : mAttachedSceneItems)
 		{
 			sceneItem->onDetachedFromSceneNode(*this);
+
+			// Without a parent scene node the world space data falls back to the object space data
+			updateSceneItemTransform(*sceneItem);
 		}
 		mAttachedSceneItems.clear();
 	}
@@ -116,65 +108,11 @@ namespace Renderer
 
 	void SceneNode::updateSceneItemTransform(ISceneItem& sceneItem)
 	{
-		// TODO(co) The following is just for culling kickoff and won't stay this way
+		// Just mark the scene item as dirty, the scene culling manager writes the world space data of dirty scene items once before culling
 		SceneItemSet* sceneItemSet = sceneItem.mSceneItemSet;
 		if (nullptr != sceneItemSet)
 		{
-			const uint32_t sceneItemSetIndex = sceneItem.mSceneItemSetIndex;
-
-			{ // Set object space to world space matrix
-				glm::mat4 objectSpaceToWorldSpace;
-				mGlobalTransform.getAsMatrix(objectSpaceToWorldSpace);
-				sceneItemSet->worldXX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][0];
-				sceneItemSet->worldXY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][0];
-				sceneItemSet->worldXZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][0];
-				sceneItemSet->worldXW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][0];
-				sceneItemSet->worldYX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][1];
-				sceneItemSet->worldYY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][1];
-				sceneItemSet->worldYZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][1];
-				sceneItemSet->worldYW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][1];
-				sceneItemSet->worldZX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][2];
-				sceneItemSet->worldZY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][2];
-				sceneItemSet->worldZZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][2];
-				sceneItemSet->worldZW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][2];
-				sceneItemSet->worldWX[sceneItemSetIndex] = objectSpaceToWorldSpace[0][3];
-				sceneItemSet->worldWY[sceneItemSetIndex] = objectSpaceToWorldSpace[1][3];
-				sceneItemSet->worldWZ[sceneItemSetIndex] = objectSpaceToWorldSpace[2][3];
-				sceneItemSet->worldWW[sceneItemSetIndex] = objectSpaceToWorldSpace[3][3];
-			}
-
-			if (sceneItem.getSceneItemTypeId() == MeshSceneItem::TYPE_ID)
-			{
-				const MeshResource* meshResource = sceneItem.getSceneResource().getRenderer().getMeshResourceManager().tryGetById(static_cast<MeshSceneItem&>(sceneItem).getMeshResourceId());
-				if (nullptr != meshResource)
-				{
-					{ // Set world space center position of bounding sphere
-						const glm::vec3& boundingSpherePosition = meshResource->getBoundingSpherePosition();
-						const glm::dvec3& position = mGlobalTransform.position;
-						const glm::vec3& scale = mGlobalTransform.scale;
-						sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.x * scale.x + position.x);
-						sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.y * scale.y + position.y);
-						sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(boundingSpherePosition.z * scale.z + position.z);
-					}
-
-					// Set negative world space radius of bounding sphere
-					sceneItemSet->negativeRadius[sceneItemSetIndex] = -meshResource->getBoundingSphereRadius() * glm::compMax(mGlobalTransform.scale);
-				}
-				else
-				{
-					// Set world space center position of bounding sphere
-					sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.x);
-					sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.y);
-					sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.z);
-				}
-			}
-			else
-			{
-				// Set world space center position of bounding sphere
-				sceneItemSet->spherePositionX[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.x);
-				sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.y);
-				sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.z);
-			}
+			sceneItemSet->setDirty(sceneItem.mSceneItemSetHandle);
 		}
 	}
 
@@ -18,7 +18,7 @@ namespace Renderer
 	class SceneResource;
 	class IRenderer;
 	class SceneResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 }
 
 
@@ -67,7 +67,7 @@ namespace Renderer
 		void setSceneFactory(const ISceneFactory* sceneFactory);
 		[[nodiscard]] SceneResource* getSceneResourceByAssetId(AssetId assetId) const;		// Considered to be inefficient, avoid method whenever possible
 		[[nodiscard]] SceneResourceId getSceneResourceIdByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
-		void loadSceneResourceByAssetId(AssetId assetId, SceneResourceId& sceneResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>());	// Asynchronous
+		void loadSceneResourceByAssetId(AssetId assetId, SceneResourceId& sceneResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>(), ResourceLoadPriority priority = ResourceLoadPriority::PREFETCH);	// Asynchronous
 		void destroySceneResource(SceneResourceId sceneResourceId);
 		void setInvalidResourceId(SceneResourceId& sceneResourceId, IResourceListener& resourceListener) const;
 
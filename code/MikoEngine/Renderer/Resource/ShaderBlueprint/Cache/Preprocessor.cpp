@@ -1,12 +1,451 @@
 #include "stdafx.h"
 #include "Renderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
-#define MOJOSHADER_NO_VERSION_INCLUDE
 #include "Renderer/IRenderer.h"
 #include "Renderer/Context.h"
 
-#include <MojoShader/mojoshader.h>
 
-#include <cstring>	// For "strlen()"
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] inline bool isSpace(char character)
+		{
+			// New line is not considered to be a space by intent, lines are significant for the preprocessor
+			return (' ' == character || '\t' == character || '\r' == character || '\f' == character || '\v' == character);
+		}
+
+		[[nodiscard]] inline bool isDigit(char character)
+		{
+			return (character >= '0' && character <= '9');
+		}
+
+		[[nodiscard]] inline bool isIdentifierStart(char character)
+		{
+			return ((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') || '_' == character);
+		}
+
+		[[nodiscard]] inline bool isIdentifierCharacter(char character)
+		{
+			return (isIdentifierStart(character) || isDigit(character));
+		}
+
+		[[nodiscard]] std::string_view trim(std::string_view text)
+		{
+			// Macro arguments can span multiple lines, so new lines are trimmed as well
+			while (!text.empty() && (isSpace(text.front()) || '\n' == text.front()))
+			{
+				text.remove_prefix(1);
+			}
+			while (!text.empty() && (isSpace(text.back()) || '\n' == text.back()))
+			{
+				text.remove_suffix(1);
+			}
+			return text;
+		}
+
+		[[nodiscard]] size_t skipSpaces(std::string_view text, size_t position)
+		{
+			while (position < text.size() && isSpace(text[position]))
+			{
+				++position;
+			}
+			return position;
+		}
+
+		[[nodiscard]] size_t skipIdentifier(std::string_view text, size_t position)
+		{
+			while (position < text.size() && isIdentifierCharacter(text[position]))
+			{
+				++position;
+			}
+			return position;
+		}
+
+		[[nodiscard]] size_t skipNumber(std::string_view text, size_t position)
+		{
+			// Preprocessing number, e.g. "1.0f", "0x1F", "2u" or "1.0e+X", identifier characters inside a number are never macros
+			// -> A sign directly following an exponent character ("e", "E", "p" or "P") is part of the preprocessing number
+			const size_t startPosition = position;
+			while (position < text.size())
+			{
+				const char character = text[position];
+				if (isIdentifierCharacter(character) || '.' == character)
+				{
+					++position;
+				}
+				else if (('+' == character || '-' == character) && position > startPosition &&
+						 ('e' == text[position - 1] || 'E' == text[position - 1] || 'p' == text[position - 1] || 'P' == text[position - 1]))
+				{
+					++position;
+				}
+				else
+				{
+					break;
+				}
+			}
+			return position;
+		}
+
+		[[nodiscard]] size_t skipStringLiteral(std::string_view text, size_t position)
+		{
+			// The given position is the one of the opening quotation mark or apostrophe, the returned position is behind the closing one
+			const char quoteCharacter = text[position];
+			++position;
+			while (position < text.size() && quoteCharacter != text[position] && '\n' != text[position])
+			{
+				position += ('\\' == text[position] && position + 1 < text.size()) ? 2 : 1;
+			}
+			return (position < text.size() && quoteCharacter == text[position]) ? (position + 1) : position;
+		}
+
+		void trimTrailingSpaces(std::string& text)
+		{
+			while (!text.empty() && isSpace(text.back()))
+			{
+				text.pop_back();
+			}
+		}
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Evaluates the already macro expanded integer expression of "#if" and "#elif"
+		*
+		*  @note
+		*    - Identifiers left after the macro expansion are evaluated as zero, just like a C-preprocessor does
+		*/
+		class ExpressionEvaluator final
+		{
+		public:
+			inline explicit ExpressionEvaluator(std::string_view expression) :
+				mExpression(expression),
+				mPosition(0),
+				mErrorMessage(nullptr)
+			{
+				// Nothing here
+			}
+
+			[[nodiscard]] inline const char* getErrorMessage() const
+			{
+				return mErrorMessage;
+			}
+
+			[[nodiscard]] int64_t evaluate()
+			{
+				const int64_t value = parseConditional();
+				mPosition = skipSpaces(mExpression, mPosition);
+				if (nullptr == mErrorMessage && mPosition < mExpression.size())
+				{
+					mErrorMessage = "Unexpected token inside expression";
+				}
+				return value;
+			}
+
+		private:
+			// Operator precedences, higher binds stronger
+			enum Operator
+			{
+				NONE,
+				LOGICAL_OR, LOGICAL_AND, BITWISE_OR, BITWISE_XOR, BITWISE_AND, EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL,
+				SHIFT_LEFT, SHIFT_RIGHT, ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULO
+			};
+
+			[[nodiscard]] static int getPrecedence(Operator binaryOperator)
+			{
+				switch (binaryOperator)
+				{
+					case LOGICAL_OR:
+						return 1;
+
+					case LOGICAL_AND:
+						return 2;
+
+					case BITWISE_OR:
+						return 3;
+
+					case BITWISE_XOR:
+						return 4;
+
+					case BITWISE_AND:
+						return 5;
+
+					case EQUAL:
+					case NOT_EQUAL:
+						return 6;
+
+					case LESS:
+					case LESS_EQUAL:
+					case GREATER:
+					case GREATER_EQUAL:
+						return 7;
+
+					case SHIFT_LEFT:
+					case SHIFT_RIGHT:
+						return 8;
+
+					case ADD:
+					case SUBTRACT:
+						return 9;
+
+					case MULTIPLY:
+					case DIVIDE:
+					case MODULO:
+						return 10;
+
+					case NONE:
+					default:
+						return 0;
+				}
+			}
+
+			[[nodiscard]] inline bool consume(char character)
+			{
+				mPosition = skipSpaces(mExpression, mPosition);
+				if (mPosition < mExpression.size() && mExpression[mPosition] == character)
+				{
+					++mPosition;
+					return true;
+				}
+				return false;
+			}
+
+			[[nodiscard]] Operator peekBinaryOperator(size_t& length)
+			{
+				mPosition = skipSpaces(mExpression, mPosition);
+				length = 1;
+				if (mPosition >= mExpression.size())
+				{
+					return NONE;
+				}
+				const char first = mExpression[mPosition];
+				const char second = (mPosition + 1 < mExpression.size()) ? mExpression[mPosition + 1] : '\0';
+				switch (first)
+				{
+					case '|':
+						if ('|' == second)
+						{
+							length = 2;
+							return LOGICAL_OR;
+						}
+						return BITWISE_OR;
+
+					case '&':
+						if ('&' == second)
+						{
+							length = 2;
+							return LOGICAL_AND;
+						}
+						return BITWISE_AND;
+
+					case '^':
+						return BITWISE_XOR;
+
+					case '=':
+						if ('=' == second)
+						{
+							length = 2;
+							return EQUAL;
+						}
+						return NONE;
+
+					case '!':
+						if ('=' == second)
+						{
+							length = 2;
+							return NOT_EQUAL;
+						}
+						return NONE;
+
+					case '<':
+						if ('=' == second || '<' == second)
+						{
+							length = 2;
+							return ('=' == second) ? LESS_EQUAL : SHIFT_LEFT;
+						}
+						return LESS;
+
+					case '>':
+						if ('=' == second || '>' == second)
+						{
+							length = 2;
+							return ('=' == second) ? GREATER_EQUAL : SHIFT_RIGHT;
+						}
+						return GREATER;
+
+					case '+':
+						return ADD;
+
+					case '-':
+						return SUBTRACT;
+
+					case '*':
+						return MULTIPLY;
+
+					case '/':
+						return DIVIDE;
+
+					case '%':
+						return MODULO;
+
+					default:
+						return NONE;
+				}
+			}
+
+			[[nodiscard]] int64_t parseConditional()
+			{
+				const int64_t condition = parseBinary(1);
+				if (consume('?'))
+				{
+					const int64_t trueValue = parseConditional();
+					if (!consume(':'))
+					{
+						setError("Missing \":\" inside conditional expression");
+						return 0;
+					}
+					const int64_t falseValue = parseConditional();
+					return (0 != condition) ? trueValue : falseValue;
+				}
+				return condition;
+			}
+
+			[[nodiscard]] int64_t parseBinary(int minimumPrecedence)
+			{
+				int64_t left = parseUnary();
+				size_t length = 0;
+				Operator binaryOperator = peekBinaryOperator(length);
+				while (nullptr == mErrorMessage && NONE != binaryOperator && getPrecedence(binaryOperator) >= minimumPrecedence)
+				{
+					mPosition += length;
+					const int64_t right = parseBinary(getPrecedence(binaryOperator) + 1);
+					switch (binaryOperator)
+					{
+						case LOGICAL_OR:	left = (0 != left || 0 != right);	break;
+						case LOGICAL_AND:	left = (0 != left && 0 != right);	break;
+						case BITWISE_OR:	left = left | right;				break;
+						case BITWISE_XOR:	left = left ^ right;				break;
+						case BITWISE_AND:	left = left & right;				break;
+						case EQUAL:			left = (left == right);				break;
+						case NOT_EQUAL:		left = (left != right);				break;
+						case LESS:			left = (left < right);				break;
+						case LESS_EQUAL:	left = (left <= right);				break;
+						case GREATER:		left = (left > right);				break;
+						case GREATER_EQUAL:	left = (left >= right);				break;
+						case SHIFT_LEFT:	left = left << right;				break;
+						case SHIFT_RIGHT:	left = left >> right;				break;
+						case ADD:			left = left + right;				break;
+						case SUBTRACT:		left = left - right;				break;
+						case MULTIPLY:		left = left * right;				break;
+
+						case DIVIDE:
+						case MODULO:
+							if (0 == right)
+							{
+								setError("Division by zero inside expression");
+								return 0;
+							}
+							left = (DIVIDE == binaryOperator) ? (left / right) : (left % right);
+							break;
+
+						case NONE:
+						default:
+							break;
+					}
+					binaryOperator = peekBinaryOperator(length);
+				}
+				return left;
+			}
+
+			[[nodiscard]] int64_t parseUnary()
+			{
+				mPosition = skipSpaces(mExpression, mPosition);
+				if (mPosition >= mExpression.size())
+				{
+					setError("Unexpected end of expression");
+					return 0;
+				}
+				const char character = mExpression[mPosition];
+				switch (character)
+				{
+					case '!':
+						++mPosition;
+						return (0 == parseUnary());
+
+					case '~':
+						++mPosition;
+						return ~parseUnary();
+
+					case '-':
+						++mPosition;
+						return -parseUnary();
+
+					case '+':
+						++mPosition;
+						return parseUnary();
+
+					case '(':
+					{
+						++mPosition;
+						const int64_t value = parseConditional();
+						if (!consume(')'))
+						{
+							setError("Missing \")\" inside expression");
+						}
+						return value;
+					}
+
+					default:
+						if (isDigit(character))
+						{
+							// Integer literal, suffixes like "u" or "L" are ignored
+							const size_t endPosition = skipNumber(mExpression, mPosition);
+							char number[32] = {};
+							mExpression.copy(number, std::min(endPosition - mPosition, sizeof(number) - 1), mPosition);
+							mPosition = endPosition;
+							return static_cast<int64_t>(std::strtoll(number, nullptr, 0));
+						}
+						else if (isIdentifierStart(character))
+						{
+							// Unknown identifier
+							mPosition = skipIdentifier(mExpression, mPosition);
+							return 0;
+						}
+						setError("Unexpected token inside expression");
+						return 0;
+				}
+			}
+
+			inline void setError(const char* errorMessage)
+			{
+				if (nullptr == mErrorMessage)
+				{
+					mErrorMessage = errorMessage;
+				}
+			}
+
+		private:
+			std::string_view mExpression;
+			size_t			 mPosition;
+			const char*		 mErrorMessage;	// Null pointer if there's no error
+		};
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -19,31 +458,644 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
-	void Preprocessor::preprocess(const IRenderer& renderer, std::string& source, std::string& result)
+	void Preprocessor::prepareSourceCode(std::string_view sourceCode, std::string& result)
+	{
+		result.clear();
+		result.reserve(sourceCode.size());
+		const size_t numberOfCharacters = sourceCode.size();
+		size_t position = 0;
+		bool lineStart = true;
+		while (position < numberOfCharacters)
+		{
+			const char character = sourceCode[position];
+			if ('\\' == character && position + 1 < numberOfCharacters && ('\n' == sourceCode[position + 1] || '\r' == sourceCode[position + 1]))
+			{
+				// Line splicing
+				position += ('\r' == sourceCode[position + 1] && position + 2 < numberOfCharacters && '\n' == sourceCode[position + 2]) ? 3 : 2;
+			}
+			else if ('/' == character && position + 1 < numberOfCharacters && '/' == sourceCode[position + 1])
+			{
+				// Line comment, a spliced line comment continues on the next line
+				position += 2;
+				while (position < numberOfCharacters && '\n' != sourceCode[position])
+				{
+					position += ('\\' == sourceCode[position] && position + 1 < numberOfCharacters && '\n' == sourceCode[position + 1]) ? 2 : 1;
+				}
+			}
+			else if ('/' == character && position + 1 < numberOfCharacters && '*' == sourceCode[position + 1])
+			{
+				// Block comment, replaced by a single space so no tokens get glued together
+				const size_t endPosition = sourceCode.find("*/", position + 2);
+				position = (std::string_view::npos == endPosition) ? numberOfCharacters : (endPosition + 2);
+				if (!lineStart)
+				{
+					result += ' ';
+				}
+			}
+			else if ('\n' == character)
+			{
+				// End of line: Remove trailing whitespace, empty lines are dropped
+				::detail::trimTrailingSpaces(result);
+				if (!lineStart)
+				{
+					result += '\n';
+					lineStart = true;
+				}
+				++position;
+			}
+			else if (lineStart && ::detail::isSpace(character))
+			{
+				// Remove leading whitespace
+				++position;
+			}
+			else if ('"' == character)
+			{
+				// String literals are copied as they are
+				const size_t endPosition = ::detail::skipStringLiteral(sourceCode, position);
+				result.append(sourceCode.data() + position, endPosition - position);
+				position = endPosition;
+				lineStart = false;
+			}
+			else
+			{
+				result += ('\r' == character) ? ' ' : character;
+				lineStart = false;
+				++position;
+			}
+		}
+		::detail::trimTrailingSpaces(result);
+		if (!lineStart)
+		{
+			result += '\n';
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	bool Preprocessor::preprocess(const std::string& source, std::string& result)
+	{
+		// Reset the state, the containers keep their memory
+		prepareSourceCode(source, mSourceCode);
+		mMacros.clear();
+		mMacroParameters.clear();
+		mMacroArguments.clear();
+		mHiddenMacros.clear();
+		mConditionals.clear();
+		mLineNumber = 0;
+		mError = false;
+		result.clear();
+		result.reserve(mSourceCode.size());
+
+		// Lines without directives are collected into one text block which is macro expanded at once, this way macro invocations can span multiple lines
+		const std::string_view sourceCode(mSourceCode);
+		size_t textBlockStart = 0;
+		size_t textBlockEnd = 0;
+		size_t lineStart = 0;
+		while (lineStart < sourceCode.size() && !mError)
+		{
+			size_t lineEnd = sourceCode.find('\n', lineStart);
+			if (std::string_view::npos == lineEnd)
+			{
+				lineEnd = sourceCode.size();
+			}
+			++mLineNumber;
+			if ('#' == sourceCode[lineStart])
+			{
+				// Flush the collected text block before the directive changes the state
+				if (textBlockStart != textBlockEnd)
+				{
+					expandText(sourceCode.substr(textBlockStart, textBlockEnd - textBlockStart), result, 0);
+				}
+				processDirective(sourceCode.substr(lineStart, lineEnd - lineStart), result);
+				textBlockStart = textBlockEnd = std::min(lineEnd + 1, sourceCode.size());
+			}
+			else if (isActive())
+			{
+				// Extend the text block, including the new line character
+				textBlockEnd = std::min(lineEnd + 1, sourceCode.size());
+			}
+			else
+			{
+				textBlockStart = textBlockEnd = std::min(lineEnd + 1, sourceCode.size());
+			}
+			lineStart = lineEnd + 1;
+		}
+		if (!mError && textBlockStart != textBlockEnd)
+		{
+			expandText(sourceCode.substr(textBlockStart, textBlockEnd - textBlockStart), result, 0);
+		}
+		if (!mError && !mConditionals.empty())
+		{
+			reportError("Missing \"#endif\"");
+		}
+
+		// Done
+		if (mError)
+		{
+			result.clear();
+		}
+		return !mError;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void Preprocessor::reportError(const char* message, std::string_view detail)
+	{
+		RHI_LOG(CRITICAL, "Renderer shader preprocessor line %u: Error: %s %.*s", mLineNumber, message, static_cast<int>(detail.size()), detail.empty() ? "" : detail.data())
+		mError = true;
+	}
+
+	void Preprocessor::processDirective(std::string_view line, std::string& result)
+	{
+		// Get the directive name and the text behind it
+		size_t position = ::detail::skipSpaces(line, 1);
+		const size_t nameEndPosition = ::detail::skipIdentifier(line, position);
+		const std::string_view name = line.substr(position, nameEndPosition - position);
+		const std::string_view text = ::detail::trim(line.substr(nameEndPosition));
+
+		// Conditionals are always processed, everything else only inside active blocks
+		if (name.empty())
+		{
+			// Null directive, nothing to do
+		}
+		else if ("if" == name || "ifdef" == name || "ifndef" == name)
+		{
+			Conditional conditional = {};
+			conditional.parentActive = isActive();
+			if (conditional.parentActive)
+			{
+				if ("if" == name)
+				{
+					conditional.active = evaluateCondition(text);
+				}
+				else
+				{
+					const std::string_view macroName = text.substr(0, ::detail::skipIdentifier(text, 0));
+					if (macroName.empty())
+					{
+						reportError("Missing macro name after", name);
+					}
+					conditional.active = ((mMacros.find(macroName) != mMacros.cend()) == ("ifdef" == name));
+				}
+				conditional.anyBranchTaken = conditional.active;
+			}
+			mConditionals.push_back(conditional);
+		}
+		else if ("elif" == name || "else" == name)
+		{
+			if (mConditionals.empty() || mConditionals.back().elseSeen)
+			{
+				reportError("Unexpected", name);
+				return;
+			}
+			Conditional& conditional = mConditionals.back();
+			if (!conditional.parentActive || conditional.anyBranchTaken)
+			{
+				conditional.active = false;
+			}
+			else
+			{
+				conditional.active = ("else" == name) ? true : evaluateCondition(text);
+				conditional.anyBranchTaken = conditional.active;
+			}
+			conditional.elseSeen = ("else" == name);
+		}
+		else if ("endif" == name)
+		{
+			if (mConditionals.empty())
+			{
+				reportError("Unexpected", name);
+				return;
+			}
+			mConditionals.pop_back();
+		}
+		else if (isActive())
+		{
+			if ("define" == name)
+			{
+				processDefine(text);
+			}
+			else if ("undef" == name)
+			{
+				mMacros.erase(text.substr(0, ::detail::skipIdentifier(text, 0)));
+			}
+			else if ("include" == name)
+			{
+				// Shader pieces are included via the shader blueprint and inserted by the shader builder
+				reportError("\"#include\" isn't supported, shader pieces are included by the shader blueprint:", text);
+			}
+			else if ("error" == name)
+			{
+				reportError("\"#error\"", text);
+			}
+			else
+			{
+				// Pass through e.g. "#version", "#extension" or "#pragma" to the shader compiler
+				result.append(line.data(), line.size());
+				result += '\n';
+			}
+		}
+	}
+
+	void Preprocessor::processDefine(std::string_view text)
 	{
-		// TODO(co) The usage of MojoShader just as preprocessor is overkill. Find a simpler but still efficient solution. Switch to "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ ) ?
+		// Get the macro name
+		const size_t nameEndPosition = ::detail::skipIdentifier(text, 0);
+		const std::string_view name = text.substr(0, nameEndPosition);
+		if (name.empty())
+		{
+			reportError("Invalid macro name after \"#define\"", text);
+			return;
+		}
+
+		// A function-like macro has its parameter list directly behind the macro name
+		Macro macro = {};
+		size_t position = nameEndPosition;
+		if (position < text.size() && '(' == text[position])
+		{
+			macro.functionLike = true;
+			macro.firstParameterIndex = static_cast<uint32_t>(mMacroParameters.size());
+			++position;
+			for (;;)
+			{
+				position = ::detail::skipSpaces(text, position);
+				if (position < text.size() && ')' == text[position] && 0 == macro.numberOfParameters)
+				{
+					// Macro without parameters
+					++position;
+					break;
+				}
+				const size_t parameterEndPosition = ::detail::skipIdentifier(text, position);
+				if (parameterEndPosition == position)
+				{
+					reportError("Invalid macro parameter list of", name);
+					return;
+				}
+				mMacroParameters.push_back(text.substr(position, parameterEndPosition - position));
+				++macro.numberOfParameters;
+				position = ::detail::skipSpaces(text, parameterEndPosition);
+				if (position < text.size() && ',' == text[position])
+				{
+					++position;
+				}
+				else if (position < text.size() && ')' == text[position])
+				{
+					++position;
+					break;
+				}
+				else
+				{
+					reportError("Invalid macro parameter list of", name);
+					return;
+				}
+			}
+		}
+		macro.body = ::detail::trim(text.substr(position));
+
+		// Register the macro, a redefinition replaces the previous definition
+		mMacros[name] = macro;
+	}
 
-		// Disable warnings in external headers, we can't fix them
-		SE_PRAGMA_WARNING_PUSH
-			SE_PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: 'MOJOSHADER_preprocess': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	bool Preprocessor::evaluateCondition(std::string_view expression)
+	{
+		// Replace "defined X" and "defined(X)" before the macro expansion
+		std::string& definedExpression = mExpressionBuffers[0];
+		definedExpression.clear();
+		size_t position = 0;
+		while (position < expression.size())
+		{
+			const char character = expression[position];
+			if (::detail::isIdentifierStart(character))
+			{
+				const size_t identifierEndPosition = ::detail::skipIdentifier(expression, position);
+				const std::string_view identifier = expression.substr(position, identifierEndPosition - position);
+				position = identifierEndPosition;
+				if ("defined" == identifier)
+				{
+					position = ::detail::skipSpaces(expression, position);
+					const bool parentheses = (position < expression.size() && '(' == expression[position]);
+					if (parentheses)
+					{
+						position = ::detail::skipSpaces(expression, position + 1);
+					}
+					const size_t macroNameEndPosition = ::detail::skipIdentifier(expression, position);
+					const std::string_view macroName = expression.substr(position, macroNameEndPosition - position);
+					position = ::detail::skipSpaces(expression, macroNameEndPosition);
+					if (macroName.empty() || (parentheses && (position >= expression.size() || ')' != expression[position])))
+					{
+						reportError("Invalid \"defined\" inside expression", expression);
+						return false;
+					}
+					if (parentheses)
+					{
+						++position;
+					}
+					definedExpression += (mMacros.find(macroName) != mMacros.cend()) ? '1' : '0';
+				}
+				else
+				{
+					definedExpression.append(identifier.data(), identifier.size());
+				}
+			}
+			else if (::detail::isDigit(character))
+			{
+				const size_t numberEndPosition = ::detail::skipNumber(expression, position);
+				definedExpression.append(expression.data() + position, numberEndPosition - position);
+				position = numberEndPosition;
+			}
+			else
+			{
+				definedExpression += character;
+				++position;
+			}
+		}
 
-			// Preprocess
-			const MOJOSHADER_preprocessData* preprocessData = MOJOSHADER_preprocess(nullptr, source.c_str(), static_cast<unsigned int>(source.length()), 0, 0, 0, 0, 0, 0, 0, 0, 0);
-		SE_PRAGMA_WARNING_POP
+		// Macro expansion and evaluation
+		std::string& expandedExpression = mExpressionBuffers[1];
+		expandedExpression.clear();
+		expandText(definedExpression, expandedExpression, 0);
+		if (mError)
+		{
+			return false;
+		}
+		::detail::ExpressionEvaluator expressionEvaluator(expandedExpression);
+		const int64_t value = expressionEvaluator.evaluate();
+		if (nullptr != expressionEvaluator.getErrorMessage())
+		{
+			reportError(expressionEvaluator.getErrorMessage(), expression);
+			return false;
+		}
+		return (0 != value);
+	}
 
-		// Evaluate the result
-		if (preprocessData->error_count > 0)
+	void Preprocessor::expandText(std::string_view text, std::string& result, uint32_t depth, std::string_view* pendingMacroName)
+	{
+		if (depth >= MAXIMUM_MACRO_EXPANSION_DEPTH)
+		{
+			reportError("Maximum macro expansion depth exceeded");
+			return;
+		}
+		const size_t numberOfCharacters = text.size();
+		size_t position = 0;
+		while (position < numberOfCharacters && !mError)
 		{
-			for (int i = 0; i < preprocessData->error_count; ++i)
+			const char character = text[position];
+			if (::detail::isIdentifierStart(character))
+			{
+				const size_t identifierEndPosition = ::detail::skipIdentifier(text, position);
+				std::string_view identifier = text.substr(position, identifierEndPosition - position);
+				position = identifierEndPosition;
+
+				// A macro expansion ending with the name of a function-like macro continues with the text behind the macro invocation, so loop
+				// as long as the rescan of the expansion hands back such a pending macro name (e.g. "#define g f" followed by "g(1)")
+				while (!identifier.empty() && !mError)
+				{
+					// Is this a macro we're allowed to expand?
+					const Macros::const_iterator iterator = mMacros.find(identifier);
+					if (mMacros.cend() == iterator || isMacroHidden(identifier))
+					{
+						result.append(identifier.data(), identifier.size());
+						break;
+					}
+					const Macro& macro = iterator->second;
+
+					// Collect the arguments of a function-like macro, without a following "(" it's no macro invocation
+					const size_t firstArgumentIndex = mMacroArguments.size();
+					if (macro.functionLike)
+					{
+						size_t argumentPosition = position;
+						while (argumentPosition < numberOfCharacters && (::detail::isSpace(text[argumentPosition]) || '\n' == text[argumentPosition]))
+						{
+							++argumentPosition;
+						}
+						if (argumentPosition >= numberOfCharacters && nullptr != pendingMacroName)
+						{
+							// The macro name is the last token of a macro expansion, the "(" might follow behind the macro invocation the expansion is coming from
+							// -> The macro name is a string view into the prepared source code, so it stays valid while the expansion buffers are reused
+							*pendingMacroName = iterator->first;
+							return;
+						}
+						if (argumentPosition >= numberOfCharacters || '(' != text[argumentPosition])
+						{
+							result.append(identifier.data(), identifier.size());
+							break;
+						}
+						++argumentPosition;
+						size_t argumentStart = argumentPosition;
+						uint32_t nestingLevel = 0;
+						bool closed = false;
+						while (argumentPosition < numberOfCharacters && !closed)
+						{
+							const char argumentCharacter = text[argumentPosition];
+							if ('"' == argumentCharacter)
+							{
+								argumentPosition = ::detail::skipStringLiteral(text, argumentPosition);
+								continue;
+							}
+							if ('(' == argumentCharacter)
+							{
+								++nestingLevel;
+							}
+							else if (')' == argumentCharacter && nestingLevel > 0)
+							{
+								--nestingLevel;
+							}
+							else if ((')' == argumentCharacter || ',' == argumentCharacter) && 0 == nestingLevel)
+							{
+								mMacroArguments.push_back(::detail::trim(text.substr(argumentStart, argumentPosition - argumentStart)));
+								argumentStart = argumentPosition + 1;
+								closed = (')' == argumentCharacter);
+							}
+							++argumentPosition;
+						}
+						if (!closed)
+						{
+							reportError("Unterminated invocation of macro", identifier);
+							return;
+						}
+						position = argumentPosition;
+
+						// A macro without parameters is invoked with a single empty argument
+						size_t numberOfArguments = mMacroArguments.size() - firstArgumentIndex;
+						if (0 == macro.numberOfParameters && 1 == numberOfArguments && mMacroArguments.back().empty())
+						{
+							mMacroArguments.pop_back();
+							numberOfArguments = 0;
+						}
+						if (numberOfArguments != macro.numberOfParameters)
+						{
+							reportError("Wrong number of arguments for macro", identifier);
+							return;
+						}
+					}
+
+					// Substitute the parameters and rescan the result while the macro is hidden
+					// -> A function-like macro name at the end of the expansion is handed back and processed together with the remaining text
+					std::string& expansionBuffer = mExpansionBuffers[depth];
+					expansionBuffer.clear();
+					substituteMacro(macro, firstArgumentIndex, expansionBuffer, depth);
+					mMacroArguments.resize(firstArgumentIndex);
+					mHiddenMacros.push_back(iterator->first);
+					identifier = std::string_view();
+					expandText(expansionBuffer, result, depth + 1, &identifier);
+					mHiddenMacros.pop_back();
+				}
+			}
+			else if (::detail::isDigit(character))
+			{
+				const size_t numberEndPosition = ::detail::skipNumber(text, position);
+				result.append(text.data() + position, numberEndPosition - position);
+				position = numberEndPosition;
+			}
+			else if ('"' == character)
 			{
-				RHI_LOG(CRITICAL, "Renderer shader preprocessor %s:%d: Error: %s", preprocessData->errors[i].filename ? preprocessData->errors[i].filename : "???", preprocessData->errors[i].error_position, preprocessData->errors[i].error)
+				const size_t stringEndPosition = ::detail::skipStringLiteral(text, position);
+				result.append(text.data() + position, stringEndPosition - position);
+				position = stringEndPosition;
+			}
+			else
+			{
+				result += character;
+				++position;
 			}
 		}
-		else
+	}
+
+	void Preprocessor::substituteMacro(const Macro& macro, size_t firstArgumentIndex, std::string& result, uint32_t depth)
+	{
+		const std::string_view body = macro.body;
+		const size_t numberOfCharacters = body.size();
+		size_t position = 0;
+		bool pasteNext = false;	// "true" if the previous token was "##", the next token is then glued to the previous one without expansion
+		while (position < numberOfCharacters && !mError)
 		{
-			result.assign(preprocessData->output, static_cast<size_t>(preprocessData->output_len));
+			const char character = body[position];
+			if ('#' == character && position + 1 < numberOfCharacters && '#' == body[position + 1])
+			{
+				// Token pasting
+				::detail::trimTrailingSpaces(result);
+				position = ::detail::skipSpaces(body, position + 2);
+				pasteNext = true;
+			}
+			else if ('#' == character && macro.functionLike)
+			{
+				// Stringizing
+				const size_t nameStartPosition = ::detail::skipSpaces(body, position + 1);
+				const size_t nameEndPosition = ::detail::skipIdentifier(body, nameStartPosition);
+				const std::string_view name = body.substr(nameStartPosition, nameEndPosition - nameStartPosition);
+				uint32_t parameterIndex = 0;
+				while (parameterIndex < macro.numberOfParameters && mMacroParameters[macro.firstParameterIndex + parameterIndex] != name)
+				{
+					++parameterIndex;
+				}
+				if (parameterIndex < macro.numberOfParameters)
+				{
+					// Just like a C-preprocessor: Each whitespace sequence becomes a single space and only the quotation marks and backslashes
+					// inside string and character literals are escaped
+					const std::string_view argument = ::detail::trim(mMacroArguments[firstArgumentIndex + parameterIndex]);
+					const size_t argumentSize = argument.size();
+					result += '"';
+					size_t argumentPosition = 0;
+					while (argumentPosition < argumentSize)
+					{
+						const char argumentCharacter = argument[argumentPosition];
+						if (::detail::isSpace(argumentCharacter) || '\n' == argumentCharacter)
+						{
+							while (argumentPosition < argumentSize && (::detail::isSpace(argument[argumentPosition]) || '\n' == argument[argumentPosition]))
+							{
+								++argumentPosition;
+							}
+							result += ' ';
+						}
+						else if ('"' == argumentCharacter || '\'' == argumentCharacter)
+						{
+							const size_t literalEndPosition = ::detail::skipStringLiteral(argument, argumentPosition);
+							for (; argumentPosition < literalEndPosition; ++argumentPosition)
+							{
+								if ('"' == argument[argumentPosition] || '\\' == argument[argumentPosition])
+								{
+									result += '\\';
+								}
+								result += argument[argumentPosition];
+							}
+						}
+						else
+						{
+							result += argumentCharacter;
+							++argumentPosition;
+						}
+					}
+					result += '"';
+					position = nameEndPosition;
+				}
+				else
+				{
+					result += character;
+					++position;
+				}
+				pasteNext = false;
+			}
+			else if (::detail::isIdentifierStart(character))
+			{
+				const size_t identifierEndPosition = ::detail::skipIdentifier(body, position);
+				const std::string_view identifier = body.substr(position, identifierEndPosition - position);
+				position = identifierEndPosition;
+				uint32_t parameterIndex = 0;
+				while (parameterIndex < macro.numberOfParameters && mMacroParameters[macro.firstParameterIndex + parameterIndex] != identifier)
+				{
+					++parameterIndex;
+				}
+				if (parameterIndex < macro.numberOfParameters)
+				{
+					// Arguments are macro expanded before the substitution, except if they're an operand of "##"
+					const std::string_view argument = mMacroArguments[firstArgumentIndex + parameterIndex];
+					const size_t nextPosition = ::detail::skipSpaces(body, position);
+					const bool pastePrevious = (nextPosition + 1 < numberOfCharacters && '#' == body[nextPosition] && '#' == body[nextPosition + 1]);
+					if (pasteNext || pastePrevious)
+					{
+						result.append(argument.data(), argument.size());
+					}
+					else
+					{
+						expandText(argument, result, depth + 1);
+					}
+				}
+				else
+				{
+					result.append(identifier.data(), identifier.size());
+				}
+				pasteNext = false;
+			}
+			else if (::detail::isDigit(character))
+			{
+				const size_t numberEndPosition = ::detail::skipNumber(body, position);
+				result.append(body.data() + position, numberEndPosition - position);
+				position = numberEndPosition;
+				pasteNext = false;
+			}
+			else if ('"' == character)
+			{
+				const size_t stringEndPosition = ::detail::skipStringLiteral(body, position);
+				result.append(body.data() + position, stringEndPosition - position);
+				position = stringEndPosition;
+				pasteNext = false;
+			}
+			else
+			{
+				result += character;
+				++position;
+				pasteNext = false;
+			}
 		}
-		MOJOSHADER_freePreprocessData(preprocessData);
+	}
+
+	bool Preprocessor::isMacroHidden(std::string_view name) const
+	{
+		return (std::find(mHiddenMacros.cbegin(), mHiddenMacros.cend(), name) != mHiddenMacros.cend());
 	}
 
 
@@ -15,18 +15,12 @@ SE_PRAGMA_WARNING_PUSH
 	SE_PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	SE_PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	#include <string>
+	#include <string_view>
+	#include <unordered_map>
+	#include <vector>
 SE_PRAGMA_WARNING_POP
 
 
-//[-------------------------------------------------------]
-//[ Forward declarations                                  ]
-//[-------------------------------------------------------]
-namespace Renderer
-{
-	class IRenderer;
-}
-
-
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -39,36 +33,141 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    A simple interface for the shader preprocessor
+	*    A lightweight shader preprocessor
+	*
+	*  @remarks
+	*    Supports object-like and function-like macros including "#" and "##", "#define", "#undef", "#if", "#ifdef", "#ifndef", "#elif", "#else",
+	*    "#endif" with integer expressions and "defined", and "#error". "#version", "#extension", "#pragma" and "#line" are passed through
+	*    to the shader compiler. Shader pieces are included by the shader builder, so "#include" is reported as error.
+	*
+	*    The preprocessing is split into two parts:
+	*    - "Renderer::Preprocessor::prepareSourceCode()": Line splicing, comment stripping and whitespace trimming. This doesn't depend on
+	*      the shader combination, so the shader piece and shader blueprint resource loaders do this once when loading the shader source code.
+	*    - "Renderer::Preprocessor::preprocess()": Directives and macro expansion, done for each shader combination. Macros are string views
+	*      into the source code and all buffers are reused, so there are hardly any memory allocations once the preprocessor instance is warm.
 	*
 	*  @note
-	*    - Internally MojoShader ( https://icculus.org/mojoshader/ ) is used
-	*    - Possible alternatives to MojoShader if we later on want to get rid of it:
-	*      - "fcpp" "Frexx C preprocessor" ( https://github.com/bagder/fcpp )
-	*      - "mcpp -- a portable C preprocessor" ( http://mcpp.sourceforge.net/ )
-	*      - https://github.com/lpsantil/ucpp
-	*      - https://github.com/danmar/simplecpp
+	*    - Each shader builder owns a preprocessor instance, a preprocessor instance must not be used by multiple threads at the same time
 	*/
 	class Preprocessor final
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_MACRO_EXPANSION_DEPTH = 32;
+
+
 	//[-------------------------------------------------------]
 	//[ Public static methods                                 ]
 	//[-------------------------------------------------------]
 	public:
+		/**
+		*  @brief
+		*    Prepare shader source code for the preprocessor
+		*
+		*  @param[in] sourceCode
+		*    Shader source code to prepare
+		*  @param[out] result
+		*    Receives the prepared shader source code: Lines ending with a backslash are spliced, comments are stripped, leading and trailing whitespace
+		*    as well as empty lines are removed; string literals are left untouched
+		*
+		*  @note
+		*    - Preparing already prepared shader source code results in the same shader source code
+		*/
+		static void prepareSourceCode(std::string_view sourceCode, std::string& result);
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline Preprocessor() :
+			mLineNumber(0),
+			mError(false)
+		{
+			// Nothing here
+		}
+
+		inline ~Preprocessor()
+		{
+			// Nothing here
+		}
+
 		/**
 		*  @brief
 		*    Run a shader source string through the preprocessor
 		*
-		*  @param[in] renderer
-		*    Renderer instance to use
 		*  @param[in] source
 		*    Source string
 		*  @param[out] result
-		*    Receives the processed code
+		*    Receives the processed code, empty on error
+		*
+		*  @return
+		*    "true" if all went fine, else "false" (errors are written into the log)
 		*/
-		static void preprocess(const IRenderer& renderer, std::string& source, std::string& result);
+		bool preprocess(const std::string& source, std::string& result);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Macro final
+		{
+			std::string_view body;
+			uint32_t		 firstParameterIndex;	// Index of the first parameter name inside "Renderer::Preprocessor::mMacroParameters"
+			uint32_t		 numberOfParameters;
+			bool			 functionLike;
+		};
+		struct Conditional final
+		{
+			bool parentActive;	// "true" if the enclosing block is active
+			bool active;		// "true" if the current branch is active
+			bool anyBranchTaken;
+			bool elseSeen;
+		};
+		typedef std::unordered_map<std::string_view, Macro> Macros;
+		typedef std::vector<std::string_view>				 StringViews;
+		typedef std::vector<Conditional>					 Conditionals;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit Preprocessor(const Preprocessor&) = delete;
+		Preprocessor& operator=(const Preprocessor&) = delete;
+		void reportError(const char* message, std::string_view detail = std::string_view());
+		void processDirective(std::string_view line, std::string& result);
+		void processDefine(std::string_view text);
+		[[nodiscard]] bool evaluateCondition(std::string_view expression);
+		void expandText(std::string_view text, std::string& result, uint32_t depth, std::string_view* pendingMacroName = nullptr);
+		void substituteMacro(const Macro& macro, size_t firstArgumentIndex, std::string& result, uint32_t depth);
+		[[nodiscard]] bool isMacroHidden(std::string_view name) const;
+
+		[[nodiscard]] inline bool isActive() const
+		{
+			return (mConditionals.empty() || (mConditionals.back().parentActive && mConditionals.back().active));
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::string	 mSourceCode;		// Prepared source code, all string views point into it, could be a local variable but when making it to a member we reduce memory allocations
+		Macros		 mMacros;			// Macro by name
+		StringViews	 mMacroParameters;	// Parameter names of all function-like macros
+		StringViews	 mMacroArguments;	// Argument stack of the macro invocations currently expanded
+		StringViews	 mHiddenMacros;		// Macros currently expanded, a macro isn't expanded again while its own expansion is rescanned
+		Conditionals mConditionals;		// Stack of the "#if"-blocks
+		std::string	 mExpressionBuffers[2];	// Expression of the current "#if"/"#elif" before and after macro expansion
+		std::string	 mExpansionBuffers[MAXIMUM_MACRO_EXPANSION_DEPTH];	// Macro substitution result per expansion depth, the string views into them must stay valid while deeper levels are expanded
+		uint32_t	 mLineNumber;		// Current line number inside the prepared source code, for error messages
+		bool		 mError;
 
 
 	};
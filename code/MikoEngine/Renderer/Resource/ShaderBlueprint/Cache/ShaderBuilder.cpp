@@ -5,7 +5,6 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
-#include "Renderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
 #include "Renderer/Resource/ShaderPiece/ShaderPieceResourceManager.h"
@@ -889,7 +888,7 @@ namespace Renderer
 		}
 
 		// Apply a C-preprocessor
-		Preprocessor::preprocess(shaderPieceResourceManager.getRenderer(), mInString, mOutString);
+		mPreprocessor.preprocess(mInString, mOutString);
 
 		// Done
 		buildShader.sourceCode = mOutString;
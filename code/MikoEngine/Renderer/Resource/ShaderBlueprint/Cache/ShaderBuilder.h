@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Renderer/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "Renderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 
 namespace Renderer
 {
@@ -62,6 +63,7 @@ namespace Renderer
 
 		ShaderProperties	mShaderProperties;
 		DynamicShaderPieces	mDynamicShaderPieces;
+		Preprocessor		mPreprocessor;
 		std::string			mInString;	// Could be a local variable, but when making it to a member we reduce memory allocations
 		std::string			mOutString;	// Could be a local variable, but when making it to a member we reduce memory allocations
 	};
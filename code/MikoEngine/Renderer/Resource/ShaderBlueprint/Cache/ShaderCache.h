@@ -62,7 +62,11 @@ namespace Renderer
 		*    Return RHI shader bytecode
 		*
 		*  @return
-		*    The RHI shader bytecode
+		*    The RHI shader bytecode, empty if the shader cache was loaded from the pipeline state object cache
+		*
+		*  @note
+		*    - Shader bytecodes loaded from the pipeline state object cache stay packed inside the shader bytecode cache of the
+		*      shader cache manager and are only decompressed when the RHI shader instance is created
 		*/
 		[[nodiscard]] inline const Rhi::ShaderBytecode& getShaderBytecode() const
 		{
@@ -81,6 +85,30 @@ namespace Renderer
 			return (nullptr != mMasterShaderCache) ? mMasterShaderCache->mShaderPtr : mShaderPtr;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the shader bytecode is packed inside the shader bytecode cache of the shader cache manager
+		*
+		*  @return
+		*    "true" if the shader bytecode is packed, else "false"
+		*/
+		[[nodiscard]] inline bool isShaderBytecodePacked() const
+		{
+			return (0 != mNumberOfPackedShaderBytecodeBytes);
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not there's a shader bytecode the RHI shader instance can be created from
+		*
+		*  @return
+		*    "true" if there's a shader bytecode, packed or not, else "false"
+		*/
+		[[nodiscard]] inline bool hasShaderBytecode() const
+		{
+			return (isShaderBytecodePacked() || 0 != mShaderBytecode.getNumberOfBytes());
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -88,21 +116,30 @@ namespace Renderer
 	private:
 		inline ShaderCache() :
 			mShaderCacheId(GetInvalid<ShaderCacheId>()),
-			mMasterShaderCache(nullptr)
+			mMasterShaderCache(nullptr),
+			mPackedShaderBytecodeOffset(0),
+			mNumberOfPackedShaderBytecodeBytes(0),
+			mNumberOfShaderBytecodeBytes(0)
 		{
 			// Nothing here
 		}
 
 		inline explicit ShaderCache(ShaderCacheId shaderCacheId) :
 			mShaderCacheId(shaderCacheId),
-			mMasterShaderCache(nullptr)
+			mMasterShaderCache(nullptr),
+			mPackedShaderBytecodeOffset(0),
+			mNumberOfPackedShaderBytecodeBytes(0),
+			mNumberOfShaderBytecodeBytes(0)
 		{
 			// Nothing here
 		}
 
 		inline ShaderCache(ShaderCacheId shaderCacheId, ShaderCache* masterShaderCache) :
 			mShaderCacheId(shaderCacheId),
-			mMasterShaderCache(masterShaderCache)
+			mMasterShaderCache(masterShaderCache),
+			mPackedShaderBytecodeOffset(0),
+			mNumberOfPackedShaderBytecodeBytes(0),
+			mNumberOfShaderBytecodeBytes(0)
 		{
 			// Nothing here
 		}
@@ -124,7 +161,10 @@ namespace Renderer
 		ShaderCache*		mMasterShaderCache;			// If there's a master shader cache instance, we don't own the references shader but only redirect to it (multiple shader combinations resulting in same shader source code topic), don't destroy the instance
 		AssetIds			mAssetIds;					// List of IDs of the assets (shader blueprint, shader piece) which took part in the shader cache creation
 		uint64_t			mCombinedAssetFileHashes;	// Combination of the file hash of all assets (shader blueprint, shader piece) which took part in the shader cache creation
-		Rhi::ShaderBytecode mShaderBytecode;
+		Rhi::ShaderBytecode mShaderBytecode;					// Only used for shader caches created during runtime, empty if the shader bytecode is packed
+		uint64_t			mPackedShaderBytecodeOffset;		// LZ4 compressed shader bytecode offset in bytes from the start of the shader bytecode cache
+		uint32_t			mNumberOfPackedShaderBytecodeBytes;	// Number of LZ4 compressed shader bytecode bytes inside the shader bytecode cache, 0 if the shader bytecode isn't packed
+		uint32_t			mNumberOfShaderBytecodeBytes;		// Number of decompressed shader bytecode bytes, only valid if the shader bytecode is packed
 		Rhi::IShaderPtr		mShaderPtr;
 
 
@@ -9,9 +9,132 @@
 #include "Renderer/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "Renderer/Asset/AssetManager.h"
 #include "Core/File/MemoryFile.h"
+#include "Core/File/IFileManager.h"
 #include "Math/Math.h"
 #include "Renderer/IRenderer.h"
 
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '__GNUC__' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <lz4/lz4.h>
+SE_PRAGMA_WARNING_POP
+
+#include <algorithm>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		// Shader bytecode cache file format content:
+		// - Header
+		// - Entries, sorted by shader cache ID
+		// - LZ4 compressed shader bytecodes, one contiguous blob
+		// -> Not LZ4 compressed as a whole since the shader bytecodes are decompressed on demand directly out of the mapped file
+		namespace v1ShaderBytecodeCache
+		{
+			static constexpr uint32_t FORMAT_TYPE	 = SE_STRING_ID("ShaderBytecodeCache");
+			static constexpr uint32_t FORMAT_VERSION = 1;
+
+			#pragma pack(push)
+			#pragma pack(1)
+				struct Header final
+				{
+					uint32_t formatType;
+					uint32_t formatVersion;
+					uint32_t numberOfEntries;
+				};
+
+				struct Entry final
+				{
+					Renderer::ShaderCacheId shaderCacheId;
+					uint64_t				combinedAssetFileHashes;	// Combined asset file hashes of the master shader cache the shader bytecode was saved for
+					uint64_t				offset;						// LZ4 compressed shader bytecode offset in bytes from the start of the shader bytecode cache
+					uint32_t				numberOfBytes;				// Number of LZ4 compressed shader bytecode bytes
+					uint32_t				numberOfDecompressedBytes;	// Number of shader bytecode bytes
+				};
+			#pragma pack(pop)
+		}
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] bool getShaderBytecodeCacheFilename(const Renderer::IRenderer& renderer, std::string& virtualDirectoryName, std::string& virtualFilename)
+		{
+			// The shader bytecode cache is located next to the pipeline state object cache
+			const char* localDataMountPoint = renderer.getFileManager().getLocalDataMountPoint();
+			if (nullptr != localDataMountPoint)
+			{
+				virtualDirectoryName = localDataMountPoint;
+				virtualFilename = virtualDirectoryName + '/' + renderer.getRhi().getName() + ".shader_bytecode_cache";
+				return true;
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool isShaderBytecodeCacheValid(const uint8_t* shaderBytecodeCacheData, size_t numberOfBytes)
+		{
+			// Check the header
+			if (numberOfBytes < sizeof(v1ShaderBytecodeCache::Header))
+			{
+				return false;
+			}
+			const v1ShaderBytecodeCache::Header& header = *reinterpret_cast<const v1ShaderBytecodeCache::Header*>(shaderBytecodeCacheData);
+			if (v1ShaderBytecodeCache::FORMAT_TYPE != header.formatType || v1ShaderBytecodeCache::FORMAT_VERSION != header.formatVersion || (numberOfBytes - sizeof(v1ShaderBytecodeCache::Header)) / sizeof(v1ShaderBytecodeCache::Entry) < header.numberOfEntries)
+			{
+				return false;
+			}
+
+			// Check the entries, only the index table is touched and not the shader bytecodes
+			const v1ShaderBytecodeCache::Entry* entries = reinterpret_cast<const v1ShaderBytecodeCache::Entry*>(shaderBytecodeCacheData + sizeof(v1ShaderBytecodeCache::Header));
+			for (uint32_t i = 0; i < header.numberOfEntries; ++i)
+			{
+				const v1ShaderBytecodeCache::Entry& entry = entries[i];
+				if (0 == entry.numberOfBytes || 0 == entry.numberOfDecompressedBytes || entry.offset > numberOfBytes || entry.numberOfBytes > numberOfBytes - entry.offset || (0 != i && entries[i - 1].shaderCacheId >= entry.shaderCacheId))
+				{
+					return false;
+				}
+			}
+
+			// Done
+			return true;
+		}
+
+		[[nodiscard]] const v1ShaderBytecodeCache::Entry* findShaderBytecodeCacheEntry(const uint8_t* shaderBytecodeCacheData, Renderer::ShaderCacheId shaderCacheId)
+		{
+			if (nullptr != shaderBytecodeCacheData)
+			{
+				// Binary search inside the index table sorted by shader cache ID
+				const v1ShaderBytecodeCache::Header& header = *reinterpret_cast<const v1ShaderBytecodeCache::Header*>(shaderBytecodeCacheData);
+				const v1ShaderBytecodeCache::Entry* firstEntry = reinterpret_cast<const v1ShaderBytecodeCache::Entry*>(shaderBytecodeCacheData + sizeof(v1ShaderBytecodeCache::Header));
+				const v1ShaderBytecodeCache::Entry* lastEntry = firstEntry + header.numberOfEntries;
+				const v1ShaderBytecodeCache::Entry* entry = std::lower_bound(firstEntry, lastEntry, shaderCacheId, [](const v1ShaderBytecodeCache::Entry& left, Renderer::ShaderCacheId right) { return (left.shaderCacheId < right); });
+				if (entry != lastEntry && entry->shaderCacheId == shaderCacheId)
+				{
+					return entry;
+				}
+			}
+
+			// There's no shader bytecode for the given shader cache ID
+			return nullptr;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -48,36 +171,7 @@ namespace Renderer
 				// Create RHI shader instance using the shader bytecode, if necessary
 				if (nullptr == shaderCache->mShaderPtr.GetPointer())
 				{
-					SE_ASSERT(0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-					if (0 != shaderCache->mShaderBytecode.getNumberOfBytes())
-					{
-						switch (graphicsShaderType)
-						{
-							case GraphicsShaderType::Vertex:
-							{
-								const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
-								shaderCache->mShaderPtr = shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
-								break;
-							}
-
-							case GraphicsShaderType::TessellationControl:
-								shaderCache->mShaderPtr = shaderLanguage.createTessellationControlShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
-								break;
-
-							case GraphicsShaderType::TessellationEvaluation:
-								shaderCache->mShaderPtr = shaderLanguage.createTessellationEvaluationShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
-								break;
-
-							case GraphicsShaderType::Geometry:
-								// TODO(co) "Renderer::ShaderCacheManager::getGraphicsShaderCache()" needs to provide additional geometry shader information
-								// shaderCache->mShaderPtr = shaderLanguage.createGeometryShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
-								break;
-
-							case GraphicsShaderType::Fragment:
-								shaderCache->mShaderPtr = shaderLanguage.createFragmentShaderFromBytecode(shaderCache->mShaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
-								break;
-						}
-					}
+					createGraphicsShaderFromBytecode(mutexLock, *shaderCache, materialBlueprintResource, shaderLanguage, graphicsShaderType);
 				}
 			}
 			else
@@ -206,8 +300,7 @@ namespace Renderer
 				// Create RHI shader instance using the shader bytecode, if necessary
 				if (nullptr == shaderCache->mShaderPtr.GetPointer())
 				{
-					SE_ASSERT(0 != shaderCache->mShaderBytecode.getNumberOfBytes(), "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-					shaderCache->mShaderPtr = shaderLanguage.createComputeShaderFromBytecode(shaderCache->mShaderBytecode);
+					createComputeShaderFromBytecode(mutexLock, *shaderCache, shaderLanguage);
 				}
 			}
 			else
@@ -298,20 +391,26 @@ namespace Renderer
 			mShaderCacheByShaderSourceCodeId.clear();
 			mCacheNeedsSaving = true;
 		}
+		std::lock_guard<std::shared_mutex> shaderBytecodeCacheMutexLock(mShaderBytecodeCacheMutex);
+		closeShaderBytecodeCache();
 	}
 
 	void ShaderCacheManager::loadCache(IFile& file)
 	{
-		// TODO(co) This can certainly be implemented in a more efficient way. For instance, we could store all shader bytecodes inside a LZ4 compressed buffer and let shader caches directly point into this buffer.
 		typedef std::unordered_set<ShaderCacheId> OutOfDateShaderCacheIds;
 		OutOfDateShaderCacheIds outOfDateShaderCacheIds;
 		const AssetManager& assetManager = mShaderBlueprintResourceManager.getRenderer().getAssetManager();
 
+		// Open the shader bytecode cache, shader caches only remember where their shader bytecode is located inside it
+		{
+			std::lock_guard<std::shared_mutex> shaderBytecodeCacheMutexLock(mShaderBytecodeCacheMutex);
+			openShaderBytecodeCache();
+		}
+
 		{ // Load shader caches
 			uint32_t numberOfShaderCaches = GetInvalid<uint32_t>();
 			file.read(&numberOfShaderCaches, sizeof(uint32_t));
 			mShaderCacheByShaderCacheId.reserve(numberOfShaderCaches);
-			std::vector<uint8_t> bytecode;
 			AssetIds assetIds;
 			for (uint32_t i = 0; i < numberOfShaderCaches; ++i)
 			{
@@ -336,6 +435,7 @@ namespace Renderer
 					file.read(&combinedAssetFileHashes, sizeof(uint64_t));
 
 					// Check whether or not the shader cache is still valid
+					// -> The shader bytecode inside the shader bytecode cache must have been saved for the same combined asset file hashes
 					uint64_t currentCombinedAssetFileHashes = Math::FNV1a_INITIAL_HASH_64;
 					for (AssetId assetId : assetIds)
 					{
@@ -345,29 +445,23 @@ namespace Renderer
 							currentCombinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&asset->fileHash), sizeof(uint64_t), currentCombinedAssetFileHashes);
 						}
 					}
-					if (currentCombinedAssetFileHashes != combinedAssetFileHashes)
+					const ::detail::v1ShaderBytecodeCache::Entry* shaderBytecodeCacheEntry = ::detail::findShaderBytecodeCacheEntry(mShaderBytecodeCacheData, shaderCacheId);
+					if (currentCombinedAssetFileHashes != combinedAssetFileHashes || nullptr == shaderBytecodeCacheEntry || shaderBytecodeCacheEntry->combinedAssetFileHashes != combinedAssetFileHashes || shaderBytecodeCacheEntry->numberOfDecompressedBytes != numberOfBytes)
 					{
 						// Shader cache is out-of-date
-						file.skip(numberOfBytes);
 						outOfDateShaderCacheIds.insert(shaderCacheId);
 					}
 					else
 					{
 						// Shader cache is still valid
 
-						// Create shader cache instance
+						// Create shader cache instance, the shader bytecode stays packed inside the shader bytecode cache until it's needed
 						shaderCache = new ShaderCache(shaderCacheId);
 						shaderCache->mAssetIds = assetIds;
 						shaderCache->mCombinedAssetFileHashes = combinedAssetFileHashes;
-
-						// Load shader bytecode
-						SE_ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
-						if (0 != numberOfBytes)
-						{
-							bytecode.resize(numberOfBytes);
-							file.read(bytecode.data(), numberOfBytes);
-							shaderCache->mShaderBytecode.setBytecodeCopy(numberOfBytes, bytecode.data());
-						}
+						shaderCache->mPackedShaderBytecodeOffset = shaderBytecodeCacheEntry->offset;
+						shaderCache->mNumberOfPackedShaderBytecodeBytes = shaderBytecodeCacheEntry->numberOfBytes;
+						shaderCache->mNumberOfShaderBytecodeBytes = shaderBytecodeCacheEntry->numberOfDecompressedBytes;
 					}
 				}
 				else
@@ -429,19 +523,24 @@ namespace Renderer
 
 	void ShaderCacheManager::saveCache(IFile& file)
 	{
+		// The shader bytecode cache is replaced while saving, so compiler threads must not decompress shader bytecodes meanwhile
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+		std::lock_guard<std::shared_mutex> shaderBytecodeCacheMutexLock(mShaderBytecodeCacheMutex);
+
 		{ // Save shader caches
 		  // -> Shader caches with a master shader cache must come last to ensure the master is already loaded
+		  // -> The shader bytecodes are saved into the shader bytecode cache, sorted by shader cache ID
 			const uint32_t numberOfShaderCaches = static_cast<uint32_t>(mShaderCacheByShaderCacheId.size());
 			file.write(&numberOfShaderCaches, sizeof(uint32_t));
+			std::vector<ShaderCache*> packedShaderCaches;
 			std::vector<const ShaderCache*> shaderCachesWithMaster;
 			for (auto& shaderCacheElement : mShaderCacheByShaderCacheId)
 			{
-				const ShaderCache* shaderCache = shaderCacheElement.second;
+				ShaderCache* shaderCache = shaderCacheElement.second;
 				if (nullptr == shaderCache->getMasterShaderCache())
 				{
 					// Master shader cache
-					const Rhi::ShaderBytecode& shaderBytecode = shaderCache->mShaderBytecode;
-					const uint32_t numberOfBytes = shaderBytecode.getNumberOfBytes();
+					const uint32_t numberOfBytes = shaderCache->isShaderBytecodePacked() ? shaderCache->mNumberOfShaderBytecodeBytes : shaderCache->mShaderBytecode.getNumberOfBytes();
 					SE_ASSERT(0 != numberOfBytes, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
 					file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
 					file.write(&numberOfBytes, sizeof(uint32_t));
@@ -453,10 +552,10 @@ namespace Renderer
 					file.write(shaderCache->mAssetIds.data(), sizeof(uint32_t) * numberOfAssetIds);
 					file.write(&shaderCache->mCombinedAssetFileHashes, sizeof(uint64_t));
 
-					// Write shader bytecode
+					// Shader bytecode, a shader cache without shader bytecode is out-of-date when loading it the next time
 					if (0 != numberOfBytes)
 					{
-						file.write(shaderBytecode.getBytecode(), numberOfBytes);
+						packedShaderCaches.push_back(shaderCache);
 					}
 				}
 				else
@@ -467,12 +566,16 @@ namespace Renderer
 			for (const ShaderCache* shaderCache : shaderCachesWithMaster)
 			{
 				const ShaderCache* masterShaderCache = shaderCache->getMasterShaderCache();
-				SE_ASSERT(nullptr != masterShaderCache->getShaderPtr().GetPointer(), "A shader cache must always have a valid shader instance, else it's a pointless shader cache")
+				SE_ASSERT(nullptr != masterShaderCache->getShaderPtr().GetPointer() || masterShaderCache->isShaderBytecodePacked(), "A shader cache must always have a valid shader instance, else it's a pointless shader cache")
 				file.write(&shaderCache->mShaderCacheId, sizeof(ShaderCacheId));
 				const uint32_t numberOfBytes = GetInvalid<uint32_t>();
 				file.write(&numberOfBytes, sizeof(uint32_t));
 				file.write(&masterShaderCache->mShaderCacheId, sizeof(ShaderCacheId));
 			}
+
+			// Save shader bytecode cache
+			std::sort(packedShaderCaches.begin(), packedShaderCaches.end(), [](const ShaderCache* left, const ShaderCache* right) { return (left->mShaderCacheId < right->mShaderCacheId); });
+			saveShaderBytecodeCache(packedShaderCaches);
 		}
 
 		{ // Save shader source code ID to shader cache ID mapping
@@ -489,6 +592,240 @@ namespace Renderer
 		mCacheNeedsSaving = false;
 	}
 
+	void ShaderCacheManager::openShaderBytecodeCache()
+	{
+		SE_ASSERT(nullptr == mShaderBytecodeCacheData, "The shader bytecode cache is already open")
+		const IRenderer& renderer = mShaderBlueprintResourceManager.getRenderer();
+		std::string virtualDirectoryName;
+		std::string virtualFilename;
+		const IFileManager& fileManager = renderer.getFileManager();
+		if (::detail::getShaderBytecodeCacheFilename(renderer, virtualDirectoryName, virtualFilename) && fileManager.doesFileExist(virtualFilename.c_str()))
+		{
+			IFile* shaderBytecodeCacheFile = fileManager.openFile(IFileManager::FileMode::READ, virtualFilename.c_str());
+			if (nullptr != shaderBytecodeCacheFile)
+			{
+				// Keep the shader bytecode cache file open if the file manager supports file views, else read the shader bytecode cache at once
+				const size_t numberOfBytes = shaderBytecodeCacheFile->getNumberOfBytes();
+				const uint8_t* shaderBytecodeCacheData = (0 != numberOfBytes) ? shaderBytecodeCacheFile->getView(numberOfBytes) : nullptr;
+				if (nullptr != shaderBytecodeCacheData)
+				{
+					mShaderBytecodeCacheFile = shaderBytecodeCacheFile;
+					mShaderBytecodeCacheData = shaderBytecodeCacheData;
+				}
+				else
+				{
+					if (0 != numberOfBytes)
+					{
+						mShaderBytecodeCacheBuffer.resize(numberOfBytes);
+						shaderBytecodeCacheFile->read(mShaderBytecodeCacheBuffer.data(), numberOfBytes);
+						mShaderBytecodeCacheData = mShaderBytecodeCacheBuffer.data();
+					}
+					fileManager.closeFile(*shaderBytecodeCacheFile);
+				}
+
+				// Sanity check
+				// -> No error since an invalid shader bytecode cache just means that all shader caches are out-of-date
+				if (nullptr != mShaderBytecodeCacheData && !::detail::isShaderBytecodeCacheValid(mShaderBytecodeCacheData, numberOfBytes))
+				{
+					closeShaderBytecodeCache();
+				}
+			}
+		}
+	}
+
+	void ShaderCacheManager::closeShaderBytecodeCache()
+	{
+		if (nullptr != mShaderBytecodeCacheFile)
+		{
+			mShaderBlueprintResourceManager.getRenderer().getFileManager().closeFile(*mShaderBytecodeCacheFile);
+			mShaderBytecodeCacheFile = nullptr;
+		}
+		mShaderBytecodeCacheData = nullptr;
+		mShaderBytecodeCacheBuffer.clear();
+		mShaderBytecodeCacheBuffer.shrink_to_fit();
+	}
+
+	void ShaderCacheManager::saveShaderBytecodeCache(const std::vector<ShaderCache*>& packedShaderCaches)
+	{
+		// Header and index table
+		const uint32_t numberOfEntries = static_cast<uint32_t>(packedShaderCaches.size());
+		std::vector<::detail::v1ShaderBytecodeCache::Entry> entries(numberOfEntries);
+		ByteVector shaderBytecodeCache(sizeof(::detail::v1ShaderBytecodeCache::Header) + sizeof(::detail::v1ShaderBytecodeCache::Entry) * numberOfEntries);
+
+		// LZ4 compressed shader bytecodes
+		// -> Shader bytecodes which are still packed are copied as they are, they don't need to be decompressed and compressed again
+		// -> "LZ4_compress_default()" instead of the slower high compression variant since saving can happen during runtime while the shader cache manager is locked
+		for (uint32_t i = 0; i < numberOfEntries; ++i)
+		{
+			const ShaderCache& shaderCache = *packedShaderCaches[i];
+			::detail::v1ShaderBytecodeCache::Entry& entry = entries[i];
+			entry.shaderCacheId = shaderCache.mShaderCacheId;
+			entry.combinedAssetFileHashes = shaderCache.mCombinedAssetFileHashes;
+			entry.offset = shaderBytecodeCache.size();
+			if (shaderCache.isShaderBytecodePacked())
+			{
+				SE_ASSERT(nullptr != mShaderBytecodeCacheData, "Invalid shader bytecode cache data")
+				entry.numberOfBytes = shaderCache.mNumberOfPackedShaderBytecodeBytes;
+				entry.numberOfDecompressedBytes = shaderCache.mNumberOfShaderBytecodeBytes;
+				const uint8_t* packedShaderBytecode = mShaderBytecodeCacheData + shaderCache.mPackedShaderBytecodeOffset;
+				shaderBytecodeCache.insert(shaderBytecodeCache.end(), packedShaderBytecode, packedShaderBytecode + entry.numberOfBytes);
+			}
+			else
+			{
+				const Rhi::ShaderBytecode& shaderBytecode = shaderCache.mShaderBytecode;
+				const int destinationCapacity = LZ4_compressBound(static_cast<int>(shaderBytecode.getNumberOfBytes()));
+				shaderBytecodeCache.resize(shaderBytecodeCache.size() + static_cast<size_t>(destinationCapacity));
+				const int numberOfWrittenBytes = LZ4_compress_default(reinterpret_cast<const char*>(shaderBytecode.getBytecode()), reinterpret_cast<char*>(shaderBytecodeCache.data() + entry.offset), static_cast<int>(shaderBytecode.getNumberOfBytes()), destinationCapacity);
+				SE_ASSERT(numberOfWrittenBytes > 0, "LZ4 failed to compress the shader bytecode")
+				entry.numberOfBytes = static_cast<uint32_t>(numberOfWrittenBytes);
+				entry.numberOfDecompressedBytes = shaderBytecode.getNumberOfBytes();
+				shaderBytecodeCache.resize(static_cast<size_t>(entry.offset) + entry.numberOfBytes);
+			}
+		}
+		const ::detail::v1ShaderBytecodeCache::Header header = { ::detail::v1ShaderBytecodeCache::FORMAT_TYPE, ::detail::v1ShaderBytecodeCache::FORMAT_VERSION, numberOfEntries };
+		memcpy(shaderBytecodeCache.data(), &header, sizeof(::detail::v1ShaderBytecodeCache::Header));
+		if (0 != numberOfEntries)
+		{
+			memcpy(shaderBytecodeCache.data() + sizeof(::detail::v1ShaderBytecodeCache::Header), entries.data(), sizeof(::detail::v1ShaderBytecodeCache::Entry) * numberOfEntries);
+		}
+
+		// The new shader bytecode cache replaces the old one and stays in memory until it's written, the mapped shader bytecode cache file is about to be overwritten
+		closeShaderBytecodeCache();
+		mShaderBytecodeCacheBuffer = std::move(shaderBytecodeCache);
+		mShaderBytecodeCacheData = mShaderBytecodeCacheBuffer.data();
+		for (uint32_t i = 0; i < numberOfEntries; ++i)
+		{
+			ShaderCache& shaderCache = *packedShaderCaches[i];
+			const ::detail::v1ShaderBytecodeCache::Entry& entry = entries[i];
+			shaderCache.mPackedShaderBytecodeOffset = entry.offset;
+			shaderCache.mNumberOfPackedShaderBytecodeBytes = entry.numberOfBytes;
+			shaderCache.mNumberOfShaderBytecodeBytes = entry.numberOfDecompressedBytes;
+		}
+
+		// Write the shader bytecode cache file
+		const IRenderer& renderer = mShaderBlueprintResourceManager.getRenderer();
+		std::string virtualDirectoryName;
+		std::string virtualFilename;
+		if (::detail::getShaderBytecodeCacheFilename(renderer, virtualDirectoryName, virtualFilename))
+		{
+			IFileManager& fileManager = renderer.getFileManager();
+			IFile* shaderBytecodeCacheFile = fileManager.createDirectories(virtualDirectoryName.c_str()) ? fileManager.openFile(IFileManager::FileMode::WRITE, virtualFilename.c_str()) : nullptr;
+			if (nullptr != shaderBytecodeCacheFile)
+			{
+				shaderBytecodeCacheFile->write(mShaderBytecodeCacheBuffer.data(), mShaderBytecodeCacheBuffer.size());
+				fileManager.closeFile(*shaderBytecodeCacheFile);
+
+				// Release the in-memory shader bytecode cache and map the written shader bytecode cache file instead, the offsets of the packed shader bytecodes stay the same
+				// -> Keep the in-memory shader bytecode cache if the written shader bytecode cache file can't be opened again
+				ByteVector shaderBytecodeCacheBuffer(std::move(mShaderBytecodeCacheBuffer));
+				closeShaderBytecodeCache();
+				openShaderBytecodeCache();
+				if (nullptr == mShaderBytecodeCacheData)
+				{
+					mShaderBytecodeCacheBuffer = std::move(shaderBytecodeCacheBuffer);
+					mShaderBytecodeCacheData = mShaderBytecodeCacheBuffer.data();
+				}
+			}
+			else
+			{
+				RHI_LOG(CRITICAL, "The renderer failed to save the shader bytecode cache to \"%s\"", virtualFilename.c_str())
+			}
+		}
+	}
+
+	const Rhi::ShaderBytecode* ShaderCacheManager::getShaderBytecode(const ShaderCache& shaderCache, Rhi::ShaderBytecode& decompressedShaderBytecode) const
+	{
+		SE_ASSERT(nullptr == shaderCache.getMasterShaderCache(), "Only master shader caches have a shader bytecode")
+
+		// Shader caches created during runtime own their shader bytecode
+		if (!shaderCache.isShaderBytecodePacked())
+		{
+			return (0 != shaderCache.mShaderBytecode.getNumberOfBytes()) ? &shaderCache.mShaderBytecode : nullptr;
+		}
+
+		// Decompress the packed shader bytecode directly into the shader bytecode storage
+		SE_ASSERT(nullptr != mShaderBytecodeCacheData, "Invalid shader bytecode cache data")
+		uint8_t* bytecode = decompressedShaderBytecode.allocateBytecode(shaderCache.mNumberOfShaderBytecodeBytes);
+		const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(mShaderBytecodeCacheData + shaderCache.mPackedShaderBytecodeOffset), reinterpret_cast<char*>(bytecode), static_cast<int>(shaderCache.mNumberOfPackedShaderBytecodeBytes), static_cast<int>(shaderCache.mNumberOfShaderBytecodeBytes));
+		if (static_cast<int>(shaderCache.mNumberOfShaderBytecodeBytes) != numberOfDecompressedBytes)
+		{
+			RHI_LOG(CRITICAL, "The renderer failed to decompress the shader bytecode of shader cache %u", shaderCache.mShaderCacheId)
+			return nullptr;
+		}
+		return &decompressedShaderBytecode;
+	}
+
+	void ShaderCacheManager::createGraphicsShaderFromBytecode(std::unique_lock<std::mutex>& mutexLock, ShaderCache& shaderCache, const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShaderLanguage& shaderLanguage, GraphicsShaderType graphicsShaderType)
+	{
+		// Decompress the shader bytecode and create the RHI shader instance without holding the shader cache manager mutex
+		// -> The shared shader bytecode cache lock is taken before the shader cache manager mutex is unlocked, so the shader bytecode cache can't be replaced in between
+		Rhi::IShaderPtr shaderPtr;
+		std::shared_lock<std::shared_mutex> shaderBytecodeCacheMutexLock(mShaderBytecodeCacheMutex);
+		mutexLock.unlock();
+		Rhi::ShaderBytecode decompressedShaderBytecode;
+		const Rhi::ShaderBytecode* shaderBytecode = getShaderBytecode(shaderCache, decompressedShaderBytecode);
+		shaderBytecodeCacheMutexLock.unlock();
+		SE_ASSERT(nullptr != shaderBytecode, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
+		if (nullptr != shaderBytecode)
+		{
+			switch (graphicsShaderType)
+			{
+				case GraphicsShaderType::Vertex:
+				{
+					const Rhi::VertexAttributes& vertexAttributes = mShaderBlueprintResourceManager.getRenderer().getVertexAttributesResourceManager().getById(materialBlueprintResource.getVertexAttributesResourceId()).getVertexAttributes();
+					shaderPtr = shaderLanguage.createVertexShaderFromBytecode(vertexAttributes, *shaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+					break;
+				}
+
+				case GraphicsShaderType::TessellationControl:
+					shaderPtr = shaderLanguage.createTessellationControlShaderFromBytecode(*shaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+					break;
+
+				case GraphicsShaderType::TessellationEvaluation:
+					shaderPtr = shaderLanguage.createTessellationEvaluationShaderFromBytecode(*shaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+					break;
+
+				case GraphicsShaderType::Geometry:
+					// TODO(co) "Renderer::ShaderCacheManager::getGraphicsShaderCache()" needs to provide additional geometry shader information
+					// shaderPtr = shaderLanguage.createGeometryShaderFromBytecode(*shaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+					break;
+
+				case GraphicsShaderType::Fragment:
+					shaderPtr = shaderLanguage.createFragmentShaderFromBytecode(*shaderBytecode RHI_RESOURCE_DEBUG_NAME("From bytecode"));
+					break;
+			}
+		}
+
+		// Another thread might have been faster, in which case our RHI shader instance is released again
+		mutexLock.lock();
+		if (nullptr == shaderCache.mShaderPtr.GetPointer())
+		{
+			shaderCache.mShaderPtr = shaderPtr;
+		}
+	}
+
+	void ShaderCacheManager::createComputeShaderFromBytecode(std::unique_lock<std::mutex>& mutexLock, ShaderCache& shaderCache, Rhi::IShaderLanguage& shaderLanguage)
+	{
+		// Decompress the shader bytecode and create the RHI shader instance without holding the shader cache manager mutex, see "Renderer::ShaderCacheManager::createGraphicsShaderFromBytecode()"
+		Rhi::IShaderPtr shaderPtr;
+		std::shared_lock<std::shared_mutex> shaderBytecodeCacheMutexLock(mShaderBytecodeCacheMutex);
+		mutexLock.unlock();
+		Rhi::ShaderBytecode decompressedShaderBytecode;
+		const Rhi::ShaderBytecode* shaderBytecode = getShaderBytecode(shaderCache, decompressedShaderBytecode);
+		shaderBytecodeCacheMutexLock.unlock();
+		SE_ASSERT(nullptr != shaderBytecode, "A shader cache must always have a valid shader bytecode, else it's a pointless shader cache. This might be the result of a shader compilation error.")
+		if (nullptr != shaderBytecode)
+		{
+			shaderPtr = shaderLanguage.createComputeShaderFromBytecode(*shaderBytecode);
+		}
+
+		// Another thread might have been faster, in which case our RHI shader instance is released again
+		mutexLock.lock();
+		if (nullptr == shaderCache.mShaderPtr.GetPointer())
+		{
+			shaderCache.mShaderPtr = shaderPtr;
+		}
+	}
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
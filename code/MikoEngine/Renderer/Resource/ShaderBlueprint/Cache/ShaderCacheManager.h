@@ -2,6 +2,15 @@
 
 #include "Renderer/Resource/ShaderBlueprint/GraphicsShaderType.h"
 
+// Disable warnings in external headers, we can't fix them
+SE_PRAGMA_WARNING_PUSH
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Generic_error_category': copy constructor was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Generic_error_category': assignment operator was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	SE_PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <shared_mutex>
+SE_PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Forward declarations                                  ]
@@ -9,6 +18,7 @@
 namespace Rhi
 {
 	class IShaderLanguage;
+	class ShaderBytecode;
 }
 class IFile;
 namespace Renderer
@@ -43,6 +53,14 @@ namespace Renderer
 	*  @brief
 	*    Shader cache manager
 	*
+	*  @remarks
+	*    The shader bytecodes of the master shader caches are saved into a shader bytecode cache file next to the pipeline state object cache:
+	*    One contiguous blob with an index table sorted by shader cache ID, each shader bytecode is LZ4 compressed on its own. When loading,
+	*    the shader bytecode cache is mapped read-only if the file manager supports file views and shader caches only remember where their
+	*    shader bytecode is located inside it. A shader bytecode is decompressed on demand when the RHI shader instance is created, shader
+	*    bytecodes of shader combinations which are never used are never touched. Decompressing and creating the RHI shader instance is done
+	*    without holding the shader cache manager mutex, so the pipeline state compiler threads don't stall each other.
+	*
 	*  @see
 	*    - See "Renderer::GraphicsPipelineStateCacheManager" and "Renderer::ComputePipelineStateCacheManager" for additional information
 	*/
@@ -115,7 +133,9 @@ namespace Renderer
 	private:
 		inline explicit ShaderCacheManager(ShaderBlueprintResourceManager& shaderBlueprintResourceManager) :
 			mShaderBlueprintResourceManager(shaderBlueprintResourceManager),
-			mCacheNeedsSaving(false)
+			mCacheNeedsSaving(false),
+			mShaderBytecodeCacheFile(nullptr),
+			mShaderBytecodeCacheData(nullptr)
 		{
 			// Nothing here
 		}
@@ -139,6 +159,39 @@ namespace Renderer
 		}
 
 		void saveCache(IFile& file);
+		void openShaderBytecodeCache();
+		void closeShaderBytecodeCache();
+		void saveShaderBytecodeCache(const std::vector<ShaderCache*>& packedShaderCaches);
+
+		/**
+		*  @brief
+		*    Return the shader bytecode of a master shader cache, decompress it if it's packed inside the shader bytecode cache
+		*
+		*  @param[in] shaderCache
+		*    Master shader cache to return the shader bytecode of
+		*  @param[out] decompressedShaderBytecode
+		*    Receives the decompressed shader bytecode if the shader bytecode is packed, it's decompressed directly into its storage
+		*
+		*  @return
+		*    The shader bytecode, "decompressedShaderBytecode" or the shader bytecode of the shader cache, null pointer on error
+		*
+		*  @note
+		*    - "Renderer::ShaderCacheManager::mShaderBytecodeCacheMutex" must be locked, shared is sufficient
+		*/
+		[[nodiscard]] const Rhi::ShaderBytecode* getShaderBytecode(const ShaderCache& shaderCache, Rhi::ShaderBytecode& decompressedShaderBytecode) const;
+
+		/**
+		*  @brief
+		*    Create the RHI shader instance of a master shader cache using its shader bytecode
+		*
+		*  @param[in] mutexLock
+		*    Lock of "Renderer::ShaderCacheManager::mMutex", must be locked; it's unlocked while decompressing and creating the RHI shader instance and locked again on return
+		*
+		*  @note
+		*    - Several threads might create the RHI shader instance of the same shader cache at the same time, the first one wins
+		*/
+		void createGraphicsShaderFromBytecode(std::unique_lock<std::mutex>& mutexLock, ShaderCache& shaderCache, const MaterialBlueprintResource& materialBlueprintResource, Rhi::IShaderLanguage& shaderLanguage, GraphicsShaderType graphicsShaderType);
+		void createComputeShaderFromBytecode(std::unique_lock<std::mutex>& mutexLock, ShaderCache& shaderCache, Rhi::IShaderLanguage& shaderLanguage);
 
 
 	//[-------------------------------------------------------]
@@ -147,6 +200,7 @@ namespace Renderer
 	private:
 		typedef std::unordered_map<ShaderCacheId, ShaderCache*>		  ShaderCacheByShaderCacheId;
 		typedef std::unordered_map<ShaderSourceCodeId, ShaderCacheId> ShaderCacheByShaderSourceCodeId;
+		typedef std::vector<uint8_t>								  ByteVector;
 
 
 	//[-------------------------------------------------------]
@@ -158,6 +212,11 @@ namespace Renderer
 		ShaderCacheByShaderSourceCodeId	mShaderCacheByShaderSourceCodeId;	// Shader source code ID to shader cache ID mapping
 		bool							mCacheNeedsSaving;					// "true" if a cache needs saving due to changes during runtime, else "false"
 		std::mutex						mMutex;								// Mutex due to "Renderer::GraphicsPipelineStateCompiler" and "Renderer::ComputePipelineStateCompiler" interaction, no too fine granular lock/unlock required because usually it's only asynchronous or synchronous processing, not both at one and the same time
+		// Shader bytecode cache
+		std::shared_mutex				mShaderBytecodeCacheMutex;			// Shared while decompressing shader bytecodes without holding "mMutex", exclusive while the shader bytecode cache is opened, replaced or closed
+		IFile*							mShaderBytecodeCacheFile;			// Kept open as long as the shader bytecode cache is mapped, else null pointer
+		const uint8_t*					mShaderBytecodeCacheData;			// View onto the whole shader bytecode cache or "mShaderBytecodeCacheBuffer", null pointer if there's no shader bytecode cache
+		ByteVector						mShaderBytecodeCacheBuffer;			// Shader bytecode cache data if the file manager doesn't support file views or if the saved shader bytecode cache couldn't be mapped again
 
 
 	};
@@ -3,6 +3,7 @@
 #include "Renderer/Resource/ShaderBlueprint/Loader/ShaderBlueprintFileFormat.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
+#include "Renderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 #include "Renderer/Resource/ShaderPiece/ShaderPieceResourceManager.h"
 #include "Renderer/Resource/Material/MaterialResourceManager.h"
 #include "Renderer/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
@@ -89,8 +90,9 @@ namespace Renderer
 			}
 
 			// Read the shader blueprint ASCII source code
+			// -> The shader combination independent part of the preprocessing is done only once per shader blueprint, not for each shader combination
 			mMemoryFile.read(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
-			mShaderBlueprintResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
+			Preprocessor::prepareSourceCode(std::string_view(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes), mShaderBlueprintResource->mShaderSourceCode);
 		}
 	}
 
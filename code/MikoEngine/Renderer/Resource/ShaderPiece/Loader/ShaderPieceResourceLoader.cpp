@@ -4,6 +4,7 @@
 #include "Renderer/Resource/ShaderPiece/ShaderPieceResource.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResourceManager.h"
 #include "Renderer/Resource/ShaderBlueprint/ShaderBlueprintResource.h"
+#include "Renderer/Resource/ShaderBlueprint/Cache/Preprocessor.h"
 #include "Renderer/Resource/Material/MaterialResourceManager.h"
 #include "Renderer/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
@@ -55,8 +56,9 @@ namespace Renderer
 		}
 
 		// Read the shader piece ASCII source code
+		// -> The shader combination independent part of the preprocessing is done only once per shader piece, not for each shader combination
 		mMemoryFile.read(mShaderSourceCode, shaderPieceHeader.numberOfShaderSourceCodeBytes);
-		mShaderPieceResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderPieceHeader.numberOfShaderSourceCodeBytes);
+		Preprocessor::prepareSourceCode(std::string_view(mShaderSourceCode, shaderPieceHeader.numberOfShaderSourceCodeBytes), mShaderPieceResource->mShaderSourceCode);
 	}
 
 	bool ShaderPieceResourceLoader::onDispatch()
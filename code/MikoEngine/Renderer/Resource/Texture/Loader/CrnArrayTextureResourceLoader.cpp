@@ -5,7 +5,6 @@
 #include "Renderer/Resource/Texture/TextureResource.h"
 #include "Core/File/IFile.h"
 #include "Renderer/IRenderer.h"
-#include "Core/File/IFileManager.h"
 #include "Renderer/Asset/AssetManager.h"
 
 #ifndef RENDERER_CRN_INCLUDED
@@ -60,14 +59,13 @@ namespace Renderer
 
 			// Get the accumulated file size
 			const AssetManager& assetManager = mRenderer.getAssetManager();
-			const IFileManager& fileManager = mRenderer.getFileManager();
 			mNumberOfUsedFileDataBytes = 0;
 			mSliceFileMetadata.clear();
 			mSliceFileMetadata.reserve(mNumberOfSlices);
 			for (uint32_t i = 0; i < mNumberOfSlices; ++i)
 			{
 				const Asset& asset = assetManager.getAssetByAssetId(mAssetIds[i]);	// TODO(co) Usually considered to be multithreading safe, but better review this
-				const int64_t fileSize = fileManager.getFileSize(asset.virtualFilename);
+				const int64_t fileSize = assetManager.getAssetFileSize(asset);
 				SE_ASSERT(fileSize > 0, "Invalid file size")
 				mSliceFileMetadata.emplace_back(asset, mNumberOfUsedFileDataBytes, static_cast<uint32_t>(fileSize));
 				mNumberOfUsedFileDataBytes += static_cast<uint32_t>(fileSize);
@@ -82,11 +80,11 @@ namespace Renderer
 			}
 			for (const SliceFileMetadata& sliceFileMetadata : mSliceFileMetadata)
 			{
-				IFile* sliceFile = fileManager.openFile(IFileManager::FileMode::READ, sliceFileMetadata.asset.virtualFilename);
+				IFile* sliceFile = assetManager.openAssetFile(sliceFileMetadata.asset);
 				if (nullptr != sliceFile)
 				{
 					sliceFile->read(mFileData + sliceFileMetadata.offset, sliceFileMetadata.numberOfBytes);
-					fileManager.closeFile(*sliceFile);
+					assetManager.closeAssetFile(sliceFileMetadata.asset, *sliceFile);
 				}
 				else
 				{
@@ -298,6 +296,7 @@ namespace Renderer
 			mWidth = std::max(1U, mWidth >> startLevelIndex);
 			mHeight = std::max(1U, mHeight >> startLevelIndex);
 		}
+		setStreamingInformation(0, std::max(mWidth, mHeight), mNumberOfUsedImageDataBytes);
 
 		// Can we create the RHI resource asynchronous as well?
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
@@ -44,6 +44,31 @@ namespace
 			return 0;
 		}
 
+		[[nodiscard]] bool isCrnHeaderWithMipmapOffsets(const crnd::crn_header& crnHeader, uint32_t numberOfFileBytes)
+		{
+			return (crnHeader.m_header_size <= numberOfFileBytes && crnHeader.m_levels > 0 && 0 == (crnHeader.m_flags & crnd::cCRNHeaderFlagSegmented));
+		}
+
+		[[nodiscard]] bool getSkippedMipmapsFileRange(const crnd::crn_header& crnHeader, uint32_t numberOfFileBytes, uint32_t topMipmapIndex, uint32_t& firstMipmapOffset, uint32_t& topMipmapOffset)
+		{
+			// The mipmaps are stored from the biggest to the smallest one behind the header, the palettes and the tables
+			// -> Returns "false" if there's nothing to skip or if the file layout is unexpected, the complete file has to be read in this case
+			if (topMipmapIndex > 0 && sizeof(crnd::crn_header) + (crnHeader.m_levels - 1) * sizeof(crnHeader.m_level_ofs[0]) <= crnHeader.m_header_size)
+			{
+				// The palettes and the tables must be located in front of the first mipmap
+				uint32_t baseNumberOfBytes = crnHeader.m_header_size;
+				baseNumberOfBytes = std::max<uint32_t>(baseNumberOfBytes, crnHeader.m_color_endpoints.m_ofs + crnHeader.m_color_endpoints.m_size);
+				baseNumberOfBytes = std::max<uint32_t>(baseNumberOfBytes, crnHeader.m_color_selectors.m_ofs + crnHeader.m_color_selectors.m_size);
+				baseNumberOfBytes = std::max<uint32_t>(baseNumberOfBytes, crnHeader.m_alpha_endpoints.m_ofs + crnHeader.m_alpha_endpoints.m_size);
+				baseNumberOfBytes = std::max<uint32_t>(baseNumberOfBytes, crnHeader.m_alpha_selectors.m_ofs + crnHeader.m_alpha_selectors.m_size);
+				baseNumberOfBytes = std::max<uint32_t>(baseNumberOfBytes, crnHeader.m_tables_ofs + crnHeader.m_tables_size);
+				firstMipmapOffset = crnHeader.m_level_ofs[0];
+				topMipmapOffset = crnHeader.m_level_ofs[topMipmapIndex];
+				return (baseNumberOfBytes <= firstMipmapOffset && firstMipmapOffset < topMipmapOffset && topMipmapOffset < numberOfFileBytes);
+			}
+			return false;
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -62,6 +87,41 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public virtual Renderer::IResourceLoader methods      ]
 	//[-------------------------------------------------------]
+	bool CrnTextureResourceLoader::addAsynchronousReadRanges(AsyncFileReader::ReadRequest& readRequest)
+	{
+		// Read the header first and afterwards everything except the mipmaps before the top mipmap, the same way "onDeserialization()" reads the file
+		// -> A header can't be bigger than the header structure plus the offsets of the maximum number of mipmaps
+		const AsyncFileReader::ReadRequest::ReadRanges& readRanges = readRequest.getReadRanges();
+		if (readRanges.empty())
+		{
+			readRequest.addReadRange(0, sizeof(crnd::crn_header) + (cCRNMaxLevels - 1) * sizeof(uint32_t));
+			return true;
+		}
+		else if (1 == readRanges.size())
+		{
+			const uint32_t numberOfFileBytes = static_cast<uint32_t>(readRequest.getNumberOfBytes());
+			const uint64_t numberOfHeaderBytes = readRanges[0].numberOfBytes;
+			const crnd::crn_header* crnHeader = (numberOfHeaderBytes >= sizeof(crnd::crn_header)) ? crnd::crnd_get_header(readRequest.getView(sizeof(crnd::crn_header)), numberOfFileBytes) : nullptr;
+			uint32_t firstMipmapOffset = 0;
+			uint32_t topMipmapOffset = 0;
+			if (nullptr != crnHeader && ::detail::isCrnHeaderWithMipmapOffsets(*crnHeader, numberOfFileBytes) && crnHeader->m_header_size <= numberOfHeaderBytes &&
+				::detail::getSkippedMipmapsFileRange(*crnHeader, numberOfFileBytes, getTopMipmapIndex(crnHeader->m_width, crnHeader->m_height, crnHeader->m_levels), firstMipmapOffset, topMipmapOffset))
+			{
+				if (firstMipmapOffset > numberOfHeaderBytes)
+				{
+					readRequest.addReadRange(numberOfHeaderBytes, firstMipmapOffset - numberOfHeaderBytes);
+				}
+				readRequest.addReadRange(std::max<uint64_t>(topMipmapOffset, numberOfHeaderBytes));
+			}
+			else
+			{
+				readRequest.addReadRange(numberOfHeaderBytes);
+			}
+			return true;
+		}
+		return false;
+	}
+
 	bool CrnTextureResourceLoader::onDeserialization(IFile& file)
 	{
 		// Load the source image file into memory: Get file size and file data
@@ -72,7 +132,46 @@ namespace Renderer
 			delete [] mFileData;
 			mFileData = new uint8_t[mNumberOfFileDataBytes];
 		}
-		file.read(mFileData, mNumberOfUsedFileDataBytes);
+		mTopMipmapIndex = 0;
+
+		// Read the header first: The mipmaps are stored from the biggest to the smallest one behind the header, the palettes and the tables
+		// -> Mipmaps before the top mipmap are skipped and never read into memory, their file data bytes remain uninitialized and are never accessed
+		// -> If the file layout is unexpected the complete file is read, the mipmaps before the top mipmap are still not transcoded
+		uint32_t numberOfReadBytes = 0;
+		if (mNumberOfUsedFileDataBytes >= sizeof(crnd::crn_header))
+		{
+			file.read(mFileData, sizeof(crnd::crn_header));
+			numberOfReadBytes = sizeof(crnd::crn_header);
+			const crnd::crn_header* crnHeader = crnd::crnd_get_header(mFileData, mNumberOfUsedFileDataBytes);
+			if (nullptr != crnHeader && ::detail::isCrnHeaderWithMipmapOffsets(*crnHeader, mNumberOfUsedFileDataBytes))
+			{
+				if (crnHeader->m_header_size > numberOfReadBytes)
+				{
+					file.read(mFileData + numberOfReadBytes, crnHeader->m_header_size - numberOfReadBytes);
+					numberOfReadBytes = crnHeader->m_header_size;
+				}
+				const uint32_t topMipmapIndex = getTopMipmapIndex(crnHeader->m_width, crnHeader->m_height, crnHeader->m_levels);
+				mTopMipmapIndex = topMipmapIndex;
+				uint32_t firstMipmapOffset = 0;
+				uint32_t topMipmapOffset = 0;
+				if (::detail::getSkippedMipmapsFileRange(*crnHeader, mNumberOfUsedFileDataBytes, topMipmapIndex, firstMipmapOffset, topMipmapOffset))
+				{
+					// Read the palettes and the tables, skip the mipmaps before the top mipmap
+					if (firstMipmapOffset > numberOfReadBytes)
+					{
+						file.read(mFileData + numberOfReadBytes, firstMipmapOffset - numberOfReadBytes);
+					}
+					file.skip(topMipmapOffset - firstMipmapOffset);
+					numberOfReadBytes = topMipmapOffset;
+				}
+			}
+		}
+
+		// Read the remaining file data
+		if (mNumberOfUsedFileDataBytes > numberOfReadBytes)
+		{
+			file.read(mFileData + numberOfReadBytes, mNumberOfUsedFileDataBytes - numberOfReadBytes);
+		}
 
 		// Done
 		return true;
@@ -149,31 +248,14 @@ namespace Renderer
 			return;
 		}
 
-		// Handle optional top mipmap removal
-		// TODO(co) Possible optimization of optional top mipmap removal: Don't load in the skipped mipmaps into memory in the first place ("mFileData")
-		int startLevelIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
-		if (startLevelIndex >= static_cast<int>(crnTextureInfo.m_levels))
-		{
-			startLevelIndex = static_cast<int>(crnTextureInfo.m_levels) - 1;
-		}
-
-		// Optional top mipmap removal security checks
-		// -> Ensure we don't go below 4x4 to not get into troubles with 4x4 blocked based compression
-		// -> Ensure the base mipmap we tell the RHI about is a multiple of four. Even if the original base mipmap is a multiple of four, one of the lower mipmaps might not be.
-		while (startLevelIndex > 0 && (std::max(1U, mWidth >> startLevelIndex) < 4 || std::max(1U, mHeight >> startLevelIndex) < 4))
-		{
-			--startLevelIndex;
-		}
-		while (startLevelIndex > 0 && (0 != (std::max(1U, mWidth >> startLevelIndex) % 4) || (0 != std::max(1U, mHeight >> startLevelIndex) % 4)))
-		{
-			--startLevelIndex;
-		}
+		// Handle optional top mipmap removal, the skipped mipmaps haven't been read into memory in the first place (see "onDeserialization()")
+		const uint32_t startLevelIndex = mTopMipmapIndex;
 
 		// Allocate resulting image data
 		const crn_uint32 numberOfBytesPerDxtBlock = crnd::crnd_get_bytes_per_dxt_block(crnTextureInfo.m_format);
 		{
 			mNumberOfUsedImageDataBytes = 0;
-			for (crn_uint32 levelIndex = static_cast<crn_uint32>(startLevelIndex); levelIndex < crnTextureInfo.m_levels; ++levelIndex)
+			for (crn_uint32 levelIndex = startLevelIndex; levelIndex < crnTextureInfo.m_levels; ++levelIndex)
 			{
 				const crn_uint32 width = std::max(1U, mWidth >> levelIndex);
 				const crn_uint32 height = std::max(1U, mHeight >> levelIndex);
@@ -201,7 +283,7 @@ namespace Renderer
 		{ // Now transcode all face and mipmap levels into memory, one mip level at a time
 			void* decompressedImages[cCRNMaxFaces];
 			uint8_t* currentImageData = mImageData;
-			for (crn_uint32 levelIndex = static_cast<crn_uint32>(startLevelIndex); levelIndex < crnTextureInfo.m_levels; ++levelIndex)
+			for (crn_uint32 levelIndex = startLevelIndex; levelIndex < crnTextureInfo.m_levels; ++levelIndex)
 			{
 				// Compute the face's width, height, number of DXT blocks per row/col, etc.
 				const crn_uint32 width = std::max(1U, mWidth >> levelIndex);
@@ -233,11 +315,13 @@ namespace Renderer
 		crnd::crnd_unpack_end(crndUnpackContext);
 
 		// In case we removed top level mipmaps, we need to update the texture dimension
+		const uint32_t resolution = std::max(mWidth, mHeight);
 		if (0 != startLevelIndex)
 		{
 			mWidth = std::max(1U, mWidth >> startLevelIndex);
 			mHeight = std::max(1U, mHeight >> startLevelIndex);
 		}
+		setStreamingInformation(resolution, std::max(mWidth, mHeight), mNumberOfUsedImageDataBytes);
 
 		// Can we create the RHI resource asynchronous as well?
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
@@ -282,6 +366,7 @@ namespace Renderer
 		mTextureFormat(0),
 		mCubeMap(false),
 		mDataContainsMipmaps(false),
+		mTopMipmapIndex(0),
 		mNumberOfFileDataBytes(0),
 		mNumberOfUsedFileDataBytes(0),
 		mFileData(nullptr),
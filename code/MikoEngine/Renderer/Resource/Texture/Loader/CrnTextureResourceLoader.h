@@ -43,6 +43,7 @@ namespace Renderer
 			return TYPE_ID;
 		}
 
+		[[nodiscard]] virtual bool addAsynchronousReadRanges(AsyncFileReader::ReadRequest& readRequest) override;
 		[[nodiscard]] virtual bool onDeserialization(IFile& file) override;
 		virtual void onProcessing() override;
 
@@ -80,6 +81,7 @@ namespace Renderer
 		uint8_t  mTextureFormat;	// "Rhi::TextureFormat", don't want to include the header in here
 		bool	 mCubeMap;
 		bool	 mDataContainsMipmaps;
+		uint32_t mTopMipmapIndex;	// The mipmaps before the top mipmap are skipped and not read into "mFileData"
 
 		// Temporary file data
 		uint32_t mNumberOfFileDataBytes;
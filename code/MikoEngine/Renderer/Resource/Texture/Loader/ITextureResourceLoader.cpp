@@ -1,6 +1,7 @@
 #include "stdafx.h"
 #include "Renderer/Resource/Texture/Loader/ITextureResourceLoader.h"
 #include "Renderer/Resource/Texture/TextureResource.h"
+#include "Renderer/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/IRenderer.h"
 
 
@@ -18,6 +19,7 @@ namespace Renderer
 	{
 		IResourceLoader::initialize(asset, reload);
 		mTextureResource = static_cast<TextureResource*>(&resource);
+		setStreamingInformation(0, 0, 0);
 	}
 
 	bool ITextureResourceLoader::onDispatch()
@@ -25,11 +27,54 @@ namespace Renderer
 		// Create the RHI texture instance
 		mTextureResource->mTexture = (mRenderer.getRhi().getCapabilities().nativeMultithreading ? mTexture : createRhiTexture());
 
+		// Tell the texture resource about the streaming information, the texture resource manager is now allowed to stream the texture resource again
+		mTextureResource->mResolution			 = mResolution;
+		mTextureResource->mResidentResolution	 = mResidentResolution;
+		mTextureResource->mNumberOfResidentBytes = mNumberOfResidentBytes;
+		mTextureResource->mStreamingLoadInFlight = false;
+
 		// Fully loaded
 		return true;
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	uint32_t ITextureResourceLoader::getTopMipmapIndex(uint32_t width, uint32_t height, uint32_t numberOfMipmaps) const
+	{
+		// Global top mipmap removal
+		uint32_t topMipmapIndex = mRenderer.getTextureResourceManager().getNumberOfTopMipmapsToRemove();
+
+		// Progressive streaming: Skip the mipmaps exceeding the maximum resolution
+		// -> The maximum resolution is only changed by the texture resource manager while no load request of the texture resource is in flight
+		const uint32_t maximumResolution = mTextureResource->getMaximumResolution();
+		while (topMipmapIndex + 1 < numberOfMipmaps && std::max(std::max(1U, width >> topMipmapIndex), std::max(1U, height >> topMipmapIndex)) > maximumResolution)
+		{
+			++topMipmapIndex;
+		}
+		if (topMipmapIndex >= numberOfMipmaps)
+		{
+			topMipmapIndex = (numberOfMipmaps > 0) ? (numberOfMipmaps - 1) : 0;
+		}
+
+		// Top mipmap removal security checks
+		// -> Ensure we don't go below 4x4 to not get into troubles with 4x4 blocked based compression
+		// -> Ensure the base mipmap we tell the RHI about is a multiple of four. Even if the original base mipmap is a multiple of four, one of the lower mipmaps might not be.
+		while (topMipmapIndex > 0 && (std::max(1U, width >> topMipmapIndex) < 4 || std::max(1U, height >> topMipmapIndex) < 4))
+		{
+			--topMipmapIndex;
+		}
+		while (topMipmapIndex > 0 && (0 != (std::max(1U, width >> topMipmapIndex) % 4) || (0 != std::max(1U, height >> topMipmapIndex) % 4)))
+		{
+			--topMipmapIndex;
+		}
+
+		// Done
+		return topMipmapIndex;
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
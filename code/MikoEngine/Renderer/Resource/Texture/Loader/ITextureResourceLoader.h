@@ -87,7 +87,10 @@ namespace Renderer
 			IResourceLoader(resourceManager),
 			mRenderer(renderer),
 			mTextureResource(nullptr),
-			mTexture(nullptr)
+			mTexture(nullptr),
+			mResolution(0),
+			mResidentResolution(0),
+			mNumberOfResidentBytes(0)
 		{
 			// Nothing here
 		}
@@ -100,6 +103,45 @@ namespace Renderer
 		explicit ITextureResourceLoader(const ITextureResourceLoader&) = delete;
 		ITextureResourceLoader& operator=(const ITextureResourceLoader&) = delete;
 
+		/**
+		*  @brief
+		*    Return the index of the mipmap to use as top mipmap
+		*
+		*  @param[in] width
+		*    Width of the first mipmap inside the texture asset
+		*  @param[in] height
+		*    Height of the first mipmap inside the texture asset
+		*  @param[in] numberOfMipmaps
+		*    Number of mipmaps inside the texture asset
+		*
+		*  @return
+		*    The index of the mipmap to use as top mipmap, all mipmaps before it are skipped
+		*
+		*  @remarks
+		*    Takes the global number of top mipmaps to remove (see "Renderer::TextureResourceManager::getNumberOfTopMipmapsToRemove()") as well
+		*    as the maximum resolution of progressively streamed texture resources into account. The top mipmap is never smaller than 4x4 and
+		*    its width and height are multiples of four to not get into troubles with 4x4 block based compression.
+		*/
+		[[nodiscard]] uint32_t getTopMipmapIndex(uint32_t width, uint32_t height, uint32_t numberOfMipmaps) const;
+
+		/**
+		*  @brief
+		*    Set the streaming information the texture resource receives when the RHI texture gets dispatched
+		*
+		*  @param[in] resolution
+		*    Resolution of the complete texture asset (the maximum of width and height), 0 if the texture resource loader can't stream the texture
+		*  @param[in] residentResolution
+		*    Resolution of the top mipmap of the created RHI texture (the maximum of width and height)
+		*  @param[in] numberOfResidentBytes
+		*    Number of texture data bytes of the created RHI texture
+		*/
+		inline void setStreamingInformation(uint32_t resolution, uint32_t residentResolution, uint32_t numberOfResidentBytes)
+		{
+			mResolution			   = resolution;
+			mResidentResolution	   = residentResolution;
+			mNumberOfResidentBytes = numberOfResidentBytes;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected data                                        ]
@@ -110,6 +152,16 @@ namespace Renderer
 		Rhi::ITexture*	 mTexture;			// In case the used RHI implementation supports native multithreading we also create the RHI resource asynchronous, but the final resource pointer reassignment must still happen synchronous
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		// Streaming information, 0 if the texture resource loader doesn't provide it, see "Renderer::ITextureResourceLoader::setStreamingInformation()"
+		uint32_t mResolution;
+		uint32_t mResidentResolution;
+		uint32_t mNumberOfResidentBytes;
+
+
 	};
 
 
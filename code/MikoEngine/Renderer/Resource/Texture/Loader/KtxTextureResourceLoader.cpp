@@ -303,6 +303,7 @@ namespace Renderer
 				height = Rhi::ITexture::getHalfSize(height);
 			}
 		}
+		setStreamingInformation(0, std::max(mWidth, mHeight), mNumberOfUsedImageDataBytes);
 		if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 		{
 			mNumberOfImageDataBytes = mNumberOfUsedImageDataBytes;
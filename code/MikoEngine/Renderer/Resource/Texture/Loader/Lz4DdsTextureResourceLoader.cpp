@@ -110,7 +110,7 @@ namespace Renderer
 		mMemoryFile.decompress();
 
 		// TODO(co) Cleanup and complete, currently just a prototype
-		// TODO(co) Add optional top mipmap removal support (see "Renderer::TextureResourceManager::NumberOfTopMipmapsToRemove")
+		// TODO(co) Optional top mipmap removal is only supported for 2D textures with a single face and slice
 
 		#define MCHAR4(a, b, c, d) (a | (b << 8) | (c << 16) | (d << 24))
 
@@ -496,23 +496,31 @@ namespace Renderer
 			}
 
 			{ // Loop through all faces
-				uint32_t width = mWidth;
-				uint32_t height = mHeight;
-				uint32_t depth = mDepth;
+				// Optional top mipmap removal: For a single face the mipmaps are stored from the biggest to the smallest one, so the mipmaps before the top mipmap can be skipped
+				const uint32_t resolution = std::max(mWidth, mHeight);
+				const bool topMipmapRemoval = (numberOfMipmaps > 1 && 1 == numberOfFaces && 1 == mDepth && 1 == mNumberOfSlices && 1 != mWidth && 1 != mHeight);
+				const uint32_t topMipmapIndex = topMipmapRemoval ? getTopMipmapIndex(mWidth, mHeight, numberOfMipmaps) : 0;
+				uint32_t numberOfSkippedImageDataBytes = 0;
 				mNumberOfUsedImageDataBytes = 0;
-				if (numberOfMipmaps > 1)
+				for (uint32_t mipmap = 0; mipmap < numberOfMipmaps; ++mipmap)
 				{
-					// Take mipmaps into account
-					while (width > 1 && height > 1 && depth > 1)
+					const uint32_t numberOfMipmapBytes = Rhi::TextureFormat::getNumberOfBytesPerSlice(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat), std::max(1U, mWidth >> mipmap), std::max(1U, mHeight >> mipmap)) * std::max(1U, mDepth >> mipmap) * mNumberOfSlices * numberOfFaces;
+					if (mipmap < topMipmapIndex)
 					{
-						mNumberOfUsedImageDataBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat), width, height) * depth * mNumberOfSlices;
-
-						width /= 2;
-						height /= 2;
-						depth /= 2;
+						numberOfSkippedImageDataBytes += numberOfMipmapBytes;
+					}
+					else
+					{
+						mNumberOfUsedImageDataBytes += numberOfMipmapBytes;
 					}
 				}
-				mNumberOfUsedImageDataBytes += Rhi::TextureFormat::getNumberOfBytesPerSlice(static_cast<Rhi::TextureFormat::Enum>(mTextureFormat), width, height) * depth * mNumberOfSlices;
+				if (0 != topMipmapIndex)
+				{
+					mMemoryFile.skip(numberOfSkippedImageDataBytes);
+					mWidth = std::max(1U, mWidth >> topMipmapIndex);
+					mHeight = std::max(1U, mHeight >> topMipmapIndex);
+				}
+				setStreamingInformation(topMipmapRemoval ? resolution : 0, std::max(mWidth, mHeight), mNumberOfUsedImageDataBytes);
 
 				if (mNumberOfImageDataBytes < mNumberOfUsedImageDataBytes)
 				{
@@ -14,7 +14,7 @@
 namespace Renderer
 {
 	class TextureResource;
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class PackedElementManager;
 }
 
 
@@ -37,6 +37,13 @@ namespace Renderer
 	/**
 	*  @brief
 	*    Texture resource class
+	*
+	*  @remarks
+	*    Texture resources loaded with progressive streaming start with the small mipmap tail only. Each frame the renderer requests the
+	*    resolution needed to display the texture on screen via "Renderer::TextureResource::requestResolution()", the texture resource
+	*    manager then reloads the texture with more top mipmaps or, in case the texture memory budget is exceeded, with less top mipmaps.
+	*    Texture resources which weren't needed for a while are evicted if the budget is still exceeded: The RHI texture is replaced by the
+	*    fallback texture until the texture resource is needed again and gets reloaded starting with the mipmap tail.
 	*/
 	class TextureResource final : public IResource
 	{
@@ -50,6 +57,13 @@ namespace Renderer
 		friend PackedElementManager<TextureResource, TextureResourceId, 2048>;	// Type definition of template class
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MIPMAP_TAIL_RESOLUTION = 128;	// Maximum resolution of the top mipmap a progressively streamed texture starts with
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -59,6 +73,56 @@ namespace Renderer
 			return mRgbHardwareGammaCorrection;
 		}
 
+		[[nodiscard]] inline bool isProgressiveStreaming() const
+		{
+			return mProgressiveStreaming;
+		}
+
+		[[nodiscard]] inline uint32_t getMaximumResolution() const
+		{
+			return mMaximumResolution;
+		}
+
+		[[nodiscard]] inline uint32_t getResolution() const
+		{
+			return mResolution;
+		}
+
+		[[nodiscard]] inline uint32_t getResidentResolution() const
+		{
+			return mResidentResolution;
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfResidentBytes() const
+		{
+			return mNumberOfResidentBytes;
+		}
+
+		[[nodiscard]] inline bool isEvicted() const
+		{
+			return mEvicted;
+		}
+
+		/**
+		*  @brief
+		*    Request the texture resolution needed to display the texture on screen
+		*
+		*  @param[in] resolution
+		*    Needed texture resolution, the maximum of width and height of the top mipmap
+		*
+		*  @note
+		*    - Thread-safe, the requests of one frame are combined by keeping the maximum
+		*    - Only has an effect on progressively streamed texture resources
+		*/
+		inline void requestResolution(uint32_t resolution)
+		{
+			uint32_t requestedResolution = mRequestedResolution.load(std::memory_order_relaxed);
+			while (requestedResolution < resolution && !mRequestedResolution.compare_exchange_weak(requestedResolution, resolution, std::memory_order_relaxed))
+			{
+				// Nothing here, "compare_exchange_weak()" updated the requested resolution
+			}
+		}
+
 		[[nodiscard]] inline const Rhi::ITexturePtr& getTexturePtr() const
 		{
 			return mTexture;
@@ -84,7 +148,17 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		inline TextureResource() :
-			mRgbHardwareGammaCorrection(false)
+			mRgbHardwareGammaCorrection(false),
+			mProgressiveStreaming(false),
+			mStreamingLoadInFlight(false),
+			mEvicted(false),
+			mMaximumResolution(std::numeric_limits<uint32_t>::max()),
+			mResolution(0),
+			mResidentResolution(0),
+			mNumberOfResidentBytes(0),
+			mLastRequestUpdateNumber(0),
+			mFallbackTextureAssetId(GetInvalid<AssetId>()),
+			mRequestedResolution(0)
 		{
 			// Nothing here
 		}
@@ -106,6 +180,16 @@ namespace Renderer
 			// Swap data
 			std::swap(mRgbHardwareGammaCorrection, textureResource.mRgbHardwareGammaCorrection);
 			std::swap(mTexture,					   textureResource.mTexture);
+			std::swap(mProgressiveStreaming,	   textureResource.mProgressiveStreaming);
+			std::swap(mStreamingLoadInFlight,	   textureResource.mStreamingLoadInFlight);
+			std::swap(mEvicted,					   textureResource.mEvicted);
+			std::swap(mMaximumResolution,		   textureResource.mMaximumResolution);
+			std::swap(mResolution,				   textureResource.mResolution);
+			std::swap(mResidentResolution,		   textureResource.mResidentResolution);
+			std::swap(mNumberOfResidentBytes,	   textureResource.mNumberOfResidentBytes);
+			std::swap(mLastRequestUpdateNumber,	   textureResource.mLastRequestUpdateNumber);
+			std::swap(mFallbackTextureAssetId,	   textureResource.mFallbackTextureAssetId);
+			mRequestedResolution.store(textureResource.mRequestedResolution.exchange(mRequestedResolution.load()));
 
 			// Done
 			return *this;
@@ -127,6 +211,16 @@ namespace Renderer
 		{
 			// Reset everything
 			mTexture = nullptr;
+			mProgressiveStreaming = false;
+			mStreamingLoadInFlight = false;
+			mEvicted = false;
+			mMaximumResolution = std::numeric_limits<uint32_t>::max();
+			mResolution = 0;
+			mResidentResolution = 0;
+			mNumberOfResidentBytes = 0;
+			mLastRequestUpdateNumber = 0;
+			SetInvalid(mFallbackTextureAssetId);
+			mRequestedResolution = 0;
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -139,6 +233,17 @@ namespace Renderer
 	private:
 		bool			 mRgbHardwareGammaCorrection;	// If true, sRGB texture formats will be used meaning the GPU will return linear space colors instead of gamma space colors when fetching texels inside a shader (the alpha channel always remains linear)
 		Rhi::ITexturePtr mTexture;						// RHI texture, can be a null pointer
+		// Progressive streaming, do only touch on the main thread while no streaming load is in flight
+		bool				  mProgressiveStreaming;	// If true, the resolution is driven by the requested resolution and the texture memory budget
+		bool				  mStreamingLoadInFlight;	// Set when a load request was committed, cleared when the texture resource loader dispatched the RHI texture
+		bool				  mEvicted;					// If true, the RHI texture is the fallback texture until the texture resource is needed again
+		uint32_t			  mMaximumResolution;		// The texture resource loader uses the biggest mipmap not exceeding this resolution as top mipmap (the maximum of width and height), "std::numeric_limits<uint32_t>::max()" to load the complete texture
+		uint32_t			  mResolution;				// Resolution of the complete texture asset (the maximum of width and height), 0 if unknown
+		uint32_t			  mResidentResolution;		// Resolution of the top mipmap of the RHI texture (the maximum of width and height), 0 if unknown
+		uint32_t			  mNumberOfResidentBytes;	// Number of texture data bytes of the RHI texture, 0 if unknown
+		uint32_t			  mLastRequestUpdateNumber;	// Texture resource manager update number the texture was needed the last time
+		AssetId				  mFallbackTextureAssetId;	// Asset ID of the texture used while the texture resource is evicted, can be invalid in which case the texture resource is never evicted
+		std::atomic<uint32_t> mRequestedResolution;		// Maximum resolution requested since the last texture resource manager update, written by multiple threads
 
 
 	};
@@ -97,6 +97,23 @@ namespace
 			#undef CREATE_TEXTURE
 		}
 
+		[[nodiscard]] uint32_t getNextPowerOfTwo(uint32_t value)
+		{
+			uint32_t powerOfTwo = 1;
+			while (powerOfTwo < value && powerOfTwo < 0x80000000u)
+			{
+				powerOfTwo <<= 1;
+			}
+			return powerOfTwo;
+		}
+
+		[[nodiscard]] uint64_t getEstimatedNumberOfBytes(uint32_t numberOfBytes, uint32_t resolution, uint32_t newResolution)
+		{
+			// The number of texture data bytes scales with the square of the resolution
+			const double scale = static_cast<double>(newResolution) / static_cast<double>(resolution);
+			return static_cast<uint64_t>(static_cast<double>(numberOfBytes) * scale * scale);
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -168,6 +185,19 @@ namespace Renderer
 		}
 	}
 
+	uint32_t TextureResourceManager::getRequiredTextureResolution(float projectedRadius) const
+	{
+		// The projected bounding sphere diameter in pixels is used as estimate of the needed texels on screen
+		// -> The culling reports the maximum float value in case the camera is inside the bounding sphere
+		// -> Never zero, a requested resolution also tells the texture resource manager the texture resource is still needed
+		const float resolution = 2.0f * projectedRadius * mTexelDensityScale;
+		if (resolution <= 1.0f)
+		{
+			return 1;
+		}
+		return (resolution < static_cast<float>(std::numeric_limits<uint32_t>::max())) ? static_cast<uint32_t>(std::ceil(resolution)) : std::numeric_limits<uint32_t>::max();
+	}
+
 	TextureResource* TextureResourceManager::getTextureResourceByAssetId(AssetId assetId) const
 	{
 		return mInternalResourceManager->getResourceByAssetId(assetId);
@@ -179,7 +209,7 @@ namespace Renderer
 		return (nullptr != textureResource) ? textureResource->getId() : GetInvalid<TextureResourceId>();
 	}
 
-	void TextureResourceManager::loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, IResourceListener* resourceListener, bool rgbHardwareGammaCorrection, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)
+	void TextureResourceManager::loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, IResourceListener* resourceListener, bool rgbHardwareGammaCorrection, bool reload, ResourceLoaderTypeId resourceLoaderTypeId, bool progressiveStreaming, ResourceLoadPriority priority)
 	{
 		// Check whether or not the texture resource already exists
 		TextureResource* textureResource = getTextureResourceByAssetId(assetId);
@@ -198,8 +228,25 @@ namespace Renderer
 			textureResource->setAssetId(assetId);
 			textureResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			textureResource->mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;
+			if (progressiveStreaming)
+			{
+				// Start with the mipmap tail, the texture resource manager update takes care of the rest
+				textureResource->mProgressiveStreaming = true;
+				textureResource->mMaximumResolution = TextureResource::MIPMAP_TAIL_RESOLUTION;
+				textureResource->mLastRequestUpdateNumber = mUpdateNumber;
+				textureResource->mFallbackTextureAssetId = fallbackTextureAssetId;
+			}
 			load = true;
 		}
+		else if (nullptr != textureResource && nullptr != asset && !progressiveStreaming && !reload && textureResource->mProgressiveStreaming)
+		{
+			// Someone needs the complete texture, disable progressive streaming and load the missing top mipmaps
+			textureResource->mProgressiveStreaming = false;
+			textureResource->mEvicted = false;
+			textureResource->mMaximumResolution = std::numeric_limits<uint32_t>::max();
+			load = (textureResource->mStreamingLoadInFlight || textureResource->mResidentResolution < textureResource->mResolution);
+			reload = load;
+		}
 
 		// Before connecting a resource listener, ensure we set the output resource ID at once so it can already directly be used inside the resource listener
 		if (nullptr != textureResource)
@@ -236,7 +283,8 @@ namespace Renderer
 			if (IsValid(resourceLoaderTypeId))
 			{
 				// Commit resource streamer asset load request
-				renderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, *this, textureResourceId));
+				textureResource->mStreamingLoadInFlight = true;
+				renderer.getResourceStreamer().commitLoadRequest(ResourceStreamer::LoadRequest(*asset, resourceLoaderTypeId, reload, *this, textureResourceId, priority));
 
 				// Since it might take a moment to load the texture resource, we'll use a fallback placeholder RHI texture resource so we don't have to wait until the real thing is there
 				// -> In case there's already a RHI texture, keep that as long as possible (for example there might be a change in the number of top mipmaps to remove)
@@ -344,6 +392,116 @@ namespace Renderer
 	}
 
 
+	void TextureResourceManager::update()
+	{
+		++mUpdateNumber;
+
+		// Gather the progressively streamed texture resources, only texture resources without load request in flight are allowed to change their resident mipmaps
+		// -> The texture resolutions were requested during the render queue fill after the culling, see "Renderer::MaterialTechnique::requestTextureResolution()"
+		// -> Texture resource loaders not providing streaming information leave the texture resolution at zero, those texture resources always stay as they are
+		// -> Evicted texture resources which are needed again are reloaded starting with the mipmap tail, the mipmap tail is small so this isn't limited
+		mScratchStreamingTextureResources.clear();
+		mNumberOfResidentBytes = 0;
+		mNumberOfResidentStreamingBytes = 0;
+		const uint32_t numberOfElements = mInternalResourceManager->getResources().getNumberOfElements();
+		for (uint32_t i = 0; i < numberOfElements; ++i)
+		{
+			TextureResource& textureResource = mInternalResourceManager->getResources().getElementByIndex(i);
+			mNumberOfResidentBytes += textureResource.mNumberOfResidentBytes;
+			if (textureResource.mProgressiveStreaming)
+			{
+				const uint32_t requestedResolution = textureResource.mRequestedResolution.exchange(0, std::memory_order_relaxed);
+				if (0 != requestedResolution)
+				{
+					textureResource.mLastRequestUpdateNumber = mUpdateNumber;
+				}
+				mNumberOfResidentStreamingBytes += textureResource.mNumberOfResidentBytes;
+				if (IResource::LoadingState::LOADED == textureResource.getLoadingState() && !textureResource.mStreamingLoadInFlight && 0 != textureResource.mResolution)
+				{
+					if (!textureResource.mEvicted)
+					{
+						mScratchStreamingTextureResources.push_back({ &textureResource, requestedResolution });
+					}
+					else if (0 != requestedResolution)
+					{
+						textureResource.mEvicted = false;
+						streamTextureResource(textureResource, TextureResource::MIPMAP_TAIL_RESOLUTION, ResourceLoadPriority::VISIBLE_NOW);	// Needed again, the fallback placeholder is shown instead
+					}
+				}
+			}
+		}
+
+		// Reload the texture resources with less or more top mipmaps
+		// -> A texture resource is only reloaded if its maximum resolution changes, texture resource loaders can't always satisfy the maximum resolution (e.g. 4x4 block based compression)
+		uint32_t numberOfReloads = 0;
+		uint64_t numberOfResidentBytes = mNumberOfResidentBytes;
+		if (0 != mTextureMemoryBudget && numberOfResidentBytes > mTextureMemoryBudget)
+		{
+			// Over budget: Drop the top mipmaps of the least recently needed and biggest texture resources first, texture resources needed right now lose one mipmap at most
+			// -> Texture resources which haven't been needed for a while are evicted instead, this releases the mipmap tail as well and needs no reload
+			std::sort(mScratchStreamingTextureResources.begin(), mScratchStreamingTextureResources.end(), [](const StreamingTextureResource& left, const StreamingTextureResource& right)
+			{
+				return (left.textureResource->mLastRequestUpdateNumber != right.textureResource->mLastRequestUpdateNumber) ? (left.textureResource->mLastRequestUpdateNumber < right.textureResource->mLastRequestUpdateNumber) : (left.textureResource->mNumberOfResidentBytes > right.textureResource->mNumberOfResidentBytes);
+			});
+			for (const StreamingTextureResource& streamingTextureResource : mScratchStreamingTextureResources)
+			{
+				if (numberOfResidentBytes <= mTextureMemoryBudget)
+				{
+					break;
+				}
+				TextureResource& textureResource = *streamingTextureResource.textureResource;
+				const uint32_t numberOfTextureResourceBytes = textureResource.mNumberOfResidentBytes;
+				if (mUpdateNumber - textureResource.mLastRequestUpdateNumber >= MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION && evictTextureResource(textureResource))
+				{
+					numberOfResidentBytes -= numberOfTextureResourceBytes;
+				}
+				else if (numberOfReloads < MAXIMUM_NUMBER_OF_STREAMING_RELOADS_PER_UPDATE && textureResource.mResidentResolution > TextureResource::MIPMAP_TAIL_RESOLUTION)
+				{
+					const uint32_t maximumResolution = (0 != streamingTextureResource.requestedResolution) ? std::max(TextureResource::MIPMAP_TAIL_RESOLUTION, textureResource.mResidentResolution / 2) : TextureResource::MIPMAP_TAIL_RESOLUTION;
+					if (maximumResolution < textureResource.mMaximumResolution)
+					{
+						numberOfResidentBytes -= textureResource.mNumberOfResidentBytes - ::detail::getEstimatedNumberOfBytes(textureResource.mNumberOfResidentBytes, textureResource.mResidentResolution, maximumResolution);
+						streamTextureResource(textureResource, maximumResolution, ResourceLoadPriority::BACKGROUND);	// Dropping top mipmaps isn't urgent, the current RHI texture stays usable
+						++numberOfReloads;
+					}
+				}
+			}
+		}
+		else
+		{
+			// Load more top mipmaps of texture resources which are needed at a higher resolution, the biggest resolution deficit first
+			std::sort(mScratchStreamingTextureResources.begin(), mScratchStreamingTextureResources.end(), [](const StreamingTextureResource& left, const StreamingTextureResource& right)
+			{
+				return (static_cast<uint64_t>(left.requestedResolution) * right.textureResource->mResidentResolution > static_cast<uint64_t>(right.requestedResolution) * left.textureResource->mResidentResolution);
+			});
+			for (const StreamingTextureResource& streamingTextureResource : mScratchStreamingTextureResources)
+			{
+				TextureResource& textureResource = *streamingTextureResource.textureResource;
+				if (numberOfReloads >= MAXIMUM_NUMBER_OF_STREAMING_RELOADS_PER_UPDATE || streamingTextureResource.requestedResolution <= textureResource.mResidentResolution)
+				{
+					// The texture resources are sorted, all following texture resources have enough resolution as well
+					break;
+				}
+				if (textureResource.mResidentResolution < textureResource.mResolution)
+				{
+					const uint32_t maximumResolution = ::detail::getNextPowerOfTwo(std::min(streamingTextureResource.requestedResolution, textureResource.mResolution));
+					if (maximumResolution > textureResource.mMaximumResolution)
+					{
+						// Respect the texture memory budget
+						const uint64_t newNumberOfResidentBytes = ::detail::getEstimatedNumberOfBytes(textureResource.mNumberOfResidentBytes, textureResource.mResidentResolution, std::min(maximumResolution, textureResource.mResolution));
+						if (0 == mTextureMemoryBudget || numberOfResidentBytes - textureResource.mNumberOfResidentBytes + newNumberOfResidentBytes <= mTextureMemoryBudget)
+						{
+							numberOfResidentBytes = numberOfResidentBytes - textureResource.mNumberOfResidentBytes + newNumberOfResidentBytes;
+							streamTextureResource(textureResource, maximumResolution, ResourceLoadPriority::PREFETCH);	// A lower resolution is shown in the meantime
+							++numberOfReloads;
+						}
+					}
+				}
+			}
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private virtual Renderer::IResourceManager methods    ]
 	//[-------------------------------------------------------]
@@ -374,7 +532,12 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	TextureResourceManager::TextureResourceManager(IRenderer& renderer) :
-		mNumberOfTopMipmapsToRemove(0)
+		mNumberOfTopMipmapsToRemove(0),
+		mTextureMemoryBudget(0),
+		mNumberOfResidentBytes(0),
+		mNumberOfResidentStreamingBytes(0),
+		mTexelDensityScale(1.0f),
+		mUpdateNumber(0)
 	{
 		mInternalResourceManager = new ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>(renderer, *this);
 		::detail::createDefaultDynamicTextureAssets(renderer, *this);
@@ -385,6 +548,35 @@ namespace Renderer
 		delete mInternalResourceManager;
 	}
 
+	void TextureResourceManager::streamTextureResource(TextureResource& textureResource, uint32_t maximumResolution, ResourceLoadPriority priority)
+	{
+		// The texture resource loader picks the top mipmap by using the maximum resolution, the current RHI texture is used until the new one has been dispatched
+		textureResource.mMaximumResolution = maximumResolution;
+		TextureResourceId textureResourceId = GetInvalid<TextureResourceId>();
+		loadTextureResourceByAssetId(textureResource.getAssetId(), GetInvalid<AssetId>(), textureResourceId, nullptr, textureResource.isRgbHardwareGammaCorrection(), true, textureResource.getResourceLoaderTypeId(), true, priority);
+	}
+
+	bool TextureResourceManager::evictTextureResource(TextureResource& textureResource)
+	{
+		// Texture resources without fallback texture can't be evicted, there would be nothing to render with
+		const TextureResource* fallbackTextureResource = IsValid(textureResource.mFallbackTextureAssetId) ? getTextureResourceByAssetId(textureResource.mFallbackTextureAssetId) : nullptr;
+		if (nullptr == fallbackTextureResource || nullptr == fallbackTextureResource->getTexturePtr())
+		{
+			return false;
+		}
+
+		// Release the RHI texture by switching to the fallback texture, the resource listeners (e.g. material techniques) get informed about the change
+		// -> Once the texture resource is needed again, it's reloaded starting with the mipmap tail
+		textureResource.mEvicted = true;
+		textureResource.mMaximumResolution = TextureResource::MIPMAP_TAIL_RESOLUTION;
+		textureResource.mResidentResolution = 0;
+		textureResource.mNumberOfResidentBytes = 0;
+		textureResource.setTexture(fallbackTextureResource->getTexturePtr());
+
+		// Done
+		return true;
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
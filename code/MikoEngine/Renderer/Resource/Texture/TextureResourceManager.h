@@ -19,7 +19,7 @@ namespace Renderer
 	class TextureResource;
 	class IRenderer;
 	class ITextureResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_CHUNK> class ResourceManagerTemplate;
 }
 
 
@@ -44,6 +44,16 @@ namespace Renderer
 	/**
 	*  @brief
 	*    Texture resource manager class
+	*
+	*  @remarks
+	*    Progressively streamed texture resources (see "Renderer::TextureResource") are driven by the texture resolutions requested during
+	*    the render queue fill after the culling: Once per update the texture resource manager reloads a few texture resources with more top
+	*    mipmaps. If the resident texture data exceeds the texture memory budget, the least recently needed texture resources are reloaded
+	*    with less top mipmaps. RHI textures are immutable, so changing the resident mipmaps means creating a new RHI texture.
+	*
+	*    The texture memory budget covers the resident texture data of all texture resources, only progressively streamed texture resources
+	*    can be reduced though. If dropping top mipmaps isn't sufficient, progressively streamed texture resources which haven't been needed
+	*    for "MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION" updates are evicted in least recently needed order.
 	*/
 	class TextureResourceManager final : public ResourceManager<TextureResource>
 	{
@@ -88,6 +98,14 @@ namespace Renderer
 		static void getDefaultTextureAssetIds(AssetIds& assetIds);
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_STREAMING_RELOADS_PER_UPDATE = 8;			// Maximum number of progressively streamed texture resources reloaded per update to not flood the resource streamer
+		static constexpr uint32_t MINIMUM_NUMBER_OF_UNNEEDED_UPDATES_BEFORE_EVICTION = 300;	// Number of updates a texture resource must not have been needed before it can be evicted, avoids evicting texture resources which are only briefly out of view
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -98,9 +116,52 @@ namespace Renderer
 		}
 
 		void setNumberOfTopMipmapsToRemove(uint8_t numberOfTopMipmapsToRemove);
+
+		[[nodiscard]] inline uint64_t getTextureMemoryBudget() const
+		{
+			return mTextureMemoryBudget;
+		}
+
+		inline void setTextureMemoryBudget(uint64_t textureMemoryBudget)	// Number of bytes the resident texture data of all texture resources is allowed to use, 0 for no budget
+		{
+			mTextureMemoryBudget = textureMemoryBudget;
+		}
+
+		[[nodiscard]] inline uint64_t getNumberOfResidentBytes() const	// Number of resident texture data bytes of all texture resources as of the last update, texture resources created by code are not included
+		{
+			return mNumberOfResidentBytes;
+		}
+
+		[[nodiscard]] inline uint64_t getNumberOfResidentStreamingBytes() const	// Number of resident texture data bytes of progressively streamed texture resources as of the last update
+		{
+			return mNumberOfResidentStreamingBytes;
+		}
+
+		[[nodiscard]] inline float getTexelDensityScale() const
+		{
+			return mTexelDensityScale;
+		}
+
+		inline void setTexelDensityScale(float texelDensityScale)	// Number of texels per on screen pixel progressively streamed texture resources are aiming at, increase for e.g. tiled texture coordinates
+		{
+			mTexelDensityScale = texelDensityScale;
+		}
+
+		/**
+		*  @brief
+		*    Return the texture resolution needed to display a renderable manager on screen
+		*
+		*  @param[in] projectedRadius
+		*    Cached projected bounding sphere radius in pixels, see "Renderer::RenderableManager::getCachedProjectedRadius()"
+		*
+		*  @return
+		*    The texture resolution to request via "Renderer::TextureResource::requestResolution()"
+		*/
+		[[nodiscard]] uint32_t getRequiredTextureResolution(float projectedRadius) const;
+
 		[[nodiscard]] TextureResource* getTextureResourceByAssetId(AssetId assetId) const;		// Considered to be inefficient, avoid method whenever possible
 		[[nodiscard]] TextureResourceId getTextureResourceIdByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
-		void loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, IResourceListener* resourceListener = nullptr, bool rgbHardwareGammaCorrection = false, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>());	// Asynchronous
+		void loadTextureResourceByAssetId(AssetId assetId, AssetId fallbackTextureAssetId, TextureResourceId& textureResourceId, IResourceListener* resourceListener = nullptr, bool rgbHardwareGammaCorrection = false, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = GetInvalid<ResourceLoaderTypeId>(), bool progressiveStreaming = false, ResourceLoadPriority priority = ResourceLoadPriority::PREFETCH);	// Asynchronous, progressive streaming is only used if the texture resource doesn't exist, yet, a load request without progressive streaming disables it
 		TextureResourceId createTextureResourceByAssetId(AssetId assetId, Rhi::ITexture& texture, bool rgbHardwareGammaCorrection = false);	// Texture resource is not allowed to exist, yet
 		void destroyTextureResource(TextureResourceId textureResourceId);
 		void setInvalidResourceId(TextureResourceId& textureResourceId, IResourceListener& resourceListener) const;
@@ -115,11 +176,7 @@ namespace Renderer
 		[[nodiscard]] virtual IResource& getResourceByResourceId(ResourceId resourceId) const override;
 		[[nodiscard]] virtual IResource* tryGetResourceByResourceId(ResourceId resourceId) const override;
 		virtual void reloadResourceByAssetId(AssetId assetId) override;
-
-		inline virtual void update() override
-		{
-			// Nothing here
-		}
+		virtual void update() override;
 
 
 	//[-------------------------------------------------------]
@@ -129,6 +186,18 @@ namespace Renderer
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct StreamingTextureResource final
+		{
+			TextureResource* textureResource;
+			uint32_t		 requestedResolution;	// Resolution requested since the last update, 0 if the texture resource wasn't needed
+		};
+		typedef std::vector<StreamingTextureResource> StreamingTextureResources;
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -137,6 +206,8 @@ namespace Renderer
 		virtual ~TextureResourceManager() override;
 		explicit TextureResourceManager(const TextureResourceManager&) = delete;
 		TextureResourceManager& operator=(const TextureResourceManager&) = delete;
+		void streamTextureResource(TextureResource& textureResource, uint32_t maximumResolution, ResourceLoadPriority priority);
+		[[nodiscard]] bool evictTextureResource(TextureResource& textureResource);
 
 
 	//[-------------------------------------------------------]
@@ -145,6 +216,14 @@ namespace Renderer
 	private:
 		uint8_t mNumberOfTopMipmapsToRemove;	// The number of top mipmaps to remove while loading textures for efficient texture quality reduction. By setting this to e.g. two a 4096x4096 texture will become 1024x1024.
 
+		// Progressive streaming
+		uint64_t				  mTextureMemoryBudget;				// Number of bytes the resident texture data of all texture resources is allowed to use, 0 for no budget
+		uint64_t				  mNumberOfResidentBytes;			// Number of resident texture data bytes of all texture resources as of the last update
+		uint64_t				  mNumberOfResidentStreamingBytes;	// Number of resident texture data bytes of progressively streamed texture resources as of the last update
+		float					  mTexelDensityScale;				// Number of texels per on screen pixel progressively streamed texture resources are aiming at
+		uint32_t				  mUpdateNumber;					// Incremented by each update, used to find the least recently needed texture resources
+		StreamingTextureResources mScratchStreamingTextureResources;	// Scratch buffer to reduce dynamic memory allocations
+
 		// Internal resource manager implementation
 		ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>* mInternalResourceManager;
 